@@ -25,6 +25,8 @@
 #ifndef _AICUDA_ALLOCATOR_H_
 #define _AICUDA_ALLOCATOR_H_ 1
 
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_warp_allocator.h>
 #include <stddef.h>
 
 namespace aicuda {
@@ -46,57 +48,67 @@ class allocator {
     typedef allocator<_Tp1> other;
   };
 
-  __device__ allocator() {}
+  AICUDA_HD allocator() {}
 
-  __device__ allocator(const allocator &) {}
+  AICUDA_HD allocator(const allocator &) {}
 
   template <typename _Tp1>
-  __device__ allocator(const allocator<_Tp1> &) {}
+  AICUDA_HD allocator(const allocator<_Tp1> &) {}
 
-  __device__ ~allocator() {}
+  AICUDA_HD ~allocator() {}
 
-  __device__ pointer address(reference __x) const { return &__x; }
+  AICUDA_HD pointer address(reference __x) const { return &__x; }
 
-  __device__ const_pointer address(const_reference __x) const { return &__x; }
+  AICUDA_HD const_pointer address(const_reference __x) const { return &__x; }
 
-  __device__ pointer allocate(size_type __n, const void * = 0) {
+  AICUDA_HD pointer allocate(size_type __n, const void * = 0) {
+#ifdef AICUDA_STL_WARP_AGGREGATED_ALLOC
+    return static_cast<_Tp *>(__warp_aggregated_allocate(__n * sizeof(_Tp)));
+#else
     return static_cast<_Tp *>(::operator new(__n * sizeof(_Tp)));
+#endif
   }
 
-  __device__ void deallocate(pointer __p, size_type) { ::operator delete(__p); }
+  AICUDA_HD void deallocate(pointer __p, size_type) {
+#ifdef AICUDA_STL_WARP_AGGREGATED_ALLOC
+    __warp_aggregated_deallocate(__p);
+#else
+    ::operator delete(__p);
+#endif
+  }
 
-  __device__ void construct(pointer __p, const _Tp &__val) {
+  AICUDA_HD void construct(pointer __p, const _Tp &__val) {
     ::new ((void *)__p) _Tp(__val);
   }
 
-  __device__ constexpr size_type max_size() const {
+  AICUDA_HD constexpr size_type max_size() const {
     return size_t(-1) / sizeof(_Tp);
   }
 
-  __device__ void destroy(pointer __p) { __p->~_Tp(); }
+  AICUDA_HD void destroy(pointer __p) { __p->~_Tp(); }
 };
 
 template <typename _T1, typename _T2>
-__device__ inline bool operator==(const allocator<_T1> &,
-                                  const allocator<_T2> &) {
+AICUDA_HD inline bool operator==(const allocator<_T1> &,
+                                 const allocator<_T2> &) {
   return true;
 }
 
 template <typename _Tp>
-__device__ inline bool operator==(const allocator<_Tp> &,
-                                  const allocator<_Tp> &) {
+AICUDA_HD inline bool operator==(const allocator<_Tp> &,
+                                 const allocator<_Tp> &) {
   return true;
 }
 
 template <typename _T1, typename _T2>
-__device__ inline bool operator!=(const allocator<_T1> &,
-                                  const allocator<_T2> &) {
+AICUDA_HD inline bool operator!=(const allocator<_T1> &,
+                                 const allocator<_T2> &) {
   return false;
 }
 
 template <typename _Tp>
-__device__ inline bool operator!=(const allocator<_Tp> &,
-                                  const allocator<_Tp> &) {
+AICUDA_HD inline bool operator!=(const allocator<_Tp> &,
+                                 const allocator<_Tp> &) {
   return false;
 }
 
@@ -105,26 +117,26 @@ __device__ inline bool operator!=(const allocator<_Tp> &,
 
 template <typename _Alloc, bool = __is_empty(_Alloc)>
 struct __alloc_swap {
-  __device__ static void _S_do_it(_Alloc &, _Alloc &) {}
+  AICUDA_HD static void _S_do_it(_Alloc &, _Alloc &) {}
 };
 
 template <typename _Alloc>
 struct __alloc_swap<_Alloc, false> {
-  __device__ static void _S_do_it(_Alloc &__one, _Alloc &__two) {
+  AICUDA_HD static void _S_do_it(_Alloc &__one, _Alloc &__two) {
     if (__one != __two) swap(__one, __two);
   }
 };
 
 template <typename _Alloc, bool = __is_empty(_Alloc)>
 struct __alloc_neq {
-  __device__ static bool _S_do_it(const _Alloc &, const _Alloc &) {
+  AICUDA_HD static bool _S_do_it(const _Alloc &, const _Alloc &) {
     return false;
   }
 };
 
 template <typename _Alloc>
 struct __alloc_neq<_Alloc, false> {
-  __device__ static bool _S_do_it(const _Alloc &__one, const _Alloc &__two) {
+  AICUDA_HD static bool _S_do_it(const _Alloc &__one, const _Alloc &__two) {
     return __one != __two;
   }
 };
@@ -0,0 +1,158 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_ARENA_ALLOCATOR_H_
+#define _AICUDA_STL_ARENA_ALLOCATOR_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <stddef.h>
+
+namespace aicuda {
+namespace stl {
+
+// Bump allocator over a caller-supplied buffer.  Allocation advances a
+// pointer, individual deallocation is a no-op and reset() releases every
+// allocation at once.  An arena is meant to be owned by a single thread.
+class arena {
+ public:
+  // Every block is aligned at least this much, so byte allocations (e.g. the
+  // basic_string _Rep header) stay suitably aligned for their contents.
+  enum { _S_min_align = 16 };
+
+  AICUDA_HD arena(void *__buf, size_t __size)
+      : _M_begin(static_cast<char *>(__buf)),
+        _M_cur(static_cast<char *>(__buf)),
+        _M_end(static_cast<char *>(__buf) + __size) {}
+
+  AICUDA_HD void *allocate(size_t __bytes, size_t __align) {
+    if (__align < _S_min_align) __align = _S_min_align;
+    const size_t __pad = (0 - reinterpret_cast<size_t>(_M_cur)) & (__align - 1);
+    if (__bytes > size_t(_M_end - _M_cur) ||
+        __pad > size_t(_M_end - _M_cur) - __bytes) {
+      printf("arena::allocate exhausted : %lu bytes requested, %lu left\n",
+             (unsigned long)__bytes, (unsigned long)(_M_end - _M_cur));
+      assert(1 < 0);
+      return 0;
+    }
+    void *__p = _M_cur + __pad;
+    _M_cur += __pad + __bytes;
+    return __p;
+  }
+
+  AICUDA_HD void reset() { _M_cur = _M_begin; }
+
+  AICUDA_HD size_t used() const { return size_t(_M_cur - _M_begin); }
+
+  AICUDA_HD size_t capacity() const { return size_t(_M_end - _M_begin); }
+
+ private:
+  AICUDA_HD arena(const arena &);
+  AICUDA_HD arena &operator=(const arena &);
+
+  char *_M_begin;
+  char *_M_cur;
+  char *_M_end;
+};
+
+// Allocator handing out memory from an arena.  All rebinds of one
+// arena_allocator share the arena.  A default-constructed arena_allocator
+// has no arena and uses the global heap, so containers nested inside an
+// arena-backed container still work when their elements are created with
+// value_type().
+template <typename _Tp>
+class arena_allocator {
+ public:
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Tp *pointer;
+  typedef const _Tp *const_pointer;
+  typedef _Tp &reference;
+  typedef const _Tp &const_reference;
+  typedef _Tp value_type;
+
+  template <typename _Tp1>
+  struct rebind {
+    typedef arena_allocator<_Tp1> other;
+  };
+
+  AICUDA_HD arena_allocator() : _M_arena(0) {}
+
+  AICUDA_HD arena_allocator(arena &__a) : _M_arena(&__a) {}
+
+  AICUDA_HD arena_allocator(const arena_allocator &__a)
+      : _M_arena(__a._M_arena) {}
+
+  template <typename _Tp1>
+  AICUDA_HD arena_allocator(const arena_allocator<_Tp1> &__a)
+      : _M_arena(__a._M_get_arena()) {}
+
+  AICUDA_HD ~arena_allocator() {}
+
+  AICUDA_HD pointer address(reference __x) const { return &__x; }
+
+  AICUDA_HD const_pointer address(const_reference __x) const { return &__x; }
+
+  AICUDA_HD pointer allocate(size_type __n, const void * = 0) {
+    if (_M_arena)
+      return static_cast<_Tp *>(
+          _M_arena->allocate(__n * sizeof(_Tp), alignof(_Tp)));
+    return static_cast<_Tp *>(::operator new(__n * sizeof(_Tp)));
+  }
+
+  AICUDA_HD void deallocate(pointer __p, size_type) {
+    if (!_M_arena) ::operator delete(__p);
+  }
+
+  AICUDA_HD void construct(pointer __p, const _Tp &__val) {
+    ::new ((void *)__p) _Tp(__val);
+  }
+
+  AICUDA_HD void destroy(pointer __p) { __p->~_Tp(); }
+
+  AICUDA_HD constexpr size_type max_size() const {
+    return size_t(-1) / sizeof(_Tp);
+  }
+
+  AICUDA_HD arena *_M_get_arena() const { return _M_arena; }
+
+ private:
+  arena *_M_arena;
+};
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator==(const arena_allocator<_T1> &__x,
+                                 const arena_allocator<_T2> &__y) {
+  return __x._M_get_arena() == __y._M_get_arena();
+}
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator!=(const arena_allocator<_T1> &__x,
+                                 const arena_allocator<_T2> &__y) {
+  return __x._M_get_arena() != __y._M_get_arena();
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_ARENA_ALLOCATOR_H_ */
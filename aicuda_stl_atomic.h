@@ -0,0 +1,138 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_ATOMIC_H_
+#define _AICUDA_STL_ATOMIC_H_ 1
+
+#include <aicuda_stl_config.h>
+
+namespace aicuda {
+namespace stl {
+
+// Atomic read-modify-write on plain integers, usable from host and device
+// code on the same memory layout: device atomics on the GPU, the compiler's
+// __atomic builtins (what std::atomic is built on) on the host.
+
+AICUDA_HD inline int __exchange_and_add(int *__mem, int __val) {
+#if AICUDA_DEVICE_CODE
+  return atomicAdd(__mem, __val);
+#else
+  return __atomic_fetch_add(__mem, __val, __ATOMIC_ACQ_REL);
+#endif
+}
+
+AICUDA_HD inline void __atomic_add(int *__mem, int __val) {
+#if AICUDA_DEVICE_CODE
+  atomicAdd(__mem, __val);
+#else
+  __atomic_fetch_add(__mem, __val, __ATOMIC_ACQ_REL);
+#endif
+}
+
+AICUDA_HD inline int __load_relaxed(const int *__mem) {
+#if AICUDA_DEVICE_CODE
+  return *static_cast<const volatile int *>(__mem);
+#else
+  return __atomic_load_n(__mem, __ATOMIC_RELAXED);
+#endif
+}
+
+// Full-barrier compare-and-swap; returns the value seen at __mem.
+AICUDA_HD inline unsigned long long __compare_and_swap(
+    unsigned long long *__mem, unsigned long long __old,
+    unsigned long long __new) {
+#if AICUDA_DEVICE_CODE
+  __threadfence();
+  const unsigned long long __prev = atomicCAS(__mem, __old, __new);
+  __threadfence();
+  return __prev;
+#else
+  __atomic_compare_exchange_n(__mem, &__old, __new, false, __ATOMIC_SEQ_CST,
+                              __ATOMIC_SEQ_CST);
+  return __old;
+#endif
+}
+
+// __compare_and_swap ordered only among the threads of one block, for
+// words in __shared__ memory that no other block can see.
+AICUDA_HD inline unsigned long long __compare_and_swap_block(
+    unsigned long long *__mem, unsigned long long __old,
+    unsigned long long __new) {
+#if AICUDA_DEVICE_CODE
+  __threadfence_block();
+  const unsigned long long __prev = atomicCAS(__mem, __old, __new);
+  __threadfence_block();
+  return __prev;
+#else
+  return __compare_and_swap(__mem, __old, __new);
+#endif
+}
+
+AICUDA_HD inline unsigned long long __fetch_add(unsigned long long *__mem,
+                                                unsigned long long __val) {
+#if AICUDA_DEVICE_CODE
+  return atomicAdd(__mem, __val);
+#else
+  return __atomic_fetch_add(__mem, __val, __ATOMIC_ACQ_REL);
+#endif
+}
+
+AICUDA_HD inline unsigned long long __load_acquire(
+    const unsigned long long *__mem) {
+#if AICUDA_DEVICE_CODE
+  const unsigned long long __v =
+      *static_cast<const volatile unsigned long long *>(__mem);
+  __threadfence();
+  return __v;
+#else
+  return __atomic_load_n(__mem, __ATOMIC_ACQUIRE);
+#endif
+}
+
+AICUDA_HD inline unsigned long long __load_acquire_block(
+    const unsigned long long *__mem) {
+#if AICUDA_DEVICE_CODE
+  const unsigned long long __v =
+      *static_cast<const volatile unsigned long long *>(__mem);
+  __threadfence_block();
+  return __v;
+#else
+  return __load_acquire(__mem);
+#endif
+}
+
+AICUDA_HD inline void __store_release(unsigned long long *__mem,
+                                     unsigned long long __val) {
+#if AICUDA_DEVICE_CODE
+  __threadfence();
+  *static_cast<volatile unsigned long long *>(__mem) = __val;
+#else
+  __atomic_store_n(__mem, __val, __ATOMIC_RELEASE);
+#endif
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_ATOMIC_H_ */
@@ -0,0 +1,1077 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_BTREE_H_
+#define _AICUDA_STL_BTREE_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_allocator.h>
+#include <aicuda_stl_function.h>
+#include <aicuda_stl_iterator.h>
+#include <aicuda_stl_pair.h>
+#include <aicuda_stl_tree.h>
+
+namespace aicuda
+{
+namespace stl
+{
+
+// B-tree behind btree_map and btree_set.  Where _Rb_tree spends a node, a
+// color and three pointers on every value, a B-tree node holds a sorted
+// run of values: a leaf fills about 128 bytes, one device memory sector or
+// two host cache lines, and internal nodes add one child pointer per value
+// plus one.  A lookup costs one dependent load per level instead of one per
+// value compared, over a tree whose height is log base 8-30 of the size
+// rather than log base 2.
+//
+// Values live in their node's array in order, so inserting or erasing
+// shifts the values after it within the node and invalidates iterators.
+// Full nodes are split on insertion and underfull ones merged with or
+// refilled from a sibling on erasure.  Splits at the end or start of a node
+// leave the old node full, so ascending or descending insertion packs the
+// leaves densely.
+template <typename _Val>
+struct _Btree_node
+{
+  enum
+  {
+    _S_target_size = 128,
+    _S_header_size = 2 * sizeof(void *),
+    _S_fit = (_S_target_size - _S_header_size) / sizeof(_Val),
+    _S_slots = _S_fit < 3 ? 3 : _S_fit > 254 ? 254 : _S_fit,
+    _S_min_values = _S_slots / 2
+  };
+
+  typedef _Btree_node *_Node_ptr;
+
+  _Node_ptr _M_parent;
+  unsigned char _M_position;
+  unsigned char _M_count;
+  bool _M_leaf;
+  // Slots [0, _M_count) hold constructed values.
+  alignas(_Val) unsigned char _M_storage[sizeof(_Val) * _S_slots];
+
+  AICUDA_HD _Val *
+  _M_value(size_t __i)
+  {
+    return reinterpret_cast<_Val *>(_M_storage) + __i;
+  }
+
+  AICUDA_HD const _Val *
+  _M_value(size_t __i) const
+  {
+    return reinterpret_cast<const _Val *>(_M_storage) + __i;
+  }
+
+  AICUDA_HD _Node_ptr &
+  _M_child(size_t __i);
+
+  AICUDA_HD _Node_ptr
+  _M_child(size_t __i) const;
+
+  // In-order successor of the value at (__x, __i).  The end position is
+  // one past the last value of the rightmost leaf, and stays put.
+  AICUDA_HD static void
+  _S_increment(_Node_ptr &__x, int &__i)
+  {
+    if (!__x->_M_leaf)
+    {
+      __x = __x->_M_child(__i + 1);
+      while (!__x->_M_leaf)
+        __x = __x->_M_child(0);
+      __i = 0;
+      return;
+    }
+    if (++__i < __x->_M_count)
+      return;
+    _Node_ptr __y = __x;
+    int __j = __i;
+    while (__j == __y->_M_count && __y->_M_parent)
+    {
+      __j = __y->_M_position;
+      __y = __y->_M_parent;
+    }
+    if (__j < __y->_M_count)
+    {
+      __x = __y;
+      __i = __j;
+    }
+  }
+
+  AICUDA_HD static void
+  _S_decrement(_Node_ptr &__x, int &__i)
+  {
+    if (!__x->_M_leaf)
+    {
+      __x = __x->_M_child(__i);
+      while (!__x->_M_leaf)
+        __x = __x->_M_child(__x->_M_count);
+      __i = __x->_M_count - 1;
+      return;
+    }
+    while (__i == 0 && __x->_M_parent)
+    {
+      __i = __x->_M_position;
+      __x = __x->_M_parent;
+    }
+    --__i;
+  }
+};
+
+template <typename _Val>
+struct _Btree_internal_node : public _Btree_node<_Val>
+{
+  _Btree_node<_Val> *_M_children[_Btree_node<_Val>::_S_slots + 1];
+};
+
+template <typename _Val>
+AICUDA_HD inline typename _Btree_node<_Val>::_Node_ptr &
+_Btree_node<_Val>::_M_child(size_t __i)
+{
+  return static_cast<_Btree_internal_node<_Val> *>(this)->_M_children[__i];
+}
+
+template <typename _Val>
+AICUDA_HD inline typename _Btree_node<_Val>::_Node_ptr
+_Btree_node<_Val>::_M_child(size_t __i) const
+{
+  return static_cast<const _Btree_internal_node<_Val> *>(this)
+      ->_M_children[__i];
+}
+
+template <typename _Tp>
+struct _Btree_iterator
+{
+  typedef _Tp value_type;
+  typedef _Tp &reference;
+  typedef _Tp *pointer;
+
+  typedef bidirectional_iterator_tag iterator_category;
+  typedef ptrdiff_t difference_type;
+
+  typedef _Btree_iterator<_Tp> _Self;
+  typedef _Btree_node<_Tp> *_Node_ptr;
+
+  AICUDA_HD _Btree_iterator()
+      : _M_node(), _M_position() {}
+
+  AICUDA_HD _Btree_iterator(_Node_ptr __x, int __i)
+      : _M_node(__x), _M_position(__i) {}
+
+  AICUDA_HD reference
+  operator*() const
+  {
+    return *_M_node->_M_value(_M_position);
+  }
+
+  AICUDA_HD pointer
+  operator->() const
+  {
+    return _M_node->_M_value(_M_position);
+  }
+
+  AICUDA_HD _Self &
+  operator++()
+  {
+    _Btree_node<_Tp>::_S_increment(_M_node, _M_position);
+    return *this;
+  }
+
+  AICUDA_HD _Self
+  operator++(int)
+  {
+    _Self __tmp = *this;
+    _Btree_node<_Tp>::_S_increment(_M_node, _M_position);
+    return __tmp;
+  }
+
+  AICUDA_HD _Self &
+  operator--()
+  {
+    _Btree_node<_Tp>::_S_decrement(_M_node, _M_position);
+    return *this;
+  }
+
+  AICUDA_HD _Self
+  operator--(int)
+  {
+    _Self __tmp = *this;
+    _Btree_node<_Tp>::_S_decrement(_M_node, _M_position);
+    return __tmp;
+  }
+
+  AICUDA_HD bool
+  operator==(const _Self &__x) const
+  {
+    return _M_node == __x._M_node && _M_position == __x._M_position;
+  }
+
+  AICUDA_HD bool
+  operator!=(const _Self &__x) const
+  {
+    return !(*this == __x);
+  }
+
+  _Node_ptr _M_node;
+  int _M_position;
+};
+
+template <typename _Tp>
+struct _Btree_const_iterator
+{
+  typedef _Tp value_type;
+  typedef const _Tp &reference;
+  typedef const _Tp *pointer;
+
+  typedef _Btree_iterator<_Tp> iterator;
+
+  typedef bidirectional_iterator_tag iterator_category;
+  typedef ptrdiff_t difference_type;
+
+  typedef _Btree_const_iterator<_Tp> _Self;
+  typedef _Btree_node<_Tp> *_Node_ptr;
+
+  AICUDA_HD _Btree_const_iterator()
+      : _M_node(), _M_position() {}
+
+  AICUDA_HD _Btree_const_iterator(_Node_ptr __x, int __i)
+      : _M_node(__x), _M_position(__i) {}
+
+  AICUDA_HD _Btree_const_iterator(const iterator &__it)
+      : _M_node(__it._M_node), _M_position(__it._M_position) {}
+
+  AICUDA_HD iterator
+  _M_const_cast() const
+  {
+    return iterator(_M_node, _M_position);
+  }
+
+  AICUDA_HD reference
+  operator*() const
+  {
+    return *_M_node->_M_value(_M_position);
+  }
+
+  AICUDA_HD pointer
+  operator->() const
+  {
+    return _M_node->_M_value(_M_position);
+  }
+
+  AICUDA_HD _Self &
+  operator++()
+  {
+    _Btree_node<_Tp>::_S_increment(_M_node, _M_position);
+    return *this;
+  }
+
+  AICUDA_HD _Self
+  operator++(int)
+  {
+    _Self __tmp = *this;
+    _Btree_node<_Tp>::_S_increment(_M_node, _M_position);
+    return __tmp;
+  }
+
+  AICUDA_HD _Self &
+  operator--()
+  {
+    _Btree_node<_Tp>::_S_decrement(_M_node, _M_position);
+    return *this;
+  }
+
+  AICUDA_HD _Self
+  operator--(int)
+  {
+    _Self __tmp = *this;
+    _Btree_node<_Tp>::_S_decrement(_M_node, _M_position);
+    return __tmp;
+  }
+
+  AICUDA_HD bool
+  operator==(const _Self &__x) const
+  {
+    return _M_node == __x._M_node && _M_position == __x._M_position;
+  }
+
+  AICUDA_HD bool
+  operator!=(const _Self &__x) const
+  {
+    return !(*this == __x);
+  }
+
+  _Node_ptr _M_node;
+  int _M_position;
+};
+
+template <typename _Val>
+AICUDA_HD inline bool
+operator==(const _Btree_iterator<_Val> &__x,
+           const _Btree_const_iterator<_Val> &__y)
+{
+  return _Btree_const_iterator<_Val>(__x) == __y;
+}
+
+template <typename _Val>
+AICUDA_HD inline bool
+operator!=(const _Btree_iterator<_Val> &__x,
+           const _Btree_const_iterator<_Val> &__y)
+{
+  return _Btree_const_iterator<_Val>(__x) != __y;
+}
+
+template <typename _Key, typename _Val, typename _KeyOfValue,
+          typename _Compare, typename _Alloc = aicuda::stl::allocator<_Val>>
+class _Btree
+{
+  typedef _Btree_node<_Val> _Node;
+  typedef _Btree_internal_node<_Val> _Internal_node;
+  typedef _Node *_Node_ptr;
+  typedef typename _Alloc::template rebind<_Val>::other _Value_allocator;
+  typedef typename _Alloc::template rebind<_Node>::other _Leaf_allocator;
+  typedef typename _Alloc::template rebind<_Internal_node>::other
+      _Internal_allocator;
+
+  enum
+  {
+    _S_slots = _Node::_S_slots,
+    _S_min_values = _Node::_S_min_values
+  };
+
+public:
+  typedef _Key key_type;
+  typedef _Val value_type;
+  typedef value_type *pointer;
+  typedef const value_type *const_pointer;
+  typedef value_type &reference;
+  typedef const value_type &const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Alloc allocator_type;
+  typedef _Btree_iterator<value_type> iterator;
+  typedef _Btree_const_iterator<value_type> const_iterator;
+  typedef aicuda::stl::reverse_iterator<iterator> reverse_iterator;
+  typedef aicuda::stl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  AICUDA_HD _Btree()
+      : _M_comp(), _M_alloc(), _M_root(0), _M_leftmost(0), _M_rightmost(0),
+        _M_size(0) {}
+
+  AICUDA_HD _Btree(const _Compare &__comp,
+                   const allocator_type &__a = allocator_type())
+      : _M_comp(__comp), _M_alloc(__a), _M_root(0), _M_leftmost(0),
+        _M_rightmost(0), _M_size(0) {}
+
+  AICUDA_HD _Btree(const _Btree &__x)
+      : _M_comp(__x._M_comp), _M_alloc(__x._M_alloc), _M_root(0),
+        _M_leftmost(0), _M_rightmost(0), _M_size(0)
+  {
+    _M_copy_from(__x);
+  }
+
+  AICUDA_HD ~_Btree()
+  {
+    clear();
+  }
+
+  AICUDA_HD _Btree &
+  operator=(const _Btree &__x)
+  {
+    if (this != &__x)
+    {
+      clear();
+      _M_comp = __x._M_comp;
+      _M_copy_from(__x);
+    }
+    return *this;
+  }
+
+  AICUDA_HD allocator_type
+  get_allocator() const
+  {
+    return allocator_type(_M_alloc);
+  }
+
+  AICUDA_HD _Compare
+  key_comp() const
+  {
+    return _M_comp;
+  }
+
+  AICUDA_HD iterator
+  begin()
+  {
+    return iterator(_M_leftmost, 0);
+  }
+
+  AICUDA_HD const_iterator
+  begin() const
+  {
+    return const_iterator(_M_leftmost, 0);
+  }
+
+  AICUDA_HD iterator
+  end()
+  {
+    return iterator(_M_rightmost, _M_rightmost ? _M_rightmost->_M_count : 0);
+  }
+
+  AICUDA_HD const_iterator
+  end() const
+  {
+    return const_iterator(_M_rightmost,
+                          _M_rightmost ? _M_rightmost->_M_count : 0);
+  }
+
+  AICUDA_HD reverse_iterator
+  rbegin()
+  {
+    return reverse_iterator(end());
+  }
+
+  AICUDA_HD const_reverse_iterator
+  rbegin() const
+  {
+    return const_reverse_iterator(end());
+  }
+
+  AICUDA_HD reverse_iterator
+  rend()
+  {
+    return reverse_iterator(begin());
+  }
+
+  AICUDA_HD const_reverse_iterator
+  rend() const
+  {
+    return const_reverse_iterator(begin());
+  }
+
+  AICUDA_HD bool
+  empty() const
+  {
+    return _M_size == 0;
+  }
+
+  AICUDA_HD size_type
+  size() const
+  {
+    return _M_size;
+  }
+
+  AICUDA_HD size_type
+  max_size() const
+  {
+    return _M_alloc.max_size();
+  }
+
+  AICUDA_HD void
+  swap(_Btree &__x)
+  {
+    aicuda::stl::swap(_M_comp, __x._M_comp);
+    aicuda::stl::swap(_M_root, __x._M_root);
+    aicuda::stl::swap(_M_leftmost, __x._M_leftmost);
+    aicuda::stl::swap(_M_rightmost, __x._M_rightmost);
+    aicuda::stl::swap(_M_size, __x._M_size);
+  }
+
+  AICUDA_HD void
+  clear()
+  {
+    if (_M_root)
+      _M_erase_subtree(_M_root);
+    _M_root = _M_leftmost = _M_rightmost = 0;
+    _M_size = 0;
+  }
+
+  AICUDA_HD pair<iterator, bool>
+  _M_insert_unique(const value_type &__v)
+  {
+    if (!_M_root)
+      return pair<iterator, bool>(_M_insert_first(__v), true);
+    const key_type &__k = _KeyOfValue()(__v);
+    _Node_ptr __x = _M_root;
+    for (;;)
+    {
+      const int __i = _M_lower_index(__x, __k);
+      if (__i < __x->_M_count && !_M_comp(__k, _S_key(__x, __i)))
+        return pair<iterator, bool>(iterator(__x, __i), false);
+      if (__x->_M_leaf)
+        return pair<iterator, bool>(_M_insert_leaf(__x, __i, __v), true);
+      __x = __x->_M_child(__i);
+    }
+  }
+
+  // Inserts at __position when __v belongs right before it, which makes
+  // appending in key order a constant-time step; otherwise searches.
+  AICUDA_HD iterator
+  _M_insert_unique_(const_iterator __position, const value_type &__v)
+  {
+    if (!_M_root)
+      return _M_insert_first(__v);
+    const key_type &__k = _KeyOfValue()(__v);
+    if (__position == end())
+    {
+      if (_M_comp(_S_key(_M_rightmost, _M_rightmost->_M_count - 1), __k))
+        return _M_insert_leaf(_M_rightmost, _M_rightmost->_M_count, __v);
+    }
+    else if (_M_comp(__k, _KeyOfValue()(*__position)))
+    {
+      if (__position == begin())
+        return _M_insert_leaf(_M_leftmost, 0, __v);
+      const_iterator __before = __position;
+      --__before;
+      if (_M_comp(_KeyOfValue()(*__before), __k))
+      {
+        // An internal position's predecessor ends a leaf.
+        if (__position._M_node->_M_leaf)
+          return _M_insert_leaf(__position._M_node, __position._M_position,
+                                __v);
+        return _M_insert_leaf(__before._M_node, __before._M_position + 1,
+                              __v);
+      }
+    }
+    return _M_insert_unique(__v).first;
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD void
+  _M_insert_unique(_InputIterator __first, _InputIterator __last)
+  {
+    for (; __first != __last; ++__first)
+      _M_insert_unique_(end(), *__first);
+  }
+
+  AICUDA_HD void
+  erase(const_iterator __position)
+  {
+    _Node_ptr __x = __position._M_node;
+    const int __i = __position._M_position;
+    _M_alloc.destroy(__x->_M_value(__i));
+    if (!__x->_M_leaf)
+    {
+      // Refill the hole with the predecessor, which ends a leaf.
+      _Node_ptr __y = __x->_M_child(__i);
+      while (!__y->_M_leaf)
+        __y = __y->_M_child(__y->_M_count);
+      _M_move(__x->_M_value(__i), __y->_M_value(__y->_M_count - 1));
+      __x = __y;
+    }
+    else
+      for (int __j = __i; __j + 1 < __x->_M_count; ++__j)
+        _M_move(__x->_M_value(__j), __x->_M_value(__j + 1));
+    --__x->_M_count;
+    --_M_size;
+    _M_rebalance(__x);
+  }
+
+  AICUDA_HD size_type
+  erase(const key_type &__k)
+  {
+    const_iterator __position = find(__k);
+    if (__position == end())
+      return 0;
+    erase(__position);
+    return 1;
+  }
+
+  // Erasing rebalances nodes, which moves the remaining values, so each
+  // step looks the next element up again by the key it erased.
+  AICUDA_HD void
+  erase(const_iterator __first, const_iterator __last)
+  {
+    if (__first == begin() && __last == end())
+    {
+      clear();
+      return;
+    }
+    size_type __n = 0;
+    for (const_iterator __it = __first; __it != __last; ++__it)
+      ++__n;
+    while (__n--)
+    {
+      const key_type __k = _KeyOfValue()(*__first);
+      erase(__first);
+      __first = lower_bound(__k);
+    }
+  }
+
+  AICUDA_HD iterator
+  find(const key_type &__k)
+  {
+    return _M_find_tr(__k);
+  }
+
+  AICUDA_HD const_iterator
+  find(const key_type &__k) const
+  {
+    return _M_find_tr(__k);
+  }
+
+  AICUDA_HD size_type
+  count(const key_type &__k) const
+  {
+    return find(__k) != end();
+  }
+
+  AICUDA_HD iterator
+  lower_bound(const key_type &__k)
+  {
+    return _M_lower_bound_tr(__k);
+  }
+
+  AICUDA_HD const_iterator
+  lower_bound(const key_type &__k) const
+  {
+    return _M_lower_bound_tr(__k);
+  }
+
+  AICUDA_HD iterator
+  upper_bound(const key_type &__k)
+  {
+    return _M_upper_bound_tr(__k);
+  }
+
+  AICUDA_HD const_iterator
+  upper_bound(const key_type &__k) const
+  {
+    return _M_upper_bound_tr(__k);
+  }
+
+  AICUDA_HD pair<iterator, iterator>
+  equal_range(const key_type &__k)
+  {
+    iterator __lo = lower_bound(__k);
+    iterator __hi = __lo;
+    if (__hi != end() && !_M_comp(__k, _KeyOfValue()(*__hi)))
+      ++__hi;
+    return pair<iterator, iterator>(__lo, __hi);
+  }
+
+  AICUDA_HD pair<const_iterator, const_iterator>
+  equal_range(const key_type &__k) const
+  {
+    const_iterator __lo = lower_bound(__k);
+    const_iterator __hi = __lo;
+    if (__hi != end() && !_M_comp(__k, _KeyOfValue()(*__hi)))
+      ++__hi;
+    return pair<const_iterator, const_iterator>(__lo, __hi);
+  }
+
+  // A key found in an internal node ends the descent early.
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_find_tr(const _Kt &__k) const
+  {
+    _Node_ptr __x = _M_root;
+    while (__x)
+    {
+      const int __i = _M_lower_index(__x, __k);
+      if (__i < __x->_M_count && !_M_comp(__k, _S_key(__x, __i)))
+        return iterator(__x, __i);
+      if (__x->_M_leaf)
+        break;
+      __x = __x->_M_child(__i);
+    }
+    return const_cast<_Btree *>(this)->end();
+  }
+
+  // The lower bound is the lower bound within the deepest node on the
+  // search path that has one.
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_lower_bound_tr(const _Kt &__k) const
+  {
+    iterator __res = const_cast<_Btree *>(this)->end();
+    _Node_ptr __x = _M_root;
+    while (__x)
+    {
+      const int __i = _M_lower_index(__x, __k);
+      if (__i < __x->_M_count)
+        __res = iterator(__x, __i);
+      if (__x->_M_leaf)
+        break;
+      __x = __x->_M_child(__i);
+    }
+    return __res;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_upper_bound_tr(const _Kt &__k) const
+  {
+    iterator __res = const_cast<_Btree *>(this)->end();
+    _Node_ptr __x = _M_root;
+    while (__x)
+    {
+      const int __i = _M_upper_index(__x, __k);
+      if (__i < __x->_M_count)
+        __res = iterator(__x, __i);
+      if (__x->_M_leaf)
+        break;
+      __x = __x->_M_child(__i);
+    }
+    return __res;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD pair<iterator, iterator>
+  _M_equal_range_tr(const _Kt &__k) const
+  {
+    return pair<iterator, iterator>(_M_lower_bound_tr(__k),
+                                    _M_upper_bound_tr(__k));
+  }
+
+private:
+  AICUDA_HD static const key_type &
+  _S_key(const _Node *__x, int __i)
+  {
+    return _KeyOfValue()(*__x->_M_value(__i));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD int
+  _M_lower_index(const _Node *__x, const _Kt &__k) const
+  {
+    int __lo = 0;
+    int __n = __x->_M_count;
+    while (__n > 0)
+    {
+      const int __half = __n >> 1;
+      if (_M_comp(_S_key(__x, __lo + __half), __k))
+      {
+        __lo += __half + 1;
+        __n -= __half + 1;
+      }
+      else
+        __n = __half;
+    }
+    return __lo;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD int
+  _M_upper_index(const _Node *__x, const _Kt &__k) const
+  {
+    int __lo = 0;
+    int __n = __x->_M_count;
+    while (__n > 0)
+    {
+      const int __half = __n >> 1;
+      if (!_M_comp(__k, _S_key(__x, __lo + __half)))
+      {
+        __lo += __half + 1;
+        __n -= __half + 1;
+      }
+      else
+        __n = __half;
+    }
+    return __lo;
+  }
+
+  AICUDA_HD _Node_ptr
+  _M_new_node(bool __leaf, _Node_ptr __parent)
+  {
+    _Node_ptr __x;
+    if (__leaf)
+    {
+      _Leaf_allocator __a(_M_alloc);
+      __x = __a.allocate(1);
+    }
+    else
+    {
+      _Internal_allocator __a(_M_alloc);
+      __x = __a.allocate(1);
+    }
+    __x->_M_parent = __parent;
+    __x->_M_position = 0;
+    __x->_M_count = 0;
+    __x->_M_leaf = __leaf;
+    return __x;
+  }
+
+  AICUDA_HD void
+  _M_delete_node(_Node_ptr __x)
+  {
+    if (__x->_M_leaf)
+    {
+      _Leaf_allocator __a(_M_alloc);
+      __a.deallocate(__x, 1);
+    }
+    else
+    {
+      _Internal_allocator __a(_M_alloc);
+      __a.deallocate(static_cast<_Internal_node *>(__x), 1);
+    }
+  }
+
+  // Moves a value into the empty slot __to, leaving __from empty.
+  AICUDA_HD void
+  _M_move(value_type *__to, value_type *__from)
+  {
+    _M_alloc.construct(__to, *__from);
+    _M_alloc.destroy(__from);
+  }
+
+  AICUDA_HD void
+  _M_set_child(_Node_ptr __x, int __i, _Node_ptr __c)
+  {
+    __x->_M_child(__i) = __c;
+    __c->_M_parent = __x;
+    __c->_M_position = (unsigned char)__i;
+  }
+
+  AICUDA_HD iterator
+  _M_insert_first(const value_type &__v)
+  {
+    _M_root = _M_leftmost = _M_rightmost = _M_new_node(true, 0);
+    return _M_insert_leaf(_M_root, 0, __v);
+  }
+
+  AICUDA_HD iterator
+  _M_insert_leaf(_Node_ptr __x, int __i, const value_type &__v)
+  {
+    if (__x->_M_count == _S_slots)
+    {
+      const int __kept = _M_split(__x, __i);
+      if (__i > __kept)
+      {
+        __x = __x->_M_parent->_M_child(__x->_M_position + 1);
+        __i -= __kept + 1;
+      }
+    }
+    for (int __j = __x->_M_count; __j > __i; --__j)
+      _M_move(__x->_M_value(__j), __x->_M_value(__j - 1));
+    _M_alloc.construct(__x->_M_value(__i), __v);
+    ++__x->_M_count;
+    ++_M_size;
+    return iterator(__x, __i);
+  }
+
+  // Splits the full node __x, into which a value is about to go at __i:
+  // __x keeps its first values, the value after them moves up to the
+  // parent and the rest go to a new right sibling.  Splitting at the end
+  // or the start keeps the full side full.  Returns how many values __x
+  // kept.
+  AICUDA_HD int
+  _M_split(_Node_ptr __x, int __i)
+  {
+    if (!__x->_M_parent)
+    {
+      _M_root = _M_new_node(false, 0);
+      _M_set_child(_M_root, 0, __x);
+    }
+    else if (__x->_M_parent->_M_count == _S_slots)
+      _M_split(__x->_M_parent, __x->_M_position);
+
+    const int __kept = __i == _S_slots ? _S_slots - 1
+                       : __i == 0      ? 0
+                                       : _S_slots / 2;
+    const int __moved = _S_slots - __kept - 1;
+    _Node_ptr __p = __x->_M_parent;
+    _Node_ptr __y = _M_new_node(__x->_M_leaf, __p);
+    for (int __j = 0; __j < __moved; ++__j)
+      _M_move(__y->_M_value(__j), __x->_M_value(__kept + 1 + __j));
+    if (!__x->_M_leaf)
+      for (int __j = 0; __j <= __moved; ++__j)
+        _M_set_child(__y, __j, __x->_M_child(__kept + 1 + __j));
+    __y->_M_count = (unsigned char)__moved;
+
+    const int __pos = __x->_M_position;
+    for (int __j = __p->_M_count; __j > __pos; --__j)
+      _M_move(__p->_M_value(__j), __p->_M_value(__j - 1));
+    for (int __j = __p->_M_count + 1; __j > __pos + 1; --__j)
+      _M_set_child(__p, __j, __p->_M_child(__j - 1));
+    _M_move(__p->_M_value(__pos), __x->_M_value(__kept));
+    _M_set_child(__p, __pos + 1, __y);
+    ++__p->_M_count;
+    __x->_M_count = (unsigned char)__kept;
+    if (__x == _M_rightmost)
+      _M_rightmost = __y;
+    return __kept;
+  }
+
+  // Restores the minimum fill of __x and its ancestors after an erasure
+  // left __x one value short.
+  AICUDA_HD void
+  _M_rebalance(_Node_ptr __x)
+  {
+    while (__x != _M_root && __x->_M_count < _S_min_values)
+    {
+      _Node_ptr __p = __x->_M_parent;
+      const int __pos = __x->_M_position;
+      if (__pos > 0)
+      {
+        _Node_ptr __l = __p->_M_child(__pos - 1);
+        if (__l->_M_count + 1 + __x->_M_count > _S_slots)
+        {
+          _M_rotate_right(__l, __x);
+          return;
+        }
+        _M_merge(__l, __x);
+      }
+      else
+      {
+        _Node_ptr __r = __p->_M_child(__pos + 1);
+        if (__x->_M_count + 1 + __r->_M_count > _S_slots)
+        {
+          _M_rotate_left(__x, __r);
+          return;
+        }
+        _M_merge(__x, __r);
+      }
+      __x = __p;
+    }
+    if (_M_root->_M_count)
+      return;
+    _Node_ptr __old = _M_root;
+    if (__old->_M_leaf)
+      _M_root = _M_leftmost = _M_rightmost = 0;
+    else
+    {
+      _M_root = __old->_M_child(0);
+      _M_root->_M_parent = 0;
+      _M_root->_M_position = 0;
+    }
+    _M_delete_node(__old);
+  }
+
+  // Appends the separator and all of __r to its left sibling __l, then
+  // drops __r.
+  AICUDA_HD void
+  _M_merge(_Node_ptr __l, _Node_ptr __r)
+  {
+    _Node_ptr __p = __l->_M_parent;
+    const int __sep = __l->_M_position;
+    const int __n = __l->_M_count;
+    _M_move(__l->_M_value(__n), __p->_M_value(__sep));
+    for (int __j = 0; __j < __r->_M_count; ++__j)
+      _M_move(__l->_M_value(__n + 1 + __j), __r->_M_value(__j));
+    if (!__l->_M_leaf)
+      for (int __j = 0; __j <= __r->_M_count; ++__j)
+        _M_set_child(__l, __n + 1 + __j, __r->_M_child(__j));
+    __l->_M_count = (unsigned char)(__n + 1 + __r->_M_count);
+
+    for (int __j = __sep; __j + 1 < __p->_M_count; ++__j)
+      _M_move(__p->_M_value(__j), __p->_M_value(__j + 1));
+    for (int __j = __sep + 1; __j < __p->_M_count; ++__j)
+      _M_set_child(__p, __j, __p->_M_child(__j + 1));
+    --__p->_M_count;
+    if (__r == _M_rightmost)
+      _M_rightmost = __l;
+    _M_delete_node(__r);
+  }
+
+  // Moves the last value of __l up to the separator and the separator down
+  // to the front of its right sibling __x.
+  AICUDA_HD void
+  _M_rotate_right(_Node_ptr __l, _Node_ptr __x)
+  {
+    _Node_ptr __p = __x->_M_parent;
+    const int __sep = __l->_M_position;
+    for (int __j = __x->_M_count; __j > 0; --__j)
+      _M_move(__x->_M_value(__j), __x->_M_value(__j - 1));
+    _M_move(__x->_M_value(0), __p->_M_value(__sep));
+    _M_move(__p->_M_value(__sep), __l->_M_value(__l->_M_count - 1));
+    if (!__x->_M_leaf)
+    {
+      for (int __j = __x->_M_count + 1; __j > 0; --__j)
+        _M_set_child(__x, __j, __x->_M_child(__j - 1));
+      _M_set_child(__x, 0, __l->_M_child(__l->_M_count));
+    }
+    --__l->_M_count;
+    ++__x->_M_count;
+  }
+
+  // Moves the separator down to the end of __x and the first value of its
+  // right sibling __r up to the separator.
+  AICUDA_HD void
+  _M_rotate_left(_Node_ptr __x, _Node_ptr __r)
+  {
+    _Node_ptr __p = __x->_M_parent;
+    const int __sep = __x->_M_position;
+    _M_move(__x->_M_value(__x->_M_count), __p->_M_value(__sep));
+    _M_move(__p->_M_value(__sep), __r->_M_value(0));
+    for (int __j = 0; __j + 1 < __r->_M_count; ++__j)
+      _M_move(__r->_M_value(__j), __r->_M_value(__j + 1));
+    if (!__x->_M_leaf)
+    {
+      _M_set_child(__x, __x->_M_count + 1, __r->_M_child(0));
+      for (int __j = 0; __j < __r->_M_count; ++__j)
+        _M_set_child(__r, __j, __r->_M_child(__j + 1));
+    }
+    ++__x->_M_count;
+    --__r->_M_count;
+  }
+
+  AICUDA_HD void
+  _M_erase_subtree(_Node_ptr __x)
+  {
+    if (!__x->_M_leaf)
+      for (int __j = 0; __j <= __x->_M_count; ++__j)
+        _M_erase_subtree(__x->_M_child(__j));
+    for (int __j = 0; __j < __x->_M_count; ++__j)
+      _M_alloc.destroy(__x->_M_value(__j));
+    _M_delete_node(__x);
+  }
+
+  AICUDA_HD _Node_ptr
+  _M_clone(const _Node *__x, _Node_ptr __parent)
+  {
+    _Node_ptr __y = _M_new_node(__x->_M_leaf, __parent);
+    for (int __j = 0; __j < __x->_M_count; ++__j)
+      _M_alloc.construct(__y->_M_value(__j), *__x->_M_value(__j));
+    __y->_M_count = __x->_M_count;
+    if (!__x->_M_leaf)
+      for (int __j = 0; __j <= __x->_M_count; ++__j)
+        _M_set_child(__y, __j, _M_clone(__x->_M_child(__j), __y));
+    return __y;
+  }
+
+  AICUDA_HD void
+  _M_copy_from(const _Btree &__x)
+  {
+    if (!__x._M_root)
+      return;
+    _M_root = _M_clone(__x._M_root, 0);
+    _M_leftmost = _M_rightmost = _M_root;
+    while (!_M_leftmost->_M_leaf)
+      _M_leftmost = _M_leftmost->_M_child(0);
+    while (!_M_rightmost->_M_leaf)
+      _M_rightmost = _M_rightmost->_M_child(_M_rightmost->_M_count);
+    _M_size = __x._M_size;
+  }
+
+  _Compare _M_comp;
+  _Value_allocator _M_alloc;
+  _Node_ptr _M_root;
+  _Node_ptr _M_leftmost;
+  _Node_ptr _M_rightmost;
+  size_type _M_size;
+};
+
+} // namespace stl
+} // namespace aicuda
+
+#endif /* _AICUDA_STL_BTREE_H_ */
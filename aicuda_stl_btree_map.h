@@ -0,0 +1,283 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_BTREE_MAP_H_
+#define _AICUDA_STL_BTREE_MAP_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_btree.h>
+#include <assert.h>
+
+namespace aicuda {
+namespace stl {
+
+// map over a B-tree (see _Btree): same interface, many values per node.
+// Unlike map, inserting or erasing invalidates iterators.
+template <typename _Key, typename _Tp,
+          typename _Compare = aicuda::stl::less<_Key>,
+          typename _Alloc =
+              aicuda::stl::allocator<aicuda::stl::pair<const _Key, _Tp>>>
+class btree_map {
+ public:
+  typedef _Key key_type;
+  typedef _Tp mapped_type;
+  typedef aicuda::stl::pair<const _Key, _Tp> value_type;
+  typedef _Compare key_compare;
+  typedef _Alloc allocator_type;
+
+ private:
+  typedef typename _Alloc::value_type _Alloc_value_type;
+
+ public:
+  class value_compare
+      : public aicuda::stl::binary_function<value_type, value_type, bool> {
+    friend class btree_map<_Key, _Tp, _Compare, _Alloc>;
+
+   protected:
+    _Compare comp;
+
+    AICUDA_HD value_compare(_Compare __c) : comp(__c) {}
+
+   public:
+    AICUDA_HD bool operator()(const value_type &__x,
+                              const value_type &__y) const {
+      return comp(__x.first, __y.first);
+    }
+  };
+
+ private:
+  typedef typename _Alloc::template rebind<value_type>::other _Pair_alloc_type;
+
+  typedef aicuda::stl::_Btree<key_type, value_type, _Select1st<value_type>,
+                                key_compare, _Pair_alloc_type>
+      _Rep_type;
+
+  _Rep_type _M_t;
+
+ public:
+  typedef typename _Pair_alloc_type::pointer pointer;
+  typedef typename _Pair_alloc_type::const_pointer const_pointer;
+  typedef typename _Pair_alloc_type::reference reference;
+  typedef typename _Pair_alloc_type::const_reference const_reference;
+  typedef typename _Rep_type::iterator iterator;
+  typedef typename _Rep_type::const_iterator const_iterator;
+  typedef typename _Rep_type::size_type size_type;
+  typedef typename _Rep_type::difference_type difference_type;
+  typedef typename _Rep_type::reverse_iterator reverse_iterator;
+  typedef typename _Rep_type::const_reverse_iterator const_reverse_iterator;
+
+  AICUDA_HD btree_map() : _M_t() {}
+
+  AICUDA_HD explicit btree_map(const _Compare &__comp,
+                         const allocator_type &__a = allocator_type())
+      : _M_t(__comp, __a) {}
+
+  AICUDA_HD btree_map(const btree_map &__x) : _M_t(__x._M_t) {}
+
+  template <typename _InputIterator>
+  AICUDA_HD btree_map(_InputIterator __first, _InputIterator __last) : _M_t() {
+    _M_t._M_insert_unique(__first, __last);
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD btree_map(_InputIterator __first, _InputIterator __last,
+                const _Compare &__comp,
+                const allocator_type &__a = allocator_type())
+      : _M_t(__comp, __a) {
+    _M_t._M_insert_unique(__first, __last);
+  }
+
+  AICUDA_HD btree_map &operator=(const btree_map &__x) {
+    _M_t = __x._M_t;
+    return *this;
+  }
+
+  AICUDA_HD allocator_type get_allocator() const {
+    return _M_t.get_allocator();
+  }
+
+  AICUDA_HD iterator begin() { return _M_t.begin(); }
+
+  AICUDA_HD const_iterator begin() const { return _M_t.begin(); }
+
+  AICUDA_HD iterator end() { return _M_t.end(); }
+
+  AICUDA_HD const_iterator end() const { return _M_t.end(); }
+
+  AICUDA_HD reverse_iterator rbegin() { return _M_t.rbegin(); }
+
+  AICUDA_HD const_reverse_iterator rbegin() const { return _M_t.rbegin(); }
+
+  AICUDA_HD reverse_iterator rend() { return _M_t.rend(); }
+
+  AICUDA_HD const_reverse_iterator rend() const { return _M_t.rend(); }
+
+  AICUDA_HD bool empty() const { return _M_t.empty(); }
+
+  AICUDA_HD size_type size() const { return _M_t.size(); }
+
+  AICUDA_HD size_type max_size() const { return _M_t.max_size(); }
+
+  AICUDA_HD mapped_type &operator[](const key_type &__k) {
+    iterator __i = lower_bound(__k);
+
+    if (__i == end() || key_comp()(__k, (*__i).first))
+      __i = insert(__i, value_type(__k, mapped_type()));
+    return (*__i).second;
+  }
+
+  AICUDA_HD mapped_type &at(const key_type &__k) {
+    iterator __i = lower_bound(__k);
+    if (__i == end() || key_comp()(__k, (*__i).first)) assert(1 < 0);
+    return (*__i).second;
+  }
+
+  AICUDA_HD const mapped_type &at(const key_type &__k) const {
+    const_iterator __i = lower_bound(__k);
+    if (__i == end() || key_comp()(__k, (*__i).first)) assert(1 < 0);
+    return (*__i).second;
+  }
+
+  AICUDA_HD aicuda::stl::pair<iterator, bool> insert(const value_type &__x) {
+    return _M_t._M_insert_unique(__x);
+  }
+
+  AICUDA_HD iterator insert(iterator __position, const value_type &__x) {
+    return _M_t._M_insert_unique_(__position, __x);
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD void insert(_InputIterator __first, _InputIterator __last) {
+    _M_t._M_insert_unique(__first, __last);
+  }
+
+  AICUDA_HD void erase(iterator __position) { _M_t.erase(__position); }
+
+  AICUDA_HD size_type erase(const key_type &__x) { return _M_t.erase(__x); }
+
+  AICUDA_HD void erase(iterator __first, iterator __last) {
+    _M_t.erase(__first, __last);
+  }
+
+  AICUDA_HD void swap(btree_map &__x) { _M_t.swap(__x._M_t); }
+
+  AICUDA_HD void clear() { _M_t.clear(); }
+
+  AICUDA_HD key_compare key_comp() const { return _M_t.key_comp(); }
+
+  AICUDA_HD value_compare value_comp() const {
+    return value_compare(_M_t.key_comp());
+  }
+
+  AICUDA_HD iterator find(const key_type &__x) { return _M_t.find(__x); }
+
+  AICUDA_HD const_iterator find(const key_type &__x) const {
+    return _M_t.find(__x);
+  }
+
+  AICUDA_HD size_type count(const key_type &__x) const {
+    return _M_t.find(__x) == _M_t.end() ? 0 : 1;
+  }
+
+  AICUDA_HD iterator lower_bound(const key_type &__x) {
+    return _M_t.lower_bound(__x);
+  }
+
+  AICUDA_HD const_iterator lower_bound(const key_type &__x) const {
+    return _M_t.lower_bound(__x);
+  }
+
+  AICUDA_HD iterator upper_bound(const key_type &__x) {
+    return _M_t.upper_bound(__x);
+  }
+
+  AICUDA_HD const_iterator upper_bound(const key_type &__x) const {
+    return _M_t.upper_bound(__x);
+  }
+
+  AICUDA_HD aicuda::stl::pair<iterator, iterator> equal_range(
+     const key_type &__x) {
+    return _M_t.equal_range(__x);
+  }
+
+  AICUDA_HD aicuda::stl::pair<const_iterator, const_iterator> equal_range(
+     const key_type &__x) const {
+    return _M_t.equal_range(__x);
+  }
+
+  // Lookup by any key type the comparator can order against key_type, e.g.
+  // a string_view into a btree_map<string, _Tp, less<> >.  Only available when
+  // _Compare is transparent.
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  find(const _Kt &__x) { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  find(const _Kt &__x) const { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, size_type>::__type
+  count(const _Kt &__x) const {
+    return _M_t._M_find_tr(__x) == _M_t.end() ? 0 : 1;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  lower_bound(const _Kt &__x) { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  lower_bound(const _Kt &__x) const { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  upper_bound(const _Kt &__x) { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  upper_bound(const _Kt &__x) const { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt, aicuda::stl::pair<iterator, iterator>>::__type
+  equal_range(const _Kt &__x) { return _M_t._M_equal_range_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt,
+      aicuda::stl::pair<const_iterator, const_iterator>>::__type
+  equal_range(const _Kt &__x) const { return _M_t._M_equal_range_tr(__x); }
+};
+
+template <typename _Key, typename _Tp, typename _Compare, typename _Alloc>
+AICUDA_HD inline void swap(btree_map<_Key, _Tp, _Compare, _Alloc> &__x,
+                           btree_map<_Key, _Tp, _Compare, _Alloc> &__y) {
+  __x.swap(__y);
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_BTREE_MAP_H_ */
@@ -0,0 +1,428 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_CHAR_TRAITS_H_
+#define _AICUDA_STL_CHAR_TRAITS_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_function.h>
+#include <aicuda_stl_memory.h>
+#include <wchar.h> // for mbstate_t
+
+namespace aicuda
+{
+namespace stl
+{
+
+typedef long streamoff;
+typedef ptrdiff_t streamsize;
+template <typename _StateT>
+class fpos
+{
+private:
+  streamoff _M_off;
+  _StateT _M_state;
+
+public:
+  AICUDA_HD fpos() : _M_off(0), _M_state() {}
+  AICUDA_HD fpos(streamoff __off) : _M_off(__off), _M_state() {}
+
+  AICUDA_HD operator streamoff() const { return _M_off; }
+
+  AICUDA_HD void state(_StateT __st) { _M_state = __st; }
+
+  AICUDA_HD _StateT state() const { return _M_state; }
+
+  AICUDA_HD fpos &operator+=(streamoff __off)
+  {
+    _M_off += __off;
+    return *this;
+  }
+
+  AICUDA_HD fpos &operator-=(streamoff __off)
+  {
+    _M_off -= __off;
+    return *this;
+  }
+
+  AICUDA_HD fpos operator+(streamoff __off) const
+  {
+    fpos __pos(*this);
+    __pos += __off;
+    return __pos;
+  }
+
+  AICUDA_HD fpos operator-(streamoff __off) const
+  {
+    fpos __pos(*this);
+    __pos -= __off;
+    return __pos;
+  }
+
+  AICUDA_HD streamoff operator-(const fpos &__other) const
+  {
+    return _M_off - __other._M_off;
+  }
+};
+
+template <typename _StateT>
+AICUDA_HD inline bool operator==(const fpos<_StateT> &__lhs,
+                                 const fpos<_StateT> &__rhs)
+{
+  return streamoff(__lhs) == streamoff(__rhs);
+}
+
+template <typename _StateT>
+AICUDA_HD inline bool operator!=(const fpos<_StateT> &__lhs,
+                                 const fpos<_StateT> &__rhs)
+{
+  return streamoff(__lhs) != streamoff(__rhs);
+}
+
+typedef fpos<mbstate_t> streampos;
+typedef fpos<mbstate_t> wstreampos;
+
+template <typename _CharT>
+struct _Char_types
+{
+  typedef unsigned long int_type;
+  typedef streampos pos_type;
+  typedef streamoff off_type;
+  typedef mbstate_t state_type;
+};
+
+template <typename _CharT>
+struct char_traits
+{
+  typedef _CharT char_type;
+  typedef typename _Char_types<_CharT>::int_type int_type;
+  typedef typename _Char_types<_CharT>::pos_type pos_type;
+  typedef typename _Char_types<_CharT>::off_type off_type;
+  typedef typename _Char_types<_CharT>::state_type state_type;
+
+  AICUDA_HD static void assign(char_type &__c1, const char_type &__c2)
+  {
+    __c1 = __c2;
+  }
+
+  AICUDA_HD static bool eq(const char_type &__c1, const char_type &__c2)
+  {
+    return __c1 == __c2;
+  }
+
+  AICUDA_HD static bool lt(const char_type &__c1, const char_type &__c2)
+  {
+    return __c1 < __c2;
+  }
+
+  AICUDA_HD static int compare(const char_type *__s1, const char_type *__s2,
+                               size_t __n);
+
+  AICUDA_HD static size_t length(const char_type *__s);
+
+  AICUDA_HD static const char_type *find(const char_type *__s, size_t __n,
+                                         const char_type &__a);
+
+  AICUDA_HD static char_type *move(char_type *__s1, const char_type *__s2,
+                                   size_t __n);
+
+  AICUDA_HD static char_type *copy(char_type *__s1, const char_type *__s2,
+                                   size_t __n);
+
+  AICUDA_HD static char_type *assign(char_type *__s, size_t __n,
+                                     char_type __a);
+
+  AICUDA_HD static char_type to_char_type(const int_type &__c)
+  {
+    return static_cast<char_type>(__c);
+  }
+
+  AICUDA_HD static int_type to_int_type(const char_type &__c)
+  {
+    return static_cast<int_type>(__c);
+  }
+
+  AICUDA_HD static bool eq_int_type(const int_type &__c1,
+                                    const int_type &__c2)
+  {
+    return __c1 == __c2;
+  }
+
+  AICUDA_HD static int_type eof() { return static_cast<int_type>((-1)); }
+
+  AICUDA_HD static int_type not_eof(const int_type &__c)
+  {
+    return !eq_int_type(__c, eof()) ? __c : to_int_type(char_type());
+  }
+};
+
+template <typename _CharT>
+AICUDA_HD int char_traits<_CharT>::compare(const char_type *__s1,
+                                           const char_type *__s2, size_t __n)
+{
+  for (size_t __i = 0; __i < __n; ++__i)
+    if (lt(__s1[__i], __s2[__i]))
+      return -1;
+    else if (lt(__s2[__i], __s1[__i]))
+      return 1;
+  return 0;
+}
+
+template <typename _CharT>
+AICUDA_HD size_t char_traits<_CharT>::length(const char_type *__p)
+{
+  size_t __i = 0;
+  while (!eq(__p[__i], char_type()))
+    ++__i;
+  return __i;
+}
+
+template <typename _CharT>
+AICUDA_HD const typename char_traits<_CharT>::char_type *
+char_traits<_CharT>::find(const char_type *__s, size_t __n,
+                          const char_type &__a)
+{
+  for (size_t __i = 0; __i < __n; ++__i)
+    if (eq(__s[__i], __a))
+      return __s + __i;
+  return 0;
+}
+
+template <typename _CharT>
+AICUDA_HD typename char_traits<_CharT>::char_type *char_traits<_CharT>::move(
+   char_type *__s1, const char_type *__s2, size_t __n)
+{
+  return static_cast<_CharT *>(
+      string_op::memmove(__s1, __s2, __n * sizeof(char_type)));
+}
+
+template <typename _CharT>
+AICUDA_HD typename char_traits<_CharT>::char_type *char_traits<_CharT>::copy(
+   char_type *__s1, const char_type *__s2, size_t __n)
+{
+  aicuda::stl::copy(__s2, __s2 + __n, __s1);
+  return __s1;
+}
+
+template <typename _CharT>
+AICUDA_HD typename char_traits<_CharT>::char_type *char_traits<_CharT>::assign(
+   char_type *__s, size_t __n, char_type __a)
+{
+  aicuda::stl::fill_n(__s, __n, __a);
+  return __s;
+}
+
+template <>
+struct char_traits<char>
+{
+  typedef char char_type;
+  typedef int int_type;
+  typedef streampos pos_type;
+  typedef streamoff off_type;
+  typedef mbstate_t state_type;
+
+  AICUDA_HD static void assign(char_type &__c1, const char_type &__c2)
+  {
+    __c1 = __c2;
+  }
+
+  AICUDA_HD static bool eq(const char_type &__c1, const char_type &__c2)
+  {
+    return __c1 == __c2;
+  }
+
+  AICUDA_HD static bool lt(const char_type &__c1, const char_type &__c2)
+  {
+    return __c1 < __c2;
+  }
+
+  AICUDA_HD static int compare(const char_type *__s1, const char_type *__s2,
+                               size_t __n)
+  {
+    return string_op::memcmp(__s1, __s2, __n);
+  }
+
+  AICUDA_HD static size_t length(const char_type *__s)
+  {
+    return string_op::strlen(__s);
+  }
+
+  AICUDA_HD static const char_type *find(const char_type *__s, size_t __n,
+                                         const char_type &__a)
+  {
+    return static_cast<const char_type *>(string_op::memchr(__s, __a, __n));
+  }
+
+  AICUDA_HD static char_type *move(char_type *__s1, const char_type *__s2,
+                                   size_t __n)
+  {
+    return static_cast<char_type *>(string_op::memmove(__s1, __s2, __n));
+  }
+
+  AICUDA_HD static char_type *copy(char_type *__s1, const char_type *__s2,
+                                   size_t __n)
+  {
+    return static_cast<char_type *>(string_op::memcpy(__s1, __s2, __n));
+  }
+
+  AICUDA_HD static char_type *assign(char_type *__s, size_t __n,
+                                     char_type __a)
+  {
+    return static_cast<char_type *>(string_op::memset(__s, __a, __n));
+  }
+
+  AICUDA_HD static char_type to_char_type(const int_type &__c)
+  {
+    return static_cast<char_type>(__c);
+  }
+
+  AICUDA_HD static int_type to_int_type(const char_type &__c)
+  {
+    return static_cast<int_type>(static_cast<unsigned char>(__c));
+  }
+
+  AICUDA_HD static bool eq_int_type(const int_type &__c1,
+                                    const int_type &__c2)
+  {
+    return __c1 == __c2;
+  }
+
+  AICUDA_HD static int_type eof() { return static_cast<int_type>((-1)); }
+
+  AICUDA_HD static int_type not_eof(const int_type &__c)
+  {
+    return (__c == eof()) ? 0 : __c;
+  }
+};
+
+// Substring search for basic_string and basic_string_view: the first and
+// last occurrence of [__s, __s + __n) in [__p, __p + __len), or null.
+// char_traits<char> compares bytes, so it uses string_op's linear-time
+// memmem/memrmem; other traits scan for the first character with
+// traits_type::find and compare.
+template <typename _Traits>
+struct __str_search
+{
+  typedef typename _Traits::char_type _CharT;
+
+  AICUDA_HD static const _CharT *_S_find(const _CharT *__p, size_t __len,
+                                         const _CharT *__s, size_t __n)
+  {
+    if (__n == 0)
+      return __p;
+    if (__n > __len)
+      return 0;
+    const _CharT *const __last = __p + __len - __n + 1;
+    for (; __p < __last; ++__p)
+    {
+      __p = _Traits::find(__p, __last - __p, __s[0]);
+      if (!__p)
+        return 0;
+      if (_Traits::compare(__p + 1, __s + 1, __n - 1) == 0)
+        return __p;
+    }
+    return 0;
+  }
+
+  AICUDA_HD static const _CharT *_S_rfind(const _CharT *__p, size_t __len,
+                                          const _CharT *__s, size_t __n)
+  {
+    if (__n > __len)
+      return 0;
+    for (size_t __i = __len - __n + 1; __i-- > 0;)
+      if (_Traits::compare(__p + __i, __s, __n) == 0)
+        return __p + __i;
+    return 0;
+  }
+};
+
+template <>
+struct __str_search<char_traits<char> >
+{
+  AICUDA_HD static const char *_S_find(const char *__p, size_t __len,
+                                       const char *__s, size_t __n)
+  {
+    return static_cast<const char *>(string_op::memmem(__p, __len, __s, __n));
+  }
+
+  AICUDA_HD static const char *_S_rfind(const char *__p, size_t __len,
+                                        const char *__s, size_t __n)
+  {
+    return static_cast<const char *>(string_op::memrmem(__p, __len, __s, __n));
+  }
+};
+
+// Character-class scans for the find_*_of family: the index of the first
+// (_S_first) or last (_S_last) character of [__p, __p + __len) whose
+// membership in [__s, __s + __n) is __in, or size_t(-1).  char_traits<char>
+// uses string_op's bitmap scans; other traits look each character up with
+// traits_type::find.
+template <typename _Traits>
+struct __str_span
+{
+  typedef typename _Traits::char_type _CharT;
+
+  AICUDA_HD static size_t _S_first(const _CharT *__p, size_t __len,
+                                   const _CharT *__s, size_t __n, bool __in)
+  {
+    for (size_t __i = 0; __i < __len; ++__i)
+      if ((_Traits::find(__s, __n, __p[__i]) != 0) == __in)
+        return __i;
+    return size_t(-1);
+  }
+
+  AICUDA_HD static size_t _S_last(const _CharT *__p, size_t __len,
+                                  const _CharT *__s, size_t __n, bool __in)
+  {
+    for (size_t __i = __len; __i-- > 0;)
+      if ((_Traits::find(__s, __n, __p[__i]) != 0) == __in)
+        return __i;
+    return size_t(-1);
+  }
+};
+
+template <>
+struct __str_span<char_traits<char> >
+{
+  AICUDA_HD static size_t _S_first(const char *__p, size_t __len,
+                                   const char *__s, size_t __n, bool __in)
+  {
+    const size_t __r = __in ? string_op::memcspn(__p, __len, __s, __n)
+                            : string_op::memspn(__p, __len, __s, __n);
+    return __r < __len ? __r : size_t(-1);
+  }
+
+  AICUDA_HD static size_t _S_last(const char *__p, size_t __len,
+                                  const char *__s, size_t __n, bool __in)
+  {
+    const size_t __r = __in ? string_op::memrcspn(__p, __len, __s, __n)
+                            : string_op::memrspn(__p, __len, __s, __n);
+    return __r < __len ? __len - 1 - __r : size_t(-1);
+  }
+};
+
+} // namespace stl
+} // namespace aicuda
+
+#endif /* _AICUDA_STL_CHAR_TRAITS_H_ */
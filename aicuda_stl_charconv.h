@@ -0,0 +1,2048 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_CHARCONV_H_
+#define _AICUDA_STL_CHARCONV_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_type_traits.h>
+#include <assert.h>
+#include <stdio.h>
+
+namespace aicuda
+{
+namespace stl
+{
+
+// Error codes reported by to_chars; a default-constructed errc means success.
+enum class errc
+{
+  invalid_argument = 22,
+  result_out_of_range = 34,
+  value_too_large = 75
+};
+
+struct to_chars_result
+{
+  char *ptr;
+  errc ec;
+};
+
+// Number of digits of __value in __base, at least one.  Four digits are
+// settled per step, so values below __base^4 are counted with no division.
+template <typename _Up>
+AICUDA_HD inline unsigned __to_chars_len(_Up __value, unsigned __base)
+{
+  const unsigned __b2 = __base * __base;
+  const unsigned __b3 = __b2 * __base;
+  const unsigned __b4 = __b3 * __base;
+  unsigned __n = 1;
+  for (;;)
+  {
+    if (__value < __base)
+      return __n;
+    if (__value < __b2)
+      return __n + 1;
+    if (__value < __b3)
+      return __n + 2;
+    if (__value < __b4)
+      return __n + 3;
+    __value /= __b4;
+    __n += 4;
+  }
+}
+
+// "00" .. "99": one division by 100 yields two output digits.
+AICUDA_HD inline const char *__to_chars_digit_pairs()
+{
+  return "0001020304050607080910111213141516171819"
+         "2021222324252627282930313233343536373839"
+         "4041424344454647484950515253545556575859"
+         "6061626364656667686970717273747576777879"
+         "8081828384858687888990919293949596979899";
+}
+
+// Writes the __len decimal digits of __value backwards from __first + __len.
+AICUDA_HD inline void __to_chars_10_impl(char *__first, unsigned __len,
+                                         unsigned __value)
+{
+  const char *__pairs = __to_chars_digit_pairs();
+  unsigned __pos = __len - 1;
+  while (__value >= 100)
+  {
+    const unsigned __num = (__value % 100) * 2;
+    __value /= 100;
+    __first[__pos] = __pairs[__num + 1];
+    __first[__pos - 1] = __pairs[__num];
+    __pos -= 2;
+  }
+  if (__value >= 10)
+  {
+    const unsigned __num = __value * 2;
+    __first[1] = __pairs[__num + 1];
+    __first[0] = __pairs[__num];
+  }
+  else
+    __first[0] = char('0' + __value);
+}
+
+// 64-bit values lose eight digits per 64-bit division; each group of eight
+// and the remaining high part are then formatted in 32-bit arithmetic, which
+// is far cheaper on the device than a 64-bit division per digit.
+AICUDA_HD inline void __to_chars_10_impl(char *__first, unsigned __len,
+                                         unsigned long long __value)
+{
+  const char *__pairs = __to_chars_digit_pairs();
+  while (__value > 0xffffffffULL)
+  {
+    unsigned __low = unsigned(__value % 100000000);
+    __value /= 100000000;
+    __len -= 8;
+    for (int __i = 6; __i >= 0; __i -= 2)
+    {
+      const unsigned __num = (__low % 100) * 2;
+      __low /= 100;
+      __first[__len + __i] = __pairs[__num];
+      __first[__len + __i + 1] = __pairs[__num + 1];
+    }
+  }
+  __to_chars_10_impl(__first, __len, unsigned(__value));
+}
+
+template <typename _Up>
+AICUDA_HD inline void __to_chars_impl(char *__first, unsigned __len,
+                                      _Up __value, unsigned __base)
+{
+  const char *__chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+  unsigned __pos = __len;
+  do
+  {
+    __first[--__pos] = __chars[__value % __base];
+    __value /= __base;
+  } while (__value);
+}
+
+// Formats __value into [__first, __last) without allocating and without a
+// terminating NUL.  Returns the end of the written characters, or __last
+// and errc::value_too_large when the buffer is too short.  __base must be
+// in [2, 36]; digits above 9 are lowercase letters.
+template <typename _Tp>
+AICUDA_HD inline typename __enable_if<__is_integer<_Tp>::__value &&
+                                          !__is_boolean<_Tp>::__value,
+                                      to_chars_result>::__type
+to_chars(char *__first, char *__last, _Tp __value, int __base = 10)
+{
+  typedef typename __conditional_type<(sizeof(_Tp) > sizeof(unsigned)),
+                                      unsigned long long, unsigned>::__type
+      _Up;
+
+  if (__base < 2 || __base > 36)
+  {
+    printf("to_chars: invalid base %d\n", __base);
+    assert(1 < 0);
+  }
+
+  // Negation happens in the unsigned type, so the most negative value of
+  // every type is formatted correctly.
+  _Up __uval = _Up(__value);
+  if (!__is_unsigned_integer<_Tp>::__value &&
+      ((__uval >> (sizeof(_Tp) * 8 - 1)) & 1))
+  {
+    if (__first == __last)
+    {
+      to_chars_result __res = {__last, errc::value_too_large};
+      return __res;
+    }
+    *__first++ = '-';
+    __uval = _Up(0) - __uval;
+  }
+
+  // The decimal path passes a literal base so the divisions in
+  // __to_chars_len become multiplications.
+  const unsigned __len = __base == 10
+                             ? __to_chars_len(__uval, 10u)
+                             : __to_chars_len(__uval, unsigned(__base));
+  if (__last - __first < ptrdiff_t(__len))
+  {
+    to_chars_result __res = {__last, errc::value_too_large};
+    return __res;
+  }
+
+  if (__base == 10)
+    __to_chars_10_impl(__first, __len, __uval);
+  else
+    __to_chars_impl(__first, __len, __uval, unsigned(__base));
+
+  to_chars_result __res = {__first + __len, errc()};
+  return __res;
+}
+
+// Floating point.  Shortest output uses Schubfach (R. Giulietti, "The
+// Schubfach way to render doubles", 2020): one 126-bit power of ten from a
+// table and three 64x64->128 multiplications per value, no loop over
+// digits.  The digits it picks are the fewest that read back as the same
+// double, and the closest to it among those.
+//
+// Fixed output with a precision is exact: the fraction is expanded digit by
+// digit in a small big integer and rounded half to even, which is what
+// glibc's printf("%.*f") produces.
+
+enum class chars_format
+{
+  scientific = 1,
+  fixed = 2,
+  hex = 4,
+  general = fixed | scientific
+};
+
+AICUDA_HD inline unsigned long long __umul_hi(unsigned long long __a,
+                                              unsigned long long __b)
+{
+#if AICUDA_DEVICE_CODE
+  return __umul64hi(__a, __b);
+#else
+  return (unsigned long long)(((unsigned __int128)__a * __b) >> 64);
+#endif
+}
+
+// floor(__q log10(2)), floor(__q log10(2) + log10(3/4)) and
+// floor(__e log2(10)), exact over the exponent range of double.
+AICUDA_HD inline int __flog10_pow2(int __q)
+{
+  return int((long long)__q * 661971961083LL >> 41);
+}
+
+AICUDA_HD inline int __flog10_three_quarters_pow2(int __q)
+{
+  return int(((long long)__q * 661971961083LL - 274743187321LL) >> 41);
+}
+
+AICUDA_HD inline int __flog2_pow10(int __e)
+{
+  return int((long long)__e * 913124641741LL >> 38);
+}
+
+// For k in [-324, 343]: g = floor(10^-k 2^-r) + 1 with r chosen so that
+// 2^125 <= g < 2^126, stored as g1 2^63 + g0.  Formatting uses k up to
+// 292; parsing reaches down to 10^-343.
+AICUDA_HD inline void __schubfach_g(int __k, unsigned long long &__g1,
+                                    unsigned long long &__g0)
+{
+  static const unsigned long long __table[] = {
+      0x4F0CEDC95A718DD4ULL, 0x5B01E8B09AA0D1B5ULL,
+      0x7E7B160EF71C1621ULL, 0x119CA780F767B5EEULL,
+      0x652F44D8C5B011B4ULL, 0x0E16EC672C52F7F2ULL,
+      0x50F29D7A37C00E29ULL, 0x581256B8F0425FF5ULL,
+      0x40C21794F96671BAULL, 0x79A84560C0351991ULL,
+      0x679CF287F570B5F7ULL, 0x75DA089ACD21C281ULL,
+      0x52E3F5399126F7F9ULL, 0x44AE6D48A41B0201ULL,
+      0x424FF76140EBF994ULL, 0x36F1F106E9AF34CDULL,
+      0x6A198BCECE465C20ULL, 0x57E981A4A918547BULL,
+      0x54E13CA571D1E34DULL, 0x2CBACE1D541376C9ULL,
+      0x43E763B78E4182A4ULL, 0x23C8A4E44342C56EULL,
+      0x6CA56C58E39C043AULL, 0x060DD4A06B9E08B0ULL,
+      0x56EABD13E9499CFBULL, 0x1E7176E6BC7E6D59ULL,
+      0x458897432107B0C8ULL, 0x7EC12BEBC9FEBDE1ULL,
+      0x6F40F20501A5E7A7ULL, 0x7E01DFDFA9979635ULL,
+      0x5900C19D9AEB1FB9ULL, 0x4B34B319547944F7ULL,
+      0x4733CE17AF227FC7ULL, 0x55C3C27AA9FA9D93ULL,
+      0x71EC7CF2B1D0CC72ULL, 0x560603F7765DC8EAULL,
+      0x5B2397288E40A38EULL, 0x7804CFF92B7E3A55ULL,
+      0x48E945BA0B66E93FULL, 0x13370CC755FE9511ULL,
+      0x74A86F90123E41FEULL, 0x51F1AE0BBCCA881BULL,
+      0x5D538C7341CB67FEULL, 0x74C1580963D539AFULL,
+      0x4AA93D29016F8665ULL, 0x43CDE0078310FAF3ULL,
+      0x77752EA8024C0A3CULL, 0x0616333F381B2B1EULL,
+      0x5F90F22001D66E96ULL, 0x3811C298F9AF55B1ULL,
+      0x4C73F4E667DEBEDEULL, 0x600E35472E25DE28ULL,
+      0x7A532170A6313164ULL, 0x3349EED849D6303FULL,
+      0x61DC1AC084F42783ULL, 0x42A18BE03B11C033ULL,
+      0x4E49AF006A5CEC69ULL, 0x1BB46FE695A7CCF5ULL,
+      0x7D42B19A43C7E0A8ULL, 0x2C53E63DBC3FAE55ULL,
+      0x64355AE1CFD31A20ULL, 0x237651CAFCFFBEAAULL,
+      0x502AAF1B0CA8E1B3ULL, 0x35F8416F30CC9888ULL,
+      0x402225AF3D53E7C2ULL, 0x5E603458F3D6E06DULL,
+      0x669D0918621FD937ULL, 0x4A3386F4B957CD7BULL,
+      0x52173A79E8197A92ULL, 0x6E8F9F2A2DDFD796ULL,
+      0x41AC2EC7ECE12EDBULL, 0x720C7F54F17FDFABULL,
+      0x69137E0CAE3517C6ULL, 0x1CE0CBBB1BFFCC45ULL,
+      0x540F980A24F74638ULL, 0x171A3C95AFFFD69EULL,
+      0x433FACD4EA5F6B60ULL, 0x127B63AAF3331218ULL,
+      0x6B991487DD657899ULL, 0x6A5F05DE51EB5026ULL,
+      0x5614106CB11DFA14ULL, 0x5518D17EA7EF7352ULL,
+      0x44DCD9F08DB194DDULL, 0x2A7A41321FF2C2A8ULL,
+      0x6E2E2980E2B5BAFBULL, 0x5D906850331E043FULL,
+      0x5824EE00B55E2F2FULL, 0x647386A68F4B3699ULL,
+      0x4683F19A2AB1BF59ULL, 0x36C2D21ED908F87BULL,
+      0x70D31C29DDE93228ULL, 0x579E1CFE280E5A5DULL,
+      0x5A427CEE4B20F4EDULL, 0x2C7E7D98200B7B7EULL,
+      0x483530BEA280C3F1ULL, 0x09FECAE019A2C932ULL,
+      0x73884DFDD0CE064EULL, 0x43314499C29E0EB6ULL,
+      0x5C6D0B3173D8050BULL, 0x4F5A9D47CEE4D891ULL,
+      0x49F0D5C129799DA2ULL, 0x72AEE4397250AD41ULL,
+      0x764E22CEA8C295D1ULL, 0x377E39F583B44868ULL,
+      0x5EA4E8A553CEDE41ULL, 0x12CB61913629D387ULL,
+      0x4BB72084430BE500ULL, 0x756F8140F8217605ULL,
+      0x792500D39E796E67ULL, 0x6F18CECE59CF233CULL,
+      0x60EA670FB1FABEB9ULL, 0x3F470BD847D8E8FDULL,
+      0x4D885272F4C89894ULL, 0x329F3CAD064720CAULL,
+      0x7C0D50B7EE0DC0EDULL, 0x37652DE1A3A50143ULL,
+      0x633DDA2CBE716724ULL, 0x2C50F1814FB73436ULL,
+      0x4F64AE8A31F45283ULL, 0x3D0D8E010C92902BULL,
+      0x7F077DA9E986EA6BULL, 0x7B48E334E0EA8045ULL,
+      0x659F97BB2138BB89ULL, 0x49071C2A4D88669DULL,
+      0x514C796280FA2FA1ULL, 0x20D27CEEA46D1EE4ULL,
+      0x4109FAB533FB594DULL, 0x670ECA58838A7F1DULL,
+      0x680FF788532BC216ULL, 0x0B4ADD5A6C10CB62ULL,
+      0x533FF939DC2301ABULL, 0x22A24AAEBCDA3C4EULL,
+      0x4299942E49B59AEFULL, 0x354EA22563E1C9D8ULL,
+      0x6A8F537D42BC2B18ULL, 0x554A9D089FCFA95AULL,
+      0x553F75FDCEFCEF46ULL, 0x776EE406E63FBAAEULL,
+      0x4432C4CB0BFD8C38ULL, 0x5F8BE99F1E996225ULL,
+      0x6D1E07AB466279F4ULL, 0x327975CB64289D08ULL,
+      0x574B3955D1E86190ULL, 0x28612B091CED4A6DULL,
+      0x45D5C777DB204E0DULL, 0x06B4226DB0BDD524ULL,
+      0x6FBC72595E9A167BULL, 0x24536A491AC95506ULL,
+      0x59638EADE54811FCULL, 0x1D0F883A7BD44405ULL,
+      0x4782D88B1DD34196ULL, 0x4A72D361FCA9D004ULL,
+      0x726AF411C952028AULL, 0x43EAEBCFFAA94CD3ULL,
+      0x5B88C3416DDB353BULL, 0x4FEF230CC88770A9ULL,
+      0x493A35CDF17C2A96ULL, 0x0CBF4F3D6D3926EEULL,
+      0x7529EFAFE8C6AA89ULL, 0x61321862485B717CULL,
+      0x5DBB262653D22207ULL, 0x675B46B506AF8DFDULL,
+      0x4AFC1E850FDB4E6CULL, 0x52AF6BC405593E64ULL,
+      0x77F9CA6E7FC54A47ULL, 0x377F12D33BC1FD6DULL,
+      0x5FFB085866376E9FULL, 0x45FF42429634CABDULL,
+      0x4CC8D379EB5F8BB2ULL, 0x6B329B68782A3BCBULL,
+      0x7ADAEBF64565AC51ULL, 0x2B842BDA59DD2C77ULL,
+      0x6248BCC5045156A7ULL, 0x3C69BCAEAE4A89F9ULL,
+      0x4EA0970403744552ULL, 0x6387CA25583BA194ULL,
+      0x7DCDBE6CD253A21EULL, 0x05A6103BC05F68EDULL,
+      0x64A498570EA94E7EULL, 0x37B80CFC99E5ED8AULL,
+      0x5083AD1272210B98ULL, 0x2C933D96E184BE08ULL,
+      0x40695741F4E73C79ULL, 0x7075CADF1AD09807ULL,
+      0x670EF2032171FA5CULL, 0x4D8944982AE759A4ULL,
+      0x52725B35B45B2EB0ULL, 0x3E076A135585E150ULL,
+      0x41F515C49048F226ULL, 0x64D2BB42AAD1810DULL,
+      0x698822D41A0E503EULL, 0x07B7920444826815ULL,
+      0x546CE8A9AE71D9CBULL, 0x1FC60E69D0685344ULL,
+      0x438A53BAF1F4AE3CULL, 0x196B3EBB0D20429DULL,
+      0x6C1085F7E9877D2DULL, 0x0F11FDF815006A94ULL,
+      0x56739E5FEE05FDBDULL, 0x58DB319344005543ULL,
+      0x45294B7FF19E6497ULL, 0x60AF5ADC3666AA9CULL,
+      0x6EA878CCB5CA3A8CULL, 0x344BC4938A3DDDC7ULL,
+      0x5886C70A2B082ED6ULL, 0x5D096A0FA1CB17D2ULL,
+      0x46D238D4EF39BF12ULL, 0x173ABB3FB4A27975ULL,
+      0x71505AEE4B8F981DULL, 0x0B912B992103F588ULL,
+      0x5AA6AF25093FACE4ULL, 0x0940EFADB4032AD3ULL,
+      0x488558EA6DCC8A50ULL, 0x07672624900288A9ULL,
+      0x74088E43E2E0DD4CULL, 0x723EA36DB337410EULL,
+      0x5CD3A5031BE71770ULL, 0x5B654F8AF5C5CDA5ULL,
+      0x4A42EA68E31F45F3ULL, 0x62B772D5916B0AEBULL,
+      0x76D1770E38320986ULL, 0x0458B7BC1BDE77DDULL,
+      0x5F0DF8D82CF4D46BULL, 0x1D13C630164B9318ULL,
+      0x4C0B2D79BD90A9EFULL, 0x30DC9E8CDEA2DC13ULL,
+      0x79AB7BF5FC1AA97FULL, 0x0160FDAE31049351ULL,
+      0x6155FCC4C9AEEDFFULL, 0x1AB3FE24F403A90EULL,
+      0x4DDE63D0A158BE65ULL, 0x6229981D9002EDA5ULL,
+      0x7C97061A9BC130A2ULL, 0x69DC2695B337E2A1ULL,
+      0x63AC04E2163426E8ULL, 0x54B01EDE28F9821BULL,
+      0x4FBCD0B4DE901F20ULL, 0x43C018B1BA6134E2ULL,
+      0x7F9481216419CB67ULL, 0x1F99C11C5D68549DULL,
+      0x6610674DE9AE3C52ULL, 0x4C7B00E37DED107EULL,
+      0x51A6B90B21583042ULL, 0x09FC00B5FE574065ULL,
+      0x41522DA2811359CEULL, 0x3B3000919845CD1DULL,
+      0x68837C3734EBC2E3ULL, 0x784CCDB5C06FAE95ULL,
+      0x539C635F5D8968B6ULL, 0x2D0A3E2B00595877ULL,
+      0x42E382B2B13ABA2BULL, 0x3DA1CB5599E11393ULL,
+      0x6B059DEAB52AC378ULL, 0x629C7888F634EC1EULL,
+      0x559E17EEF755692DULL, 0x3549FA072B5D89B1ULL,
+      0x447E798BF91120F1ULL, 0x1107FB38EF7E07C1ULL,
+      0x6D9728DFF4E834B5ULL, 0x01A65EC17F300C68ULL,
+      0x57AC20B32A535D5DULL, 0x4E1EB23465C009EDULL,
+      0x46234D5C21DC4AB1ULL, 0x24E55B5D1E333B24ULL,
+      0x70387BC69C93AAB5ULL, 0x216EF894FD1EC506ULL,
+      0x59C6C96BB076222AULL, 0x4DF2607730E56A6CULL,
+      0x47D23ABC8D2B4E88ULL, 0x3E5B805F5A5121F0ULL,
+      0x72E9F79415121740ULL, 0x63C59A322A1B697FULL,
+      0x5BEE5FA9AA74DF67ULL, 0x03047B5B54E2BACCULL,
+      0x498B7FBAEEC3E5ECULL, 0x0269FC4910B5623DULL,
+      0x75ABFF917E063CACULL, 0x6A432D41B45569FBULL,
+      0x5E2332DACB38308AULL, 0x21CF5767C37787FCULL,
+      0x4B4F5BE23C2CF3A1ULL, 0x67D912B9692C6CCAULL,
+      0x787EF969F9E185CFULL, 0x595B5128A8471476ULL,
+      0x60659454C7E79E3FULL, 0x6115DA86ED05A9F8ULL,
+      0x4D1E1043D31FB1CCULL, 0x4DAB1538BD9E2193ULL,
+      0x7B634D3951CC4FADULL, 0x62AB552795C9CF52ULL,
+      0x62B5D7610E3D0C8BULL, 0x0222AA86116E3F75ULL,
+      0x4EF7DF80D830D6D5ULL, 0x4E822204DABE992AULL,
+      0x7E59659AF38157BCULL, 0x17369CD49130F510ULL,
+      0x65145148C2CDDFC9ULL, 0x5F5EE3DD40F3F740ULL,
+      0x50DD0DD3CF0B196EULL, 0x1918B64A9A5CC5CDULL,
+      0x40B0D7DCA5A27ABEULL, 0x4746F83BAEB09E3EULL,
+      0x678159610903F797ULL, 0x253E59F91780FD2FULL,
+      0x52CDE11A6D9CC612ULL, 0x50FEAE60DF9A6426ULL,
+      0x423E4DAEBE1704DBULL, 0x5A65584D7FAEB685ULL,
+      0x69FD4917968B3AF9ULL, 0x10A226E265E4573BULL,
+      0x54CAA0DFABA29594ULL, 0x0D4E8581EB1D1295ULL,
+      0x43D54D7FBC821143ULL, 0x243ED134BC174211ULL,
+      0x6C887BFF94034ED2ULL, 0x06CAE85460253682ULL,
+      0x56D396661002A574ULL, 0x6BD586A9E6842B9BULL,
+      0x457611EB40021DF7ULL, 0x09779EEE52035616ULL,
+      0x6F234FDECCD02FF1ULL, 0x5BF297E3B66BBCEFULL,
+      0x58E90CB23D73598EULL, 0x165BACB62B8963F3ULL,
+      0x4720D6F4FDF5E13EULL, 0x451623C4EFA11CC2ULL,
+      0x71CE24BB2FEFCECAULL, 0x3B569FA17F682E03ULL,
+      0x5B0B5095BFF30BD5ULL, 0x15DEE61ACC535803ULL,
+      0x48D5DA11665C0977ULL, 0x2B18B8157042ACCFULL,
+      0x74895CE8A3C6758BULL, 0x5E8DF355806AAE18ULL,
+      0x5D3AB0BA1C9EC46FULL, 0x653E5C4466BBBE7AULL,
+      0x4A955A2E7D4BD059ULL, 0x3765169D1EFC9861ULL,
+      0x77555D172EDFB3C2ULL, 0x256E8A94FE60F3CFULL,
+      0x5F777DAC257FC301ULL, 0x6ABED543FEB3F63FULL,
+      0x4C5F97BCEACC9C01ULL, 0x3BCBDDCFFEF65E99ULL,
+      0x7A328C6177ADC668ULL, 0x5FAC961997F0975BULL,
+      0x61C209E792F16B86ULL, 0x7FBD44E1465A12AFULL,
+      0x4E34D4B9425ABC6BULL, 0x7FCA9D810514DBBFULL,
+      0x7D21545B9D5DFA46ULL, 0x32DDC8CE6E87C5FFULL,
+      0x641AA9E2E44B2E9EULL, 0x5BE4A0A525396B32ULL,
+      0x501554B5836F587EULL, 0x7CB6E6EA842DEF5CULL,
+      0x4011109135F2AD32ULL, 0x30925255368B25E3ULL,
+      0x6681B41B89844850ULL, 0x4DB6EA21F0DEA304ULL,
+      0x52015CE2D469D373ULL, 0x57C5881B2718826AULL,
+      0x419AB0B576BB0F8FULL, 0x5FD139AF527A01EFULL,
+      0x68F781225791B27FULL, 0x4C81F5E550C3364AULL,
+      0x53F9341B79415B99ULL, 0x239B2B1DDA35C508ULL,
+      0x432DC3492DCDE2E1ULL, 0x02E288E4AE916A6DULL,
+      0x6B7C6BA849496B01ULL, 0x516A74A1174F10AEULL,
+      0x55FD22ED076DEF34ULL, 0x4121F6E745D8DA25ULL,
+      0x44CA82573924BF5DULL, 0x1A8192529E4714EBULL,
+      0x6E10D08B8EA1322EULL, 0x5D9C1D50FD3E87DDULL,
+      0x580D73A2D880F4F2ULL, 0x17B01773FDCB9FE4ULL,
+      0x4671294F139A5D8EULL, 0x4626792997D61984ULL,
+      0x70B50EE4EC2A2F4AULL, 0x3D0A5B75BFBCF59FULL,
+      0x5A2A7250BCEE8C3BULL, 0x4A6EAF916630C47FULL,
+      0x4821F50D63F209C9ULL, 0x21F2260DEB5A36CCULL,
+      0x736988156CB6760EULL, 0x69837016455D247AULL,
+      0x5C546CDDF091F80BULL, 0x6E02C011D1175062ULL,
+      0x49DD23E4C074C66FULL, 0x719BCCDB0DAC404EULL,
+      0x762E9FD467213D7FULL, 0x68F947C4E2AD33B0ULL,
+      0x5E8BB3105280FDFFULL, 0x6D94396A4EF0F627ULL,
+      0x4BA2F5A6A8673199ULL, 0x3E102DEEA58D91B9ULL,
+      0x7904BC3DDA3EB5C2ULL, 0x3019E3176F48E927ULL,
+      0x60D09697E1CBC49BULL, 0x4014B5AC590720ECULL,
+      0x4D73ABACB4A303AFULL, 0x4CDD5E237A6C1A57ULL,
+      0x7BEC45E12104D2B2ULL, 0x47C8969F2A46908AULL,
+      0x63236B1A80D0A88EULL, 0x6CA0787F5505406FULL,
+      0x4F4F88E200A6ED3FULL, 0x0A19F9FF773766BFULL,
+      0x7EE5A7D0010B1531ULL, 0x5CF65CCBF1F23DFEULL,
+      0x6584864000D5AA8EULL, 0x172B7D6FF4C1CB32ULL,
+      0x5136D1CCCD77BBA4ULL, 0x78EF978CC3CE3C28ULL,
+      0x40F8A7D70AC62FB7ULL, 0x13F2DFA3CFD83020ULL,
+      0x67F43FBE77A37F8BULL, 0x398499061959E699ULL,
+      0x5329CC985FB5FFA2ULL, 0x6136E0D1ADE18548ULL,
+      0x4287D6E04C91994FULL, 0x00F8B3DAF181376DULL,
+      0x6A72F166E0E8F54BULL, 0x1B27862B1C01F247ULL,
+      0x5528C11F1A53F76FULL, 0x2F52D1BC1667F506ULL,
+      0x44209A7F48432C59ULL, 0x0C424163451FF738ULL,
+      0x6D00F7320D3846F4ULL, 0x7A039BD208332526ULL,
+      0x5733F8F4D76038C3ULL, 0x7B361641A028EA85ULL,
+      0x45C32D90AC4CFA36ULL, 0x2F5E78348020BB9EULL,
+      0x6F9EAF4DE07B29F0ULL, 0x4BCA59ED99CDF8FCULL,
+      0x594BBF71806287F3ULL, 0x563B7B247B0B2D96ULL,
+      0x476FCC5ACD1B9FF6ULL, 0x11C92F50626F57ACULL,
+      0x724C7A2AE1C5CCBDULL, 0x02DB7EE703E55912ULL,
+      0x5B7061BBE7D17097ULL, 0x1BE2CBEC031DE0DCULL,
+      0x4926B496530DF3ACULL, 0x164F09899C17E716ULL,
+      0x750ABA8A1E7CB913ULL, 0x3D4B4275C68CA4F0ULL,
+      0x5DA22ED4E530940FULL, 0x4AA29B916BA3B726ULL,
+      0x4AE825771DC07672ULL, 0x6EE87C74561C9285ULL,
+      0x77D9D58B62CD8A51ULL, 0x3173FA53BCFA8408ULL,
+      0x5FE177A2B5713B74ULL, 0x278FFB7630C869A0ULL,
+      0x4CB45FB55DF42F90ULL, 0x1FA662C4F3D387B3ULL,
+      0x7ABA32BBC986B280ULL, 0x32A3D13B1FB8D91FULL,
+      0x622E8EFCA1388ECDULL, 0x0EE9742F4C93E0E6ULL,
+      0x4E8BA596E760723DULL, 0x58BAC3590A0FE71EULL,
+      0x7DAC3C24A5671D2FULL, 0x412AD228101971C9ULL,
+      0x6489C9B6EAB8E426ULL, 0x00EF0E8673478E3BULL,
+      0x506E3AF8BBC71CEBULL, 0x1A58D86B8F6C71C9ULL,
+      0x40582F2D6305B0BCULL, 0x1513E0560C56C16EULL,
+      0x66F37EAF04D5E793ULL, 0x3B530089AD579BE2ULL,
+      0x525C6558D0AB1FA9ULL, 0x15DC006E2446164FULL,
+      0x41E384470D55B2EDULL, 0x5E4999F1B69E783FULL,
+      0x696C06D81555EB15ULL, 0x7D428FE92430C065ULL,
+      0x54566BE0111188DEULL, 0x31020CBA835A3384ULL,
+      0x4378564CDA746D7EULL, 0x5A680A2ECF7B5C69ULL,
+      0x6BF3BD47C3ED7BFDULL, 0x770CDD17B25EFA42ULL,
+      0x565C976C9CBDFCCBULL, 0x1270B0DFC1E59502ULL,
+      0x4516DF8A16FE63D5ULL, 0x5B8D5A4C9B1E10CEULL,
+      0x6E8AFF4357FD6C89ULL, 0x127BC3ADC4FCE7B0ULL,
+      0x586F329C466456D4ULL, 0x0EC96957D0CA52F3ULL,
+      0x46BF5BB038504576ULL, 0x3F07877973D50F29ULL,
+      0x71322C4D26E6D58AULL, 0x31A5A58F1FBB4B75ULL,
+      0x5A8E89D75252446EULL, 0x5AEAEAD8E62F6F91ULL,
+      0x487207DF750E9D25ULL, 0x2F22557A51BF8C74ULL,
+      0x73E9A63254E42EA2ULL, 0x1836EF2A1C65AD86ULL,
+      0x5CBAEB5B771CF21BULL, 0x2CF8BF54E3848AD2ULL,
+      0x4A2F22AF927D8E7CULL, 0x23FA32AA4F9D3BDBULL,
+      0x76B1D118EA627D93ULL, 0x5329EAAA18FB92F8ULL,
+      0x5EF4A74721E86476ULL, 0x0F54BBBB472FA8C6ULL,
+      0x4BF6EC38E7ED1D2BULL, 0x25DD62FC38F2ED6CULL,
+      0x798B138E3FE1C845ULL, 0x22FBD1938E517BDFULL,
+      0x613C0FA4FFE7D36AULL, 0x4F2FDADC71DAC97FULL,
+      0x4DC9A61D998642BBULL, 0x58F3157D27E23ACCULL,
+      0x7C75D695C2706AC5ULL, 0x74B82261D969F7ADULL,
+      0x63917877CEC0556BULL, 0x10934EB4ADEE5FBEULL,
+      0x4FA793930BCD1122ULL, 0x4075D8908B251965ULL,
+      0x7F7285B812E1B504ULL, 0x00BC8DB411D4F56EULL,
+      0x65F537C675815D9CULL, 0x66FD3E29A7DD9125ULL,
+      0x5190F96B91344AE3ULL, 0x6BFDCB54864ADA84ULL,
+      0x4140C78940F6A24FULL, 0x6FFE3C439EA2486AULL,
+      0x6867A5A867F103B2ULL, 0x7FFD2D38FDD073DCULL,
+      0x53861E2053273628ULL, 0x6664242D97D9F64AULL,
+      0x42D1B1B375B8F820ULL, 0x51E9B68ADFE191D5ULL,
+      0x6AE91C5255F4C034ULL, 0x1CA924116635B621ULL,
+      0x558749DB77F70029ULL, 0x63BA83411E915E81ULL,
+      0x446C3B15F9926687ULL, 0x6962029A7EDAB201ULL,
+      0x6D79F82328EA3DA6ULL, 0x0F03375D97C45001ULL,
+      0x5794C6828721CAEBULL, 0x259C2C4ADFD04001ULL,
+      0x46109ECED2816F22ULL, 0x5149BD08B30D0001ULL,
+      0x701A97B150CF1837ULL, 0x3542C80DEB480001ULL,
+      0x59AEDFC10D7279C5ULL, 0x7768A00B22A00001ULL,
+      0x47BF19673DF52E37ULL, 0x79208008E8800001ULL,
+      0x72CB5BD86321E38CULL, 0x5B67334174000001ULL,
+      0x5BD5E313828182D6ULL, 0x7C528F6790000001ULL,
+      0x4977E8DC68679BDFULL, 0x16A872B940000001ULL,
+      0x758CA7C70D7292FEULL, 0x5773EAC200000001ULL,
+      0x5E0A1FD271287598ULL, 0x45F6556800000001ULL,
+      0x4B3B4CA85A86C47AULL, 0x04C5112000000001ULL,
+      0x785EE10D5DA46D90ULL, 0x07A1B50000000001ULL,
+      0x604BE73DE4838AD9ULL, 0x52E7C40000000001ULL,
+      0x4D0985CB1D3608AEULL, 0x0F1FD00000000001ULL,
+      0x7B426FAB61F00DE3ULL, 0x31CC800000000001ULL,
+      0x629B8C891B267182ULL, 0x5B0A000000000001ULL,
+      0x4EE2D6D415B85ACEULL, 0x7C08000000000001ULL,
+      0x7E37BE2022C0914BULL, 0x1340000000000001ULL,
+      0x64F964E68233A76FULL, 0x2900000000000001ULL,
+      0x50C783EB9B5C85F2ULL, 0x5400000000000001ULL,
+      0x409F9CBC7C4A04C2ULL, 0x1000000000000001ULL,
+      0x6765C793FA10079DULL, 0x0000000000000001ULL,
+      0x52B7D2DCC80CD2E4ULL, 0x0000000000000001ULL,
+      0x422CA8B0A00A4250ULL, 0x0000000000000001ULL,
+      0x69E10DE76676D080ULL, 0x0000000000000001ULL,
+      0x54B40B1F852BDA00ULL, 0x0000000000000001ULL,
+      0x43C33C1937564800ULL, 0x0000000000000001ULL,
+      0x6C6B935B8BBD4000ULL, 0x0000000000000001ULL,
+      0x56BC75E2D6310000ULL, 0x0000000000000001ULL,
+      0x4563918244F40000ULL, 0x0000000000000001ULL,
+      0x6F05B59D3B200000ULL, 0x0000000000000001ULL,
+      0x58D15E1762800000ULL, 0x0000000000000001ULL,
+      0x470DE4DF82000000ULL, 0x0000000000000001ULL,
+      0x71AFD498D0000000ULL, 0x0000000000000001ULL,
+      0x5AF3107A40000000ULL, 0x0000000000000001ULL,
+      0x48C2739500000000ULL, 0x0000000000000001ULL,
+      0x746A528800000000ULL, 0x0000000000000001ULL,
+      0x5D21DBA000000000ULL, 0x0000000000000001ULL,
+      0x4A817C8000000000ULL, 0x0000000000000001ULL,
+      0x7735940000000000ULL, 0x0000000000000001ULL,
+      0x5F5E100000000000ULL, 0x0000000000000001ULL,
+      0x4C4B400000000000ULL, 0x0000000000000001ULL,
+      0x7A12000000000000ULL, 0x0000000000000001ULL,
+      0x61A8000000000000ULL, 0x0000000000000001ULL,
+      0x4E20000000000000ULL, 0x0000000000000001ULL,
+      0x7D00000000000000ULL, 0x0000000000000001ULL,
+      0x6400000000000000ULL, 0x0000000000000001ULL,
+      0x5000000000000000ULL, 0x0000000000000001ULL,
+      0x4000000000000000ULL, 0x0000000000000001ULL,
+      0x6666666666666666ULL, 0x3333333333333334ULL,
+      0x51EB851EB851EB85ULL, 0x0F5C28F5C28F5C29ULL,
+      0x4189374BC6A7EF9DULL, 0x5916872B020C49BBULL,
+      0x68DB8BAC710CB295ULL, 0x74F0D844D013A92BULL,
+      0x53E2D6238DA3C211ULL, 0x43F3E0370CDC8755ULL,
+      0x431BDE82D7B634DAULL, 0x698FE69270B06C44ULL,
+      0x6B5FCA6AF2BD215EULL, 0x0F4CA41D811A46D4ULL,
+      0x55E63B88C230E77EULL, 0x3F70834ACDAE9F10ULL,
+      0x44B82FA09B5A52CBULL, 0x4C5A02A23E254C0DULL,
+      0x6DF37F675EF6EADFULL, 0x2D5CD10396A21347ULL,
+      0x57F5FF85E592557FULL, 0x3DE3DA69454E75D3ULL,
+      0x465E6604B7A84465ULL, 0x7E4FE1EDD10B9175ULL,
+      0x709709A125DA0709ULL, 0x4A19697C81AC1BEFULL,
+      0x5A126E1A84AE6C07ULL, 0x54E1213067BCE326ULL,
+      0x480EBE7B9D58566CULL, 0x43E74DC052FD8285ULL,
+      0x734ACA5F6226F0ADULL, 0x530BAF9A1E626A6DULL,
+      0x5C3BD5191B525A24ULL, 0x426FBFAE7EB521F1ULL,
+      0x49C97747490EAE83ULL, 0x4EBFCC8B9890E7F4ULL,
+      0x760F253EDB4AB0D2ULL, 0x4ACC7A78F41B0CBAULL,
+      0x5E72843249088D75ULL, 0x223D2EC729AF3D62ULL,
+      0x4B8ED0283A6D3DF7ULL, 0x34FDBF05BAF29781ULL,
+      0x78E480405D7B9658ULL, 0x54C931A2C4B758CFULL,
+      0x60B6CD004AC94513ULL, 0x5D6DC14F03C5E0A5ULL,
+      0x4D5F0A66A23A9DA9ULL, 0x31249AA59C9E4D51ULL,
+      0x7BCB43D769F762A8ULL, 0x4EA0F76F60FD4882ULL,
+      0x63090312BB2C4EEDULL, 0x254D92BF80CAA068ULL,
+      0x4F3A68DBC8F03F24ULL, 0x1DD7A89933D54D20ULL,
+      0x7EC3DAF941806506ULL, 0x62F2A75B86221500ULL,
+      0x65697BFA9ACD1D9FULL, 0x025BB91604E810CDULL,
+      0x51212FFBAF0A7E18ULL, 0x684960DE6A5340A4ULL,
+      0x40E7599625A1FE7AULL, 0x203AB3E521DC33B6ULL,
+      0x67D88F56A29CCA5DULL, 0x19F7863B696052BDULL,
+      0x5313A5DEE87D6EB0ULL, 0x7B2C6B62BAB37564ULL,
+      0x42761E4BED31255AULL, 0x2F56BC4EFBC2C450ULL,
+      0x6A5696DFE1E83BC3ULL, 0x655793B192D13A1AULL,
+      0x5512124CB4B9C969ULL, 0x377942F475742E7BULL,
+      0x440E750A2A2E3ABAULL, 0x5F9435905DF68B96ULL,
+      0x6CE3EE76A9E3912AULL, 0x65B9EF4D63241289ULL,
+      0x571CBEC554B60DBBULL, 0x6AFB25D782834207ULL,
+      0x45B0989DDD5E7163ULL, 0x08C8EB12CECF6806ULL,
+      0x6F80F42FC8971BD1ULL, 0x5ADB11B7B14BD9A3ULL,
+      0x5933F68CA078E30EULL, 0x157C0E2C8DD647B5ULL,
+      0x475CC53D4D2D8271ULL, 0x5DFCD823A4AB6C91ULL,
+      0x722E086215159D82ULL, 0x632E269F6DDF141BULL,
+      0x5B5806B4DDAAE468ULL, 0x4F581EE5F17F4349ULL,
+      0x49133890B1558386ULL, 0x72ACE584C1329C3BULL,
+      0x74EB8DB44EEF38D7ULL, 0x6AAE3C079B842D2AULL,
+      0x5D893E29D8BF60ACULL, 0x5558300616035755ULL,
+      0x4AD431BB13CC4D56ULL, 0x7779C004DE6912ABULL,
+      0x77B9E92B52E07BBEULL, 0x258F99A163DB5111ULL,
+      0x5FC7EDBC424D2FCBULL, 0x37A614811CAF740DULL,
+      0x4C9FF163683DBFD5ULL, 0x7951AA00E3BF900BULL,
+      0x7A998238A6C932EFULL, 0x754F7667D2CC19ABULL,
+      0x6214682D523A8F26ULL, 0x2AA5F8530F09AE22ULL,
+      0x4E76B9BDDB620C1EULL, 0x55519375A5A1581BULL,
+      0x7D8AC2C95F034697ULL, 0x3BB5B8BC3C3559C5ULL,
+      0x646F023AB2690545ULL, 0x7C9160969691149EULL,
+      0x5058CE955B87376BULL, 0x16DAB3ABABA743B2ULL,
+      0x40470BAAAF9F5F88ULL, 0x78AEF622EFB902F5ULL,
+      0x66D812AAB29898DBULL, 0x0DE4BD04B2C19E54ULL,
+      0x524675555BAD4715ULL, 0x57EA30D08F014B76ULL,
+      0x41D1F7777C8A9F44ULL, 0x4654F3DA0C01092CULL,
+      0x694FF258C7443207ULL, 0x23BB1FC346680EACULL,
+      0x543FF513D29CF4D2ULL, 0x4FC8E635D1ECD88AULL,
+      0x43665DA9754A5D75ULL, 0x263A51C4A7F0AD3BULL,
+      0x6BD6FC425543C8BBULL, 0x56C3B607731AAEC4ULL,
+      0x5645969B77696D62ULL, 0x789C919F8F488BD0ULL,
+      0x4504787C5F878AB5ULL, 0x46E3A7B2D906D640ULL,
+      0x6E6D8D93CC0C1122ULL, 0x3E390C515B3E239AULL,
+      0x5857A4763CD6741BULL, 0x4B60D6A77C31B615ULL,
+      0x46AC8391CA4529AFULL, 0x55E7121F968E2B44ULL,
+      0x711405B6106EA919ULL, 0x0971B698F0E3786DULL,
+      0x5A766AF80D255414ULL, 0x078E2BAD8D82C6BDULL,
+      0x485EBBF9A41DDCDCULL, 0x6C71BC8AD79BD231ULL,
+      0x73CAC65C39C96161ULL, 0x2D82C7448C2C8382ULL,
+      0x5CA23849C7D44DE7ULL, 0x3E023903A356CF9BULL,
+      0x4A1B603B06437185ULL, 0x7E682D9C82ABD949ULL,
+      0x76923391A39F1C09ULL, 0x4A4048FA6AAC8EDBULL,
+      0x5EDB5C7482E5B007ULL, 0x55003A61EEF07249ULL,
+      0x4BE2B05D35848CD2ULL, 0x773361E7F259F507ULL,
+      0x796AB3C855A0E151ULL, 0x3EB89CA6508FEE71ULL,
+      0x6122296D114D810DULL, 0x7EFA16EB73A6585BULL,
+      0x4DB4EDF0DAA4673EULL, 0x3261ABEF8FB846AFULL,
+      0x7C54AFE7C43A3ECAULL, 0x1D691318E5F3A44BULL,
+      0x6376F31FD02E98A1ULL, 0x64540F471E5C836FULL,
+      0x4F925C1973587A1BULL, 0x0376729F4B7D35F3ULL,
+      0x7F50935BEBC0C35EULL, 0x38BD84321261EFEBULL,
+      0x65DA0F7CBC9A35E5ULL, 0x13CAD0280EB4BFEFULL,
+      0x517B3F96FD482B1DULL, 0x5CA240200BC3CCBFULL,
+      0x412F66126439BC17ULL, 0x63B50019A3030A33ULL,
+      0x684BD683D38F9359ULL, 0x1F88002904D1A9EAULL,
+      0x536FDECFDC72DC47ULL, 0x32D3335403DAEE55ULL,
+      0x42BFE57316C249D2ULL, 0x5BDC291003158B77ULL,
+      0x6ACCA251BE03A951ULL, 0x12F9DB4CD1BC1258ULL,
+      0x557081DAFE695440ULL, 0x7594AF70A7C9A847ULL,
+      0x445A017BFEBAA9CDULL, 0x4476F2C0863AED06ULL,
+      0x6D5CCF2CCAC442E2ULL, 0x3A57EACDA3917B3CULL,
+      0x577D728A3BD03581ULL, 0x7B7988A482DAC8FDULL,
+      0x45FDF53B630CF79BULL, 0x15FAD3B6CF156D97ULL,
+      0x6FFCBB923814BF5EULL, 0x565E1F8AE4EF15BEULL,
+      0x5996FC74F9AA32B2ULL, 0x11E4E608B725AAFFULL,
+      0x47ABFD2A6154F55BULL, 0x27EA51A0928488CCULL,
+      0x72ACC843CEEE555EULL, 0x7310829A84074146ULL,
+      0x5BBD6D030BF1DDE5ULL, 0x42739BAED005CDD2ULL,
+      0x49645735A327E4B7ULL, 0x4EC2E2F24004A4A8ULL,
+      0x756D5855D1D96DF2ULL, 0x4AD16B1D333AA10CULL,
+      0x5DF11377DB1457F5ULL, 0x2241227DC2954DA3ULL,
+      0x4B2742C648DD132AULL, 0x4E9A81FE35443E1CULL,
+      0x783ED13D4161B844ULL, 0x175D9CC9EED39694ULL,
+      0x603240FDCDE7C69CULL, 0x7917B0A18BDC7876ULL,
+      0x4CF500CB0B1FD217ULL, 0x1412F3B46FE39392ULL,
+      0x7B219ADE7832E9BEULL, 0x535185ED7FD285B6ULL,
+      0x628148B1F9C25498ULL, 0x42A79E57997537C5ULL,
+      0x4ECDD3C1949B76E0ULL, 0x3552E512E12A9304ULL,
+      0x7E161F9C20F8BE33ULL, 0x6EEB081E3510EB39ULL,
+      0x64DE7FB01A609829ULL, 0x3F226CE4F740BC2EULL,
+      0x50B1FFC0151A1354ULL, 0x3281F0B72C33C9BEULL,
+      0x408E66334414DC43ULL, 0x42018D5F568FD498ULL,
+      0x674A3D1ED354939FULL, 0x1CCF48988A7FBA8DULL,
+      0x52A1CA7F0F76DC7FULL, 0x30A5D3AD3B99620BULL,
+      0x421B0865A5F8B065ULL, 0x73B7DC8A96144E6FULL,
+      0x69C4DA3C3CC11A3CULL, 0x52BFC7442353B0B1ULL,
+      0x549D7B6363CDAE96ULL, 0x756639034F7626F4ULL,
+      0x43B12F82B63E2545ULL, 0x4451C735D92B525DULL,
+      0x6C4EB26ABD303BA2ULL, 0x3A1C71EFC1DEEA2EULL,
+      0x56A55B889759C94EULL, 0x61B05B2634B254F2ULL,
+      0x45511606DF7B0772ULL, 0x1AF37C1E908EAA5BULL,
+      0x6EE8233E325E7250ULL, 0x2B1F2CFDB41776F8ULL,
+      0x58B9B5CB5B7EC1D9ULL, 0x6F4C23FE29AC5F2DULL,
+      0x46FAF7D5E2CBCE47ULL, 0x72A34FFE87BD18F1ULL,
+      0x71918C896ADFB073ULL, 0x04387FFDA5FB5B1BULL,
+      0x5ADAD6D4557FC05CULL, 0x0360666484C915AFULL,
+      0x48AF1243779966B0ULL, 0x02B3851D3707448CULL,
+      0x744B506BF28F0AB3ULL, 0x1DEC082EBE720746ULL,
+      0x5D090D2328726EF5ULL, 0x64BCD358985B3905ULL,
+      0x4A6DA41C205B8BF7ULL, 0x6A30A913AD15C738ULL,
+      0x7715D36033C5ACBFULL, 0x5D1AA81F7B560B8CULL,
+      0x5F44A919C3048A32ULL, 0x7DAEECE5FC44D609ULL,
+      0x4C36EDAE359D3B5BULL, 0x7E258A51969D7808ULL,
+      0x79F17C49EF61F893ULL, 0x16A276E8F0FBF33FULL,
+      0x618DFD07F2B4C6DCULL, 0x121B9253F3FCC299ULL,
+      0x4E0B30D328909F16ULL, 0x41AFA84329970214ULL,
+      0x7CDEB4850DB431BDULL, 0x4F7F739EA8F19CEDULL,
+      0x63E55D373E29C164ULL, 0x3F99294BBA5AE3F1ULL,
+      0x4FEAB0F8FE87CDE9ULL, 0x7FADBAA2FB7BE98DULL,
+      0x7FDDE7F4CA72E30FULL, 0x7F7C5DD1925FDC15ULL,
+      0x664B1FF7085BE8D9ULL, 0x4C637E4141E649ABULL,
+      0x51D5B32C06AFED7AULL, 0x704F983434B83AEFULL,
+      0x4177C2899EF32462ULL, 0x26A6135CF6F9C8BFULL,
+      0x68BF9DA8FE51D3D0ULL, 0x3DD685618B294132ULL,
+      0x53CC7E20CB74A973ULL, 0x4B12044E08EDCDC2ULL,
+      0x4309FE80A2C3BAC2ULL, 0x6F419D0B3A57D7CEULL,
+      0x6B4330CDD1392AD1ULL, 0x320294DEC3BFBFB0ULL,
+      0x55CF5A3E40FA88A7ULL, 0x419BAA4BCFCC995AULL,
+      0x44A5E1CB672ED3B9ULL, 0x1AE2EEA30CA3ADE1ULL,
+      0x6DD636123EB152C1ULL, 0x77D17DD1ADD2AFCFULL,
+      0x57DE91A832277567ULL, 0x797464A7BE42263FULL,
+      0x464BA7B9C1B92AB9ULL, 0x4790508631CE84FFULL,
+      0x70790C5C6928445CULL, 0x0C1A1A704FB0D4CCULL,
+      0x59FA7049EDB9D049ULL, 0x567B4859D95A43D6ULL,
+      0x47FB8D07F161736EULL, 0x11FC39E17AAE9CABULL,
+      0x732C14D98235857DULL, 0x032D2968C44A9445ULL,
+      0x5C2343E134F79DFDULL, 0x4F575453D03BA9D1ULL,
+      0x49B5CFE75D92E4CAULL, 0x72AC4376402FBB0EULL,
+      0x75EFB30BC8EB07ABULL, 0x0446D256CD192B49ULL,
+      0x5E595C096D88D2EFULL, 0x1D0575123DADBC3AULL,
+      0x4B7AB0078AD3DBF2ULL, 0x4A6AC40E97BE302FULL,
+      0x78C44CD8DE1FC650ULL, 0x771139B0F2C9E6B1ULL,
+      0x609D0A4718196B73ULL, 0x78DA948D8F07EBC1ULL,
+      0x4D4A6E9F467ABC5CULL, 0x60AEDD3E0C065634ULL,
+      0x7BAA4A9870C46094ULL, 0x344AFB9679A3BD20ULL,
+      0x62EEA2138D69E6DDULL, 0x103BFC78614FCA80ULL,
+      0x4F254E760ABB1F17ULL, 0x26966393810CA200ULL,
+      0x7EA21723445E9825ULL, 0x2423D2859B476999ULL,
+      0x654E78E9037EE01DULL, 0x69B642047C392148ULL,
+      0x510B93ED9C658017ULL, 0x6E2B680396941AA0ULL,
+      0x40D60FF149EACCDFULL, 0x71BC53361210154DULL,
+      0x67BCE64EDCAAE166ULL, 0x1C6085235019BBAEULL,
+      0x52FD850BE3BBE784ULL, 0x7D1A041C40149625ULL,
+      0x42646A6FE9631F9DULL, 0x4A7B367D0010781DULL,
+      0x6A3A43E642383295ULL, 0x5D91F0C8001A59C8ULL,
+      0x54FB698501C68EDEULL, 0x17A7F3D3334847D4ULL,
+      0x43FC546A67D20BE4ULL, 0x79532975C2A03976ULL,
+      0x6CC6ED770C83463BULL, 0x0EEB75893766C256ULL,
+      0x57058AC5A39C382FULL, 0x25892AD42C523512ULL,
+      0x459E089E1C7CF9BFULL, 0x37A0EF102374F742ULL,
+      0x6F6340FCFA618F98ULL, 0x59017E8038BB2536ULL,
+      0x591C33FD951AD946ULL, 0x7A67986693C8EA91ULL,
+      0x4749C33144157A9FULL, 0x151FAD1EDCA0BBA8ULL,
+      0x720F9EB539BBF765ULL, 0x0832AE97C76792A5ULL,
+      0x5B3FB22A94965F84ULL, 0x068EF21305EC7551ULL,
+      0x48FFC1BBAA11E603ULL, 0x1ED8C1A8D189F774ULL,
+      0x74CC692C434FD66BULL, 0x4AF4690E1C0FF253ULL,
+      0x5D705423690CAB89ULL, 0x225D20D816732843ULL,
+      0x4AC0434F873D5607ULL, 0x35174D79AB8F5369ULL,
+      0x779A054C0B955672ULL, 0x21BEE25C45B21F0EULL,
+      0x5FAE6AA33C77785BULL, 0x3498B5169E2818D8ULL,
+      0x4C8B888296C5F9E2ULL, 0x5D46F7454B534713ULL,
+      0x7A78DA6A8AD65C9DULL, 0x7BA4BED545520B52ULL,
+      0x61FA48553BDEB07EULL, 0x2FB6FF110441A2A8ULL,
+      0x4E61D37763188D31ULL, 0x72F8CC0D9D014EEDULL,
+      0x7D6952589E8DAEB6ULL, 0x1E5AE015C80217E1ULL,
+      0x645441E07ED7BEF8ULL, 0x1848B344A001ACB4ULL,
+      0x504367E6CBDFCBF9ULL, 0x603A2903B3348A2AULL,
+      0x4035ECB8A3196FFBULL, 0x002E873628F6D4EEULL,
+      0x66BCADF43828B32BULL, 0x19E40B89DB2487E3ULL,
+      0x52308B29C686F5BCULL, 0x14B66FA17C1D3983ULL,
+      0x41C06F549ED25E30ULL, 0x1091F2E7967DC79CULL,
+      0x6933E554315096B3ULL, 0x341CB7D8F0C93F5FULL,
+      0x542984435AA6DEF5ULL, 0x767D5FE0C0A0FF80ULL,
+      0x435469CF7BB8B25EULL, 0x2B977FE70080CC66ULL,
+      0x6BBA42E592C11D63ULL, 0x5F58CCA4CD9AE0A3ULL,
+      0x562E9BEADBCDB11CULL, 0x4C470A1D7148B3B6ULL,
+      0x44F216557CA48DB0ULL, 0x3D05A1B1276D5C92ULL,
+      0x6E5023BBFAA0E2B3ULL, 0x7B3C35E83F1560E9ULL,
+      0x58401C96621A4EF6ULL, 0x2F635E5365AAB3EDULL,
+      0x4699B0784E7B725EULL, 0x591C4B75EAEEF658ULL,
+      0x70F5E726E3F8B6FDULL, 0x74FA125644B18A26ULL,
+      0x5A5E5285832D5F31ULL, 0x43FB41DE9D5AD4EBULL,
+      0x484B75379C244C27ULL, 0x4FFC34B2177BDD89ULL,
+      0x73ABEEBF603A1372ULL, 0x4CC6BAB68BF96274ULL,
+      0x5C898BCC4CFB42C2ULL, 0x0A38955ED6611B90ULL,
+      0x4A07A309D72F689BULL, 0x21C6DDE5784DAFA7ULL,
+      0x76729E762518A75EULL, 0x693E2FD58D49190BULL,
+      0x5EC2185E8413B918ULL, 0x5431BFDE0AA0E0D5ULL,
+      0x4BCE79E536762DADULL, 0x29C1664B3BB3E711ULL,
+      0x794A5CA1F0BD15E2ULL, 0x0F9BD6DEC5ECA4E8ULL,
+      0x61084A1B26FDAB1BULL, 0x2616457F04BD50BAULL,
+      0x4DA03B48EBFE227CULL, 0x1E783798D09773C8ULL,
+      0x7C33920E46636A60ULL, 0x30C058F480F252D9ULL,
+      0x635C74D8384F884DULL, 0x0D66AD9067284247ULL,
+      0x4F7D2A469372D370ULL, 0x711EF14052869B6CULL,
+      0x7F2EAA0A85848581ULL, 0x34FE4ECD50D75F14ULL,
+      0x65BEEE6ED136D134ULL, 0x2A650BD773DF7F43ULL,
+      0x51658B8BDA9240F6ULL, 0x551DA312C319329CULL,
+      0x411E093CAEDB672BULL, 0x5DB14F4235ADC217ULL,
+      0x68300EC77E2BD845ULL, 0x7C4EE536BC49368AULL,
+      0x5359A56C64EFE037ULL, 0x7D0BEA92303A9208ULL,
+      0x42AE1DF050BFE693ULL, 0x173CBBA8269541A0ULL,
+      0x6AB02FE6E79970EBULL, 0x3EC792A6A422029AULL,
+      0x5559BFEBEC7AC0BCULL, 0x3239421EE9B4CEE1ULL,
+      0x4447CCBCBD2F0096ULL, 0x5B6101B25490A581ULL,
+      0x6D3FADFAC84B3424ULL, 0x2BCE691D541AA268ULL,
+      0x576624C8A03C29B6ULL, 0x563EBA7DDCE21B87ULL,
+      0x45EB50A08030215EULL, 0x78322ECB171B4939ULL,
+      0x6FDEE76733803564ULL, 0x59E9E47824F87527ULL,
+      0x597F1F85C2CCF783ULL, 0x6187E9F9B72D2A86ULL,
+      0x4798E6049BD72C69ULL, 0x346CBB2E2C242205ULL,
+      0x728E3CD42C8B7A42ULL, 0x20ADF849E039D007ULL,
+      0x5BA4FD768A092E9BULL, 0x33BE603B19C7D99FULL,
+      0x4950CAC53B3A8BAFULL, 0x42FEB3627B0647B3ULL,
+      0x754E113B91F745E5ULL, 0x5197856A5E7072B8ULL,
+      0x5DD80DC941929E51ULL, 0x27AC6ABB7EC05BC6ULL,
+      0x4B133E3A9ADBB1DAULL, 0x52F05562CBCD1638ULL,
+      0x781EC9F75E2C4FC4ULL, 0x1E4D556ADFAE89F3ULL,
+      0x6018A192B1BD0C9CULL, 0x7EA444557FBED4C3ULL,
+      0x4CE0814227CA707DULL, 0x4BB69D1132FF109CULL,
+      0x7B00CED03FAA4D95ULL, 0x5F8A94E851981A93ULL,
+      0x62670BD9CC883E11ULL, 0x32D543ED0E134875ULL,
+      0x4EB8D647D6D364DAULL, 0x5BDDCFF0D80F6D2BULL,
+      0x7DF48A0C8AEBD491ULL, 0x12FC7FE7C018AEABULL,
+      0x64C3A1A3A25643A7ULL, 0x28C9FFEC99AD5889ULL,
+      0x509C814FB511CFB9ULL, 0x0707FFF07AF113A1ULL,
+      0x407D343FC40E3FC7ULL, 0x1F39998D2F2742E7ULL,
+      0x672EB9FFA016CC71ULL, 0x7EC28F484B7204A4ULL,
+      0x528BC7FFB345705BULL, 0x189BA5D36F8E6A1DULL,
+      0x42096CCC8F6AC048ULL, 0x7A161E42BFA521B1ULL,
+      0x69A8AE1418AACD41ULL, 0x435696D132A1CF81ULL,
+      0x5486F1A9AD557101ULL, 0x1C454574288172CEULL,
+      0x439F27BAF1112734ULL, 0x169DD129BA0128A5ULL,
+      0x6C31D92B1B4EA520ULL, 0x242FB50F9001DAA1ULL,
+      0x568E4755AF721DB3ULL, 0x368C90D940017BB4ULL,
+      0x453E9F77BF8E7E29ULL, 0x120A0D7A999AC95DULL,
+      0x6ECA98BF98E3FD0EULL, 0x50101590F5C47561ULL,
+      0x58A213CC7A4FFDA5ULL, 0x26734473F7D05DE8ULL,
+      0x46E80FD6C83FFE1DULL, 0x6B8F69F65FD9E4B9ULL,
+      0x71734C8AD9FFFCFCULL, 0x45B24323CC8FD45CULL,
+      0x5AC2A3A247FFFD96ULL, 0x6AF502830A0CA9E3ULL,
+      0x489BB61B6CCCCADFULL, 0x08C402026E7087E9ULL,
+      0x742C569247AE1164ULL, 0x746CD003E3E73FDBULL,
+      0x5CF04541D2F1A783ULL, 0x76BD73364FEC3315ULL,
+      0x4A59D101758E1F9CULL, 0x5EFDF5C50CBCF5ABULL,
+      0x76F61B3588E365C7ULL, 0x4B2FEFA1ADFB22ABULL,
+      0x5F2B48F7A0B5EB06ULL, 0x08F3261AF195B555ULL,
+      0x4C22A0C61A2B226BULL, 0x20C284E25ADE2AABULL,
+      0x79D1013CF6AB6A45ULL, 0x1AD0D49D5E304444ULL,
+      0x617400FD9222BB6AULL, 0x48A7107DE4F369D0ULL,
+      0x4DF6673141B562BBULL, 0x53B8D9FE50C2BB0DULL,
+      0x7CBD71E869223792ULL, 0x52C15CCA1AD12B48ULL,
+      0x63CAC186BA81C60EULL, 0x75677D6E7BDA8906ULL,
+      0x4FD5679EFB9B04D8ULL, 0x5DEC645863153A6CULL,
+      0x7FBBD8FE5F5E6E27ULL, 0x497A3A2704EEC3DFULL,
+      0x662FE0CB7F7EBE86ULL, 0x0794FB526A589CB3ULL,
+      0x51BFE70932CBCB9EULL, 0x3943FC41EEAD4A29ULL,
+      0x4166526DC23CA2E5ULL, 0x14366367F2243B54ULL,
+      0x68A3B716039437D5ULL, 0x06BD6BD9836D2BB9ULL,
+      0x53B62C119C769310ULL, 0x6BCABCAE02BDBC94ULL,
+      0x42F8234149F875A7ULL, 0x096EFD58023163AAULL,
+      0x6B269ECEDCC0BC3EULL, 0x424B2EF336B56C43ULL,
+      0x55B87F0BE3CD6365ULL, 0x1B6F58C2922ABD02ULL,
+      0x449398D64FD782B7ULL, 0x2F8C47020E889735ULL,
+      0x6DB8F48A1958D125ULL, 0x327A0B367DA75855ULL,
+      0x57C72A0814470DB7ULL, 0x41FB3C2B97B91377ULL,
+      0x4638EE6CDD05A492ULL, 0x67FC3022DFC742C6ULL,
+      0x705B171494D5D41EULL, 0x0CC6B36AFFA537A2ULL,
+      0x59E278DD43DE434BULL, 0x23D22922661DC61CULL,
+      0x47E860B1031835D5ULL, 0x6974EDB51E7E3816ULL,
+      0x730D67819E8D22EFULL, 0x5BEE4921CA638CF0ULL,
+      0x5C0AB9347ED74F26ULL, 0x16583A816EB60A5AULL,
+      0x49A22DC398AC3F51ULL, 0x5EACFB9ABEF80848ULL,
+      0x75D04938F446CBB5ULL, 0x7DE19291318CDA0CULL,
+      0x5E403A93F69F095EULL, 0x3181420DC13D7B3DULL,
+      0x4B6695432BB26DE5ULL, 0x0E0101A49A9795CBULL,
+      0x78A4220512B7163BULL, 0x30019C3A90F28944ULL,
+      0x60834E6A755F44FCULL, 0x2667B02EDA5BA103ULL,
+      0x4D35D8552AB29D96ULL, 0x51EC8CF248494D9CULL,
+      0x7B895A21DDEA95BDULL, 0x697A7B1D407548FAULL,
+      0x62D4481B17EEDE31ULL, 0x3AC8627DCD2AA0C8ULL,
+      0x4F1039AF4658B1C1ULL, 0x156D1B97D7554D6DULL,
+      0x7E805C4BA3C11C68ULL, 0x22482C26255548AEULL,
+      0x65337D094FCDB053ULL, 0x350689B81DDDD3BEULL,
+      0x50F5FDA10CA48D0FULL, 0x44053AF9B17E42FFULL,
+      0x40C4CAE73D5070D9ULL, 0x1CD0FBFAF4650265ULL,
+      0x67A144A52EE71AF5ULL, 0x1481932B20A19D6FULL,
+      0x52E76A1DBF1F48C4ULL, 0x1067A8EF4D4E178CULL,
+      0x4252BB4AFF4C3A36ULL, 0x4052ED8C3DD812D6ULL,
+      0x6A1DF877FEE05D24ULL, 0x0084AF46C959B7BDULL,
+      0x54E4C6C665804A83ULL, 0x1A03BF6BD447C631ULL,
+      0x43EA389EB799D535ULL, 0x619C992310396B5BULL,
+      0x6CA9F43125C2EEBCULL, 0x35C75B6B4D28ABC4ULL,
+      0x56EE5CF41E358BC9ULL, 0x77D2AF890A86EFD0ULL,
+      0x458B7D90182AD63BULL, 0x130EF2D4086BF30DULL,
+      0x6F4595B359DE2391ULL, 0x6B4B1E200D7984E1ULL,
+      0x590477C2AE4B4FA7ULL, 0x6F6F4B4CD7946A4EULL,
+      0x4736C635583C3FB9ULL, 0x3F8C3C3D7943883EULL,
+      0x71F13D2226C6CC5BULL, 0x7F46C6C8C205A6CAULL,
+      0x5B27641B5238A37CULL, 0x65D238A09B37B8A2ULL,
+      0x48EC5015DB6082CAULL, 0x1E41C6E6E292FA1BULL,
+      0x74AD4CEFC56737A9ULL, 0x7D360B0B041E5CF8ULL,
+      0x5D5770BFD11F5FBBULL, 0x175E6F3C034B7D93ULL,
+      0x4AAC5A330DB2B2FCULL, 0x12B1F29669093142ULL,
+      0x777A29EB491DEB2DULL, 0x044FEA8A41A84ED0ULL,
+      0x5F94EE55D417EF57ULL, 0x1D0CBBA1CE203F0DULL,
+  };
+  __g1 = __table[2 * (__k + 324)];
+  __g0 = __table[2 * (__k + 324) + 1];
+}
+
+// floor(g __cp / 2^127), with the lowest bit set when the division is not
+// exact (round to odd).
+AICUDA_HD inline unsigned long long __schubfach_rop(unsigned long long __g1,
+                                                   unsigned long long __g0,
+                                                   unsigned long long __cp)
+{
+  const unsigned long long __x1 = __umul_hi(__g0, __cp);
+  const unsigned long long __y0 = __g1 * __cp;
+  const unsigned long long __y1 = __umul_hi(__g1, __cp);
+  const unsigned long long __z = (__y0 >> 1) + __x1;
+  const unsigned long long __vbp = __y1 + (__z >> 63);
+  return __vbp |
+         (((__z & 0x7fffffffffffffffULL) + 0x7fffffffffffffffULL) >> 63);
+}
+
+// Shortest __f 10^__e that rounds to __c 2^__q.
+AICUDA_HD inline void __schubfach(int __q, unsigned long long __c,
+                                  unsigned long long &__f, int &__e)
+{
+  const unsigned long long __out = __c & 1;
+  const unsigned long long __cb = __c << 2;
+  const unsigned long long __cbr = __cb + 2;
+  unsigned long long __cbl;
+  int __k;
+  if (__c != (1ULL << 52) || __q == -1074)
+  {
+    __cbl = __cb - 2;
+    __k = __flog10_pow2(__q);
+  }
+  else
+  {
+    // The gap below a power of two is half the gap above it.
+    __cbl = __cb - 1;
+    __k = __flog10_three_quarters_pow2(__q);
+  }
+  const int __h = __q + __flog2_pow10(-__k) + 2;
+
+  unsigned long long __g1, __g0;
+  __schubfach_g(__k, __g1, __g0);
+  const unsigned long long __vb = __schubfach_rop(__g1, __g0, __cb << __h);
+  const unsigned long long __vbl = __schubfach_rop(__g1, __g0, __cbl << __h);
+  const unsigned long long __vbr = __schubfach_rop(__g1, __g0, __cbr << __h);
+
+  const unsigned long long __s = __vb >> 2;
+  if (__s >= 10)
+  {
+    // Try one digit fewer first: s' = floor(s / 10) by multiplication.
+    // The interval is under ten units of s wide, so it never holds both
+    // shorter candidates and never needs two digits fewer.
+    const unsigned long long __sp10 =
+        10 * __umul_hi(__s, 115292150460684698ULL << 4);
+    const unsigned long long __tp10 = __sp10 + 10;
+    const bool __upin = __vbl + __out <= __sp10 << 2;
+    const bool __wpin = (__tp10 << 2) + __out <= __vbr;
+    if (__upin != __wpin)
+    {
+      __f = __upin ? __sp10 : __tp10;
+      __e = __k;
+      return;
+    }
+  }
+
+  const unsigned long long __t = __s + 1;
+  const bool __uin = __vbl + __out <= __s << 2;
+  const bool __win = (__t << 2) + __out <= __vbr;
+  __e = __k;
+  if (__uin != __win)
+  {
+    __f = __uin ? __s : __t;
+    return;
+  }
+  const long long __cmp = (long long)(__vb - ((__s + __t) << 1));
+  __f = __cmp < 0 || (__cmp == 0 && (__s & 1) == 0) ? __s : __t;
+}
+
+union __double_bits
+{
+  double _M_value;
+  unsigned long long _M_bits;
+};
+
+// Shortest decimal digits of a finite, nonzero |__bits|, without trailing
+// zeros: the value is __f 10^__e.
+AICUDA_HD inline void __to_decimal(unsigned long long __bits,
+                                   unsigned long long &__f, int &__e)
+{
+  const unsigned long long __t = __bits & ((1ULL << 52) - 1);
+  const int __bq = int(__bits >> 52) & 0x7ff;
+  if (__bq != 0)
+  {
+    const int __mq = 1075 - __bq;
+    const unsigned long long __c = (1ULL << 52) | __t;
+    if (0 < __mq && __mq < 53 && ((__c >> __mq) << __mq) == __c)
+    {
+      // Small integers are their own shortest representation.
+      __f = __c >> __mq;
+      __e = 0;
+    }
+    else
+      __schubfach(-__mq, __c, __f, __e);
+  }
+  else
+    __schubfach(-1074, __t, __f, __e);
+
+  while (__f % 10 == 0)
+  {
+    __f /= 10;
+    ++__e;
+  }
+}
+
+AICUDA_HD inline to_chars_result __to_chars_copy(char *__first, char *__last,
+                                                 const char *__s,
+                                                 unsigned __n)
+{
+  if (__last - __first < ptrdiff_t(__n))
+  {
+    to_chars_result __res = {__last, errc::value_too_large};
+    return __res;
+  }
+  for (unsigned __i = 0; __i < __n; ++__i)
+    __first[__i] = __s[__i];
+  to_chars_result __res = {__first + __n, errc()};
+  return __res;
+}
+
+// "inf" and "nan" as printf writes them; the sign was already emitted.
+AICUDA_HD inline to_chars_result __to_chars_special(char *__first,
+                                                    char *__last,
+                                                    unsigned long long __bits)
+{
+  return (__bits & ((1ULL << 52) - 1))
+             ? __to_chars_copy(__first, __last, "nan", 3)
+             : __to_chars_copy(__first, __last, "inf", 3);
+}
+
+// Natural number in little-endian 32-bit limbs.  35 limbs hold any double
+// scaled to an integer (< 2^1024) and the fraction of any double, times
+// ten, over its 2^1074 denominator; parsing compares up to 780 digits
+// against a halfway point and needs 100.
+template <unsigned _Nlimbs>
+struct __chars_bignum
+{
+  unsigned _M_limbs[_Nlimbs];
+  unsigned _M_size;
+
+  // *this = __v << __shift.
+  AICUDA_HD void _M_assign(unsigned long long __v, unsigned __shift)
+  {
+    const unsigned __w = __shift / 32;
+    const unsigned __b = __shift % 32;
+    for (unsigned __i = 0; __i < __w; ++__i)
+      _M_limbs[__i] = 0;
+    const unsigned long long __lo = __v << __b;
+    _M_limbs[__w] = unsigned(__lo);
+    _M_limbs[__w + 1] = unsigned(__lo >> 32);
+    _M_limbs[__w + 2] = __b ? unsigned(__v >> (64 - __b)) : 0;
+    _M_size = __w + 3;
+    _M_trim();
+  }
+
+  AICUDA_HD void _M_trim()
+  {
+    while (_M_size && !_M_limbs[_M_size - 1])
+      --_M_size;
+  }
+
+  AICUDA_HD void _M_mul(unsigned __m)
+  {
+    unsigned long long __carry = 0;
+    for (unsigned __i = 0; __i < _M_size; ++__i)
+    {
+      __carry += (unsigned long long)_M_limbs[__i] * __m;
+      _M_limbs[__i] = unsigned(__carry);
+      __carry >>= 32;
+    }
+    if (__carry)
+      _M_limbs[_M_size++] = unsigned(__carry);
+  }
+
+  // *this = *this * __m + __a.
+  AICUDA_HD void _M_mul_add(unsigned __m, unsigned __a)
+  {
+    unsigned long long __carry = __a;
+    for (unsigned __i = 0; __i < _M_size; ++__i)
+    {
+      __carry += (unsigned long long)_M_limbs[__i] * __m;
+      _M_limbs[__i] = unsigned(__carry);
+      __carry >>= 32;
+    }
+    if (__carry)
+      _M_limbs[_M_size++] = unsigned(__carry);
+  }
+
+  AICUDA_HD void _M_mul_pow5(unsigned __n)
+  {
+    for (; __n >= 13; __n -= 13)
+      _M_mul(1220703125u);
+    static const unsigned __small[13] = {1, 5, 25, 125, 625, 3125, 15625,
+                                         78125, 390625, 1953125, 9765625,
+                                         48828125, 244140625};
+    if (__n)
+      _M_mul(__small[__n]);
+  }
+
+  AICUDA_HD void _M_shl(unsigned __n)
+  {
+    if (!_M_size)
+      return;
+    const unsigned __w = __n / 32;
+    const unsigned __b = __n % 32;
+    _M_limbs[_M_size + __w] = 0;
+    for (unsigned __i = _M_size; __i-- > 0;)
+    {
+      if (__b)
+        _M_limbs[__i + __w + 1] |= _M_limbs[__i] >> (32 - __b);
+      _M_limbs[__i + __w] = _M_limbs[__i] << __b;
+    }
+    for (unsigned __i = 0; __i < __w; ++__i)
+      _M_limbs[__i] = 0;
+    _M_size += __w + 1;
+    _M_trim();
+  }
+
+  AICUDA_HD int _M_compare(const __chars_bignum &__o) const
+  {
+    if (_M_size != __o._M_size)
+      return _M_size < __o._M_size ? -1 : 1;
+    for (unsigned __i = _M_size; __i-- > 0;)
+      if (_M_limbs[__i] != __o._M_limbs[__i])
+        return _M_limbs[__i] < __o._M_limbs[__i] ? -1 : 1;
+    return 0;
+  }
+
+  // Divides in place and returns the remainder.
+  AICUDA_HD unsigned _M_divmod(unsigned __d)
+  {
+    unsigned long long __rem = 0;
+    for (unsigned __i = _M_size; __i-- > 0;)
+    {
+      __rem = (__rem << 32) | _M_limbs[__i];
+      _M_limbs[__i] = unsigned(__rem / __d);
+      __rem %= __d;
+    }
+    _M_trim();
+    return unsigned(__rem);
+  }
+
+  // Removes and returns the bits at and above __s (a single digit here).
+  AICUDA_HD unsigned _M_take_above(unsigned __s)
+  {
+    const unsigned __w = __s / 32;
+    const unsigned __b = __s % 32;
+    if (__w >= _M_size)
+      return 0;
+    unsigned long long __top = _M_limbs[__w];
+    if (__w + 1 < _M_size)
+      __top |= (unsigned long long)_M_limbs[__w + 1] << 32;
+    _M_limbs[__w] &= __b ? (1u << __b) - 1 : 0;
+    _M_size = __w + 1;
+    _M_trim();
+    return unsigned(__top >> __b);
+  }
+
+  // Sign of *this - 2^(__s - 1), given *this < 2^__s.
+  AICUDA_HD int _M_cmp_half(unsigned __s) const
+  {
+    const unsigned __w = (__s - 1) / 32;
+    const unsigned __b = (__s - 1) % 32;
+    if (__w >= _M_size || !((_M_limbs[__w] >> __b) & 1))
+      return -1;
+    if (_M_limbs[__w] & ((1u << __b) - 1))
+      return 1;
+    for (unsigned __i = 0; __i < __w; ++__i)
+      if (_M_limbs[__i])
+        return 1;
+    return 0;
+  }
+};
+
+// Exact decimal digits of __f 2^__e (both >= 0): 64-bit values directly,
+// larger ones nine digits per division of a big integer.
+AICUDA_HD inline to_chars_result __to_chars_integer(char *__first,
+                                                    char *__last,
+                                                    unsigned long long __f,
+                                                    int __e)
+{
+  if (__e <= 11)
+    return to_chars(__first, __last, __f << __e);
+
+  __chars_bignum<35> __v;
+  __v._M_assign(__f, unsigned(__e));
+  unsigned __chunks[36];
+  unsigned __n = 0;
+  while (__v._M_size)
+    __chunks[__n++] = __v._M_divmod(1000000000);
+
+  const unsigned __top_len = __to_chars_len(__chunks[__n - 1], 10u);
+  const unsigned __len = __top_len + 9 * (__n - 1);
+  if (__last - __first < ptrdiff_t(__len))
+  {
+    to_chars_result __res = {__last, errc::value_too_large};
+    return __res;
+  }
+  __to_chars_10_impl(__first, __top_len, __chunks[__n - 1]);
+  char *__p = __first + __top_len;
+  for (unsigned __i = __n - 1; __i-- > 0; __p += 9)
+  {
+    unsigned __c = __chunks[__i];
+    for (int __j = 8; __j >= 0; --__j)
+    {
+      __p[__j] = char('0' + __c % 10);
+      __c /= 10;
+    }
+  }
+  to_chars_result __res = {__p, errc()};
+  return __res;
+}
+
+// Formats __value with the fewest digits that read back as the same double,
+// in fixed or scientific notation, whichever is shorter (fixed on a tie).
+// This is std::to_chars(first, last, double).
+AICUDA_HD inline to_chars_result to_chars(char *__first, char *__last,
+                                          double __value)
+{
+  __double_bits __cvt;
+  __cvt._M_value = __value;
+  const unsigned long long __bits = __cvt._M_bits;
+  const unsigned long long __mag = __bits & ~(1ULL << 63);
+
+  if (__bits >> 63)
+  {
+    if (__first == __last)
+    {
+      to_chars_result __res = {__last, errc::value_too_large};
+      return __res;
+    }
+    *__first++ = '-';
+  }
+  if ((__mag >> 52) == 0x7ff)
+    return __to_chars_special(__first, __last, __bits);
+  if (__mag == 0)
+    return __to_chars_copy(__first, __last, "0", 1);
+
+  unsigned long long __f;
+  int __e;
+  __to_decimal(__mag, __f, __e);
+
+  const int __n = int(__to_chars_len(__f, 10u));
+  const int __sci_exp = __n - 1 + __e;
+  const int __abs_exp = __sci_exp < 0 ? -__sci_exp : __sci_exp;
+  const int __sci_len = __n + (__n > 1) + 2 + (__abs_exp >= 100 ? 3 : 2);
+  int __fixed_len;
+  if (__e >= 0)
+    __fixed_len = __n + __e;
+  else if (__n + __e > 0)
+    __fixed_len = __n + 1;
+  else
+    __fixed_len = 2 - (__n + __e) + __n;
+
+  if (__fixed_len <= __sci_len)
+  {
+    if (__last - __first < __fixed_len)
+    {
+      to_chars_result __res = {__last, errc::value_too_large};
+      return __res;
+    }
+    char *__p = __first;
+    if (__e >= 0)
+    {
+      // An integer: printed exactly, as printf("%.0f") would, rather than
+      // as the shortest digits padded with zeros.
+      const int __q = int(__mag >> 52) - 1075;
+      const unsigned long long __c = (__mag & ((1ULL << 52) - 1)) |
+                                     (1ULL << 52);
+      if (__q >= 0)
+        return __to_chars_integer(__first, __last, __c, __q);
+      __to_chars_10_impl(__p, unsigned(__fixed_len), __c >> -__q);
+    }
+    else if (__n + __e > 0)
+    {
+      // ddd.ddd: write the digits one place right, then pull the integer
+      // part back over the gap.
+      const int __point = __n + __e;
+      __to_chars_10_impl(__p + 1, unsigned(__n), __f);
+      for (int __i = 0; __i < __point; ++__i)
+        __p[__i] = __p[__i + 1];
+      __p[__point] = '.';
+    }
+    else
+    {
+      __p[0] = '0';
+      __p[1] = '.';
+      for (int __i = 2; __i < __fixed_len - __n; ++__i)
+        __p[__i] = '0';
+      __to_chars_10_impl(__p + __fixed_len - __n, unsigned(__n), __f);
+    }
+    to_chars_result __res = {__first + __fixed_len, errc()};
+    return __res;
+  }
+
+  if (__last - __first < __sci_len)
+  {
+    to_chars_result __res = {__last, errc::value_too_large};
+    return __res;
+  }
+  char *__p = __first;
+  __to_chars_10_impl(__p + 1, unsigned(__n), __f);
+  __p[0] = __p[1];
+  if (__n > 1)
+  {
+    __p[1] = '.';
+    __p += __n + 1;
+  }
+  else
+    __p += 1;
+  *__p++ = 'e';
+  *__p++ = __sci_exp < 0 ? '-' : '+';
+  if (__abs_exp < 10)
+    *__p++ = '0';
+  const unsigned __exp_len = __to_chars_len(unsigned(__abs_exp), 10u);
+  __to_chars_10_impl(__p, __exp_len, unsigned(__abs_exp));
+  to_chars_result __res = {__p + __exp_len, errc()};
+  return __res;
+}
+
+// Formats __value with exactly __precision digits after the point, rounded
+// half to even from the exact binary value: printf("%.*f").  Only
+// chars_format::fixed is supported; a negative precision means 6.
+AICUDA_HD inline to_chars_result to_chars(char *__first, char *__last,
+                                          double __value, chars_format __fmt,
+                                          int __precision)
+{
+  if (__fmt != chars_format::fixed)
+  {
+    printf("to_chars: only chars_format::fixed takes a precision\n");
+    assert(1 < 0);
+  }
+  if (__precision < 0)
+    __precision = 6;
+
+  __double_bits __cvt;
+  __cvt._M_value = __value;
+  const unsigned long long __bits = __cvt._M_bits;
+
+  if (__bits >> 63)
+  {
+    if (__first == __last)
+    {
+      to_chars_result __res = {__last, errc::value_too_large};
+      return __res;
+    }
+    *__first++ = '-';
+  }
+  const int __bq = int(__bits >> 52) & 0x7ff;
+  if (__bq == 0x7ff)
+    return __to_chars_special(__first, __last, __bits);
+
+  const unsigned long long __t = __bits & ((1ULL << 52) - 1);
+  const unsigned long long __f = __bq ? __t | (1ULL << 52) : __t;
+  const int __e = __bq ? __bq - 1075 : -1074;
+  const int __dot = __precision ? 1 : 0;
+
+  if (__e >= 0)
+  {
+    to_chars_result __res = __to_chars_integer(__first, __last, __f, __e);
+    if (__res.ec != errc())
+      return __res;
+    if (__last - __res.ptr < __dot + __precision)
+    {
+      __res.ptr = __last;
+      __res.ec = errc::value_too_large;
+      return __res;
+    }
+    if (__dot)
+      *__res.ptr++ = '.';
+    for (int __i = 0; __i < __precision; ++__i)
+      *__res.ptr++ = '0';
+    return __res;
+  }
+
+  // __f 2^__e = __int + __frac / 2^__s.
+  const unsigned __s = unsigned(-__e);
+  unsigned long long __int = __s < 64 ? __f >> __s : 0;
+  __chars_bignum<35> __frac;
+  __frac._M_assign(__s < 64 ? __f & ((1ULL << __s) - 1) : __f, 0);
+
+  unsigned __int_len = __to_chars_len(__int, 10u);
+  if (__last - __first < ptrdiff_t(__int_len) + __dot + __precision)
+  {
+    to_chars_result __res = {__last, errc::value_too_large};
+    return __res;
+  }
+
+  char *__digits = __first + __int_len + __dot;
+  int __i = 0;
+  for (; __i < __precision && __frac._M_size; ++__i)
+  {
+    __frac._M_mul(10);
+    __digits[__i] = char('0' + __frac._M_take_above(__s));
+  }
+  for (; __i < __precision; ++__i)
+    __digits[__i] = '0';
+
+  const int __cmp = __frac._M_cmp_half(__s);
+  const unsigned __last_digit =
+      __precision ? unsigned(__digits[__precision - 1] - '0')
+                  : unsigned(__int % 10);
+  if (__cmp > 0 || (__cmp == 0 && (__last_digit & 1)))
+  {
+    int __j = __precision - 1;
+    while (__j >= 0 && __digits[__j] == '9')
+      __digits[__j--] = '0';
+    if (__j >= 0)
+      ++__digits[__j];
+    else
+    {
+      // Carried out of an all-nines fraction, which is now all zeros.
+      ++__int;
+      const unsigned __len = __to_chars_len(__int, 10u);
+      if (__len != __int_len)
+      {
+        if (__last - __first < ptrdiff_t(__len) + __dot + __precision)
+        {
+          to_chars_result __res = {__last, errc::value_too_large};
+          return __res;
+        }
+        __int_len = __len;
+        __digits = __first + __int_len + __dot;
+        for (int __k = 0; __k < __precision; ++__k)
+          __digits[__k] = '0';
+      }
+    }
+  }
+
+  __to_chars_10_impl(__first, __int_len, __int);
+  if (__dot)
+    __first[__int_len] = '.';
+  to_chars_result __res = {__digits + __precision, errc()};
+  return __res;
+}
+
+// Parsing.  from_chars reads a number from the start of [__first, __last)
+// with no leading whitespace and no '+' sign.  On success ptr is the first
+// character not consumed; when no number is there, ptr is __first and ec
+// errc::invalid_argument; when the number does not fit, ptr is past it, ec
+// errc::result_out_of_range and __value is left untouched.
+
+struct from_chars_result
+{
+  const char *ptr;
+  errc ec;
+};
+
+// Value of __c as a digit in bases up to 36, or 255.
+AICUDA_HD inline unsigned __from_chars_digit(char __c)
+{
+  const unsigned __d = unsigned((unsigned char)__c) - '0';
+  if (__d < 10)
+    return __d;
+  const unsigned __l = (unsigned((unsigned char)__c) | 0x20) - 'a';
+  return __l < 26 ? __l + 10 : 255;
+}
+
+// Eight bytes from an arbitrary address; the device faults on misaligned
+// wide loads, so it assembles them byte by byte.  Both are little-endian.
+AICUDA_HD inline unsigned long long __from_chars_load8(const char *__p)
+{
+#if AICUDA_DEVICE_CODE
+  unsigned long long __v = 0;
+  for (int __i = 7; __i >= 0; --__i)
+    __v = (__v << 8) | (unsigned char)__p[__i];
+  return __v;
+#else
+  unsigned long long __v;
+  __builtin_memcpy(&__v, __p, 8);
+  return __v;
+#endif
+}
+
+AICUDA_HD inline bool __from_chars_is_eight_digits(unsigned long long __v)
+{
+  return (((__v + 0x4646464646464646ULL) | (__v - 0x3030303030303030ULL)) &
+          0x8080808080808080ULL) == 0;
+}
+
+// The eight ASCII digits in __v (first digit in the lowest byte) as a
+// number: neighbouring digits, then pairs, then quads are merged with
+// three multiplications.
+AICUDA_HD inline unsigned __from_chars_eight_digits(unsigned long long __v)
+{
+  const unsigned long long __mask = 0x000000FF000000FFULL;
+  const unsigned long long __mul1 = 100 + (1000000ULL << 32);
+  const unsigned long long __mul2 = 1 + (10000ULL << 32);
+  __v -= 0x3030303030303030ULL;
+  __v = (__v * 10) + (__v >> 8);
+  return unsigned((((__v & __mask) * __mul1) +
+                   (((__v >> 16) & __mask) * __mul2)) >> 32);
+}
+
+// Digits of [__p, __last) in __base, into __acc.  Returns the end of the
+// digits and sets __overflow when they do not fit 64 bits.
+AICUDA_HD inline const char *__from_chars_uint(const char *__p,
+                                               const char *__last,
+                                               unsigned __base,
+                                               unsigned long long &__acc,
+                                               bool &__overflow)
+{
+  __acc = 0;
+  __overflow = false;
+  if (__base == 10)
+  {
+    while (__p != __last && *__p == '0')
+      ++__p;
+    // Up to 19 digits cannot overflow; take them eight at a time.
+    const char *__start = __p;
+    while (__last - __p >= 8 && __p - __start <= 11 &&
+           __from_chars_is_eight_digits(__from_chars_load8(__p)))
+    {
+      __acc = __acc * 100000000 + __from_chars_eight_digits(__from_chars_load8(__p));
+      __p += 8;
+    }
+    for (; __p != __last; ++__p)
+    {
+      const unsigned __d = unsigned((unsigned char)*__p) - '0';
+      if (__d >= 10)
+        break;
+      if (__p - __start < 19)
+        __acc = __acc * 10 + __d;
+      else if (__p - __start == 19 && __acc <= (~0ULL - __d) / 10)
+        __acc = __acc * 10 + __d;
+      else
+        __overflow = true;
+    }
+    return __p;
+  }
+
+  for (; __p != __last; ++__p)
+  {
+    const unsigned __d = __from_chars_digit(*__p);
+    if (__d >= __base)
+      break;
+    if (__acc > (~0ULL - __d) / __base)
+      __overflow = true;
+    else
+      __acc = __acc * __base + __d;
+  }
+  return __p;
+}
+
+// Integers in __base 2 to 36 (letters in either case), with a leading '-'
+// for signed types.
+template <typename _Tp>
+AICUDA_HD inline typename __enable_if<__is_integer<_Tp>::__value &&
+                                          !__is_boolean<_Tp>::__value,
+                                      from_chars_result>::__type
+from_chars(const char *__first, const char *__last, _Tp &__value,
+           int __base = 10)
+{
+  if (__base < 2 || __base > 36)
+  {
+    printf("from_chars: invalid base %d\n", __base);
+    assert(1 < 0);
+  }
+
+  const char *__p = __first;
+  const bool __neg =
+      !__is_unsigned_integer<_Tp>::__value && __p != __last && *__p == '-';
+  if (__neg)
+    ++__p;
+
+  from_chars_result __res = {__first, errc::invalid_argument};
+  if (__p == __last || __from_chars_digit(*__p) >= unsigned(__base))
+    return __res;
+
+  unsigned long long __acc;
+  bool __overflow;
+  __res.ptr = __from_chars_uint(__p, __last, unsigned(__base), __acc,
+                                __overflow);
+
+  // Largest magnitude of the result's sign.
+  const unsigned long long __umax =
+      __is_unsigned_integer<_Tp>::__value
+          ? (unsigned long long)_Tp(-1)
+          : (1ULL << (sizeof(_Tp) * 8 - 1)) - (__neg ? 0 : 1);
+  if (__overflow || __acc > __umax)
+  {
+    __res.ec = errc::result_out_of_range;
+    return __res;
+  }
+  __value = __neg ? _Tp(0ULL - __acc) : _Tp(__acc);
+  __res.ec = errc();
+  return __res;
+}
+
+// Index of the highest set bit of a nonzero __v, counted from the top.
+AICUDA_HD inline int __from_chars_clz(unsigned long long __v)
+{
+#if AICUDA_DEVICE_CODE
+  return __clzll((long long)__v);
+#else
+  return __builtin_clzll(__v);
+#endif
+}
+
+// Bit __i of the 192-bit little-endian __x, and whether any bit below __i
+// is set.
+AICUDA_HD inline bool __from_chars_bit(const unsigned long long *__x, int __i)
+{
+  return __i < 192 && ((__x[__i / 64] >> (__i % 64)) & 1);
+}
+
+AICUDA_HD inline bool __from_chars_any_below(const unsigned long long *__x,
+                                             int __i)
+{
+  if (__i >= 192)
+    return __x[0] || __x[1] || __x[2];
+  for (int __j = 0; __j < __i / 64; ++__j)
+    if (__x[__j])
+      return true;
+  return (__x[__i / 64] & ((1ULL << (__i % 64)) - 1)) != 0;
+}
+
+// Bit pattern of the double nearest to (__x + d) 2^__r, ties to even,
+// where 2^188 <= __x < 2^190 in three limbs and d is 0, or some amount in
+// (0, 1) when __sticky.  Overflow gives infinity and underflow zero.
+AICUDA_HD inline unsigned long long __from_chars_round(
+    const unsigned long long *__x, int __r, bool __sticky)
+{
+  const int __len = 192 - __from_chars_clz(__x[2]);
+  int __e2 = __len - 1 + __r;
+  unsigned long long __m;
+  if (__e2 >= -1022)
+  {
+    // Normal: the mantissa and the rounding bits are all in the top limb.
+    const int __b = __len - 53 - 128;
+    const unsigned long long __rest = __x[2] & ((1ULL << __b) - 1);
+    const unsigned long long __half = 1ULL << (__b - 1);
+    __m = __x[2] >> __b;
+    if (__rest > __half ||
+        (__rest == __half && (__sticky || (__m & 1) || __x[1] || __x[0])))
+      ++__m;
+    if (__m == 1ULL << 53)
+    {
+      __m >>= 1;
+      ++__e2;
+    }
+    if (__e2 > 1023)
+      return 0x7ffULL << 52;
+    return ((unsigned long long)(__e2 + 1023) << 52) |
+           (__m & ((1ULL << 52) - 1));
+  }
+
+  // Subnormal: fewer mantissa bits, anywhere in the number.  Rounding up
+  // to 2^52 gives the smallest normal's pattern by itself.
+  const int __s = __len - 53 + (-1022 - __e2);
+  __m = 0;
+  if (__s < 192)
+  {
+    const int __w = __s / 64;
+    const int __b = __s % 64;
+    __m = __x[__w] >> __b;
+    if (__b && __w < 2)
+      __m |= __x[__w + 1] << (64 - __b);
+    __m &= (1ULL << 53) - 1;
+  }
+  if (__from_chars_bit(__x, __s - 1) &&
+      (__sticky || (__m & 1) || __from_chars_any_below(__x, __s - 1)))
+    ++__m;
+  return __m;
+}
+
+// The mantissa of a decimal number: up to 19 significant digits in __w,
+// the value being about __w 10^__exp; __truncated when nonzero digits
+// did not fit.
+struct __from_chars_decimal
+{
+  unsigned long long _M_w;
+  long long _M_exp;
+  bool _M_truncated;
+  const char *_M_begin;
+  const char *_M_end;
+  long long _M_exp10;
+};
+
+// Reads the digits at __p into __d, __nd counting those taken into
+// _M_w: eight at a time while 19 cannot be exceeded, then one at a time.
+// Fraction digits taken lower the exponent; integer digits dropped raise
+// it.
+AICUDA_HD inline const char *__from_chars_mantissa(const char *__p,
+                                                   const char *__last,
+                                                   __from_chars_decimal &__d,
+                                                   unsigned &__nd,
+                                                   bool __frac)
+{
+  while (__nd <= 11 && __last - __p >= 8)
+  {
+    const unsigned long long __v = __from_chars_load8(__p);
+    if (!__from_chars_is_eight_digits(__v))
+      break;
+    const bool __leading = __d._M_w == 0;
+    __d._M_w = __d._M_w * 100000000 + __from_chars_eight_digits(__v);
+    if (!__leading)
+      __nd += 8;
+    else if (__d._M_w)
+      __nd = __to_chars_len(__d._M_w, 10u);
+    __d._M_exp -= __frac ? 8 : 0;
+    __p += 8;
+  }
+  for (; __p != __last; ++__p)
+  {
+    const unsigned __c = unsigned((unsigned char)*__p) - '0';
+    if (__c >= 10)
+      break;
+    if (__nd < 19)
+    {
+      __d._M_w = __d._M_w * 10 + __c;
+      __nd += __d._M_w != 0;
+      __d._M_exp -= __frac;
+    }
+    else
+    {
+      __d._M_exp += !__frac;
+      __d._M_truncated |= __c != 0;
+    }
+  }
+  return __p;
+}
+
+// Exact comparison of the decimal number with the halfway point
+// (2 __m + 1) 2^(__e - 1), reading up to 780 significant digits (more can
+// only break a tie).  Only needed when the bounds in __from_chars_double
+// straddle a rounding boundary.
+AICUDA_HD inline int __from_chars_cmp_halfway(const __from_chars_decimal &__d,
+                                              unsigned long long __m, int __e)
+{
+  __chars_bignum<100> __lhs;
+  __lhs._M_size = 0;
+  long long __q = __d._M_exp10;
+  unsigned __taken = 0;
+  unsigned __chunk = 0;
+  unsigned __chunk_len = 0;
+  bool __nonzero_rest = false;
+  bool __frac = false;
+  for (const char *__p = __d._M_begin; __p != __d._M_end; ++__p)
+  {
+    if (*__p == '.')
+    {
+      __frac = true;
+      continue;
+    }
+    const unsigned __c = unsigned(*__p - '0');
+    if (__taken == 0 && __c == 0)
+    {
+      __q -= __frac;
+      continue;
+    }
+    if (__taken == 780)
+    {
+      __q += !__frac;
+      __nonzero_rest |= __c != 0;
+      continue;
+    }
+    __q -= __frac;
+    ++__taken;
+    __chunk = __chunk * 10 + __c;
+    if (++__chunk_len == 9)
+    {
+      __lhs._M_mul_add(1000000000u, __chunk);
+      __chunk = 0;
+      __chunk_len = 0;
+    }
+  }
+  static const unsigned __pow10[9] = {1,      10,      100,      1000,     10000,
+                                      100000, 1000000, 10000000, 100000000};
+  if (__chunk_len)
+    __lhs._M_mul_add(__pow10[__chunk_len], __chunk);
+
+  // __lhs 10^__q against (2 __m + 1) 2^(__e - 1), powers of five moved to
+  // the side whose exponent is positive and powers of two shifted out.
+  __chars_bignum<100> __rhs;
+  __rhs._M_assign(2 * __m + 1, 0);
+  long long __lexp = 0;
+  long long __rexp = __e - 1;
+  if (__q >= 0)
+  {
+    __lhs._M_mul_pow5(unsigned(__q));
+    __lexp = __q;
+  }
+  else
+  {
+    __rhs._M_mul_pow5(unsigned(-__q));
+    __rexp -= __q;
+  }
+  if (__lexp > __rexp)
+    __lhs._M_shl(unsigned(__lexp - __rexp));
+  else
+    __rhs._M_shl(unsigned(__rexp - __lexp));
+  const int __cmp = __lhs._M_compare(__rhs);
+  return __cmp == 0 && __nonzero_rest ? 1 : __cmp;
+}
+
+// Bit pattern of the double nearest the decimal number, or 0x7ff0... on
+// overflow.  Small exact inputs take Clinger's fast path: one exact
+// double multiplication or division.  Otherwise, as in Eisel and Lemire's
+// algorithm, the digits are multiplied by a 126-bit power of ten (the
+// Schubfach table) and the result bounded on both sides; when both bounds
+// round alike that is the answer, and the rare remaining case is settled
+// by an exact big integer comparison.
+AICUDA_HD inline unsigned long long __from_chars_double(
+    const __from_chars_decimal &__d)
+{
+  const unsigned long long __w = __d._M_w;
+  if (__w == 0)
+    return 0;
+  if (__d._M_exp > 308)
+    return 0x7ffULL << 52;
+  if (__d._M_exp < -343)
+    return 0;
+  const int __q = int(__d._M_exp);
+
+  if (!__d._M_truncated && __w <= (1ULL << 53) && -22 <= __q && __q <= 22)
+  {
+    static const double __pow10[23] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    __double_bits __cvt;
+    __cvt._M_value = __q >= 0 ? double(__w) * __pow10[__q]
+                              : double(__w) / __pow10[-__q];
+    return __cvt._M_bits;
+  }
+
+  // 10^__q = (__g - 1 + __f) 2^__r for some __f in (0, 1], or exactly
+  // (__g - 1) 2^__r when 5^__q fits the table's 126 bits.  With __w
+  // shifted up to its top bit, the products below lie in [2^188, 2^190).
+  unsigned long long __g1, __g0;
+  __schubfach_g(-__q, __g1, __g0);
+  const int __lz = __from_chars_clz(__w);
+  const int __r = __flog2_pow10(__q) - 125 - __lz;
+  const bool __exact = !__d._M_truncated && __q >= 0 && __r + __lz <= __q;
+  const unsigned long long __wn = __w << __lz;
+
+  // __lo = __wn (__g - 1) and __hi = (__w + __truncated) __g 2^__lz, in
+  // 192 bits.
+  const unsigned long long __a0 = __wn * __g0;
+  const unsigned long long __a1 = __umul_hi(__wn, __g0);
+  const unsigned long long __b0 = __wn * __g1;
+  const unsigned long long __b1 = __umul_hi(__wn, __g1);
+  unsigned long long __wg[3];
+  __wg[0] = __a0 + (__b0 << 63);
+  unsigned long long __c = __wg[0] < __a0;
+  __wg[1] = __a1 + ((__b0 >> 1) | (__b1 << 63));
+  const unsigned long long __c1 = __wg[1] < __a1;
+  __wg[1] += __c;
+  __c = __c1 | (__wg[1] < __c);
+  __wg[2] = (__b1 >> 1) + __c;
+
+  unsigned long long __lo[3] = {__wg[0] - __wn, __wg[1], __wg[2]};
+  if (__wg[0] < __wn && __lo[1]-- == 0)
+    --__lo[2];
+  const unsigned long long __lower = __from_chars_round(__lo, __r, false);
+  if (__exact)
+    return __lower;
+
+  unsigned long long __hi[3] = {__wg[0], __wg[1], __wg[2]};
+  if (__d._M_truncated)
+  {
+    // Add __g 2^__lz.  A truncated __w has 19 digits, so __lz <= 4.
+    const unsigned long long __g = __g0 | (__g1 << 63);
+    const unsigned long long __gl = __g << __lz;
+    const unsigned long long __gh =
+        ((__g1 >> 1) << __lz) | (__lz ? __g >> (64 - __lz) : 0);
+    const unsigned long long __gt = __lz ? (__g1 >> 1) >> (64 - __lz) : 0;
+    __hi[0] += __gl;
+    unsigned long long __carry = __hi[0] < __gl;
+    __hi[1] += __gh;
+    const unsigned long long __c2 = __hi[1] < __gh;
+    __hi[1] += __carry;
+    __carry = __c2 | (__hi[1] < __carry);
+    __hi[2] += __gt + __carry;
+  }
+  // Values in [__lo, __hi): round __hi - 1 plus a fraction.
+  if (__hi[0]-- == 0 && __hi[1]-- == 0)
+    --__hi[2];
+  const unsigned long long __upper = __from_chars_round(__hi, __r, true);
+  if (__lower == __upper)
+    return __lower;
+
+  // The bounds are adjacent doubles: compare with the point between them.
+  const int __be = int(__lower >> 52);
+  const unsigned long long __bm =
+      (__lower & ((1ULL << 52) - 1)) | (__be ? 1ULL << 52 : 0);
+  const int __cmp = __from_chars_cmp_halfway(__d, __bm, (__be ? __be : 1) - 1075);
+  return __cmp > 0 || (__cmp == 0 && (__bm & 1)) ? __lower + 1 : __lower;
+}
+
+// Length of the case-insensitive match of __word at __p, or 0.
+AICUDA_HD inline int __from_chars_match(const char *__p, const char *__last,
+                                        const char *__word)
+{
+  int __n = 0;
+  for (; __word[__n]; ++__n)
+    if (__p + __n == __last || (__p[__n] | 0x20) != __word[__n])
+      return 0;
+  return __n;
+}
+
+// Doubles in decimal: digits with an optional point, then an exponent
+// ("e-12") that chars_format::scientific requires and ::fixed does not
+// read; or "inf", "infinity", "nan" and "nan(chars)" in any case.  The
+// result is correctly rounded, however many digits there are; it is out
+// of range when it overflows or a nonzero number rounds to zero.
+// chars_format::hex is not supported.
+AICUDA_HD inline from_chars_result from_chars(
+    const char *__first, const char *__last, double &__value,
+    chars_format __fmt = chars_format::general)
+{
+  if (__fmt == chars_format::hex)
+  {
+    printf("from_chars: chars_format::hex is not supported\n");
+    assert(1 < 0);
+  }
+
+  from_chars_result __res = {__first, errc::invalid_argument};
+  const char *__p = __first;
+  const bool __neg = __p != __last && *__p == '-';
+  if (__neg)
+    ++__p;
+  if (__p == __last)
+    return __res;
+
+  __double_bits __cvt;
+  const unsigned long long __sign = (unsigned long long)__neg << 63;
+  if (int __n = __from_chars_match(__p, __last, "inf"))
+  {
+    __p += __n;
+    __p += __from_chars_match(__p, __last, "inity");
+    __cvt._M_bits = __sign | (0x7ffULL << 52);
+    __value = __cvt._M_value;
+    __res.ptr = __p;
+    __res.ec = errc();
+    return __res;
+  }
+  if (int __n = __from_chars_match(__p, __last, "nan"))
+  {
+    __p += __n;
+    if (__p != __last && *__p == '(')
+    {
+      const char *__q = __p + 1;
+      while (__q != __last &&
+             (__from_chars_digit(*__q) < 36 || *__q == '_'))
+        ++__q;
+      if (__q != __last && *__q == ')')
+        __p = __q + 1;
+    }
+    __cvt._M_bits = __sign | (0xfffULL << 51);
+    __value = __cvt._M_value;
+    __res.ptr = __p;
+    __res.ec = errc();
+    return __res;
+  }
+
+  __from_chars_decimal __d;
+  __d._M_w = 0;
+  __d._M_exp = 0;
+  __d._M_truncated = false;
+  __d._M_begin = __p;
+  __d._M_exp10 = 0;
+  unsigned __nd = 0;
+  const char *__digits = __p;
+  while (__p != __last && *__p == '0')
+    ++__p;
+  __p = __from_chars_mantissa(__p, __last, __d, __nd, false);
+  bool __any = __p != __digits;
+  if (__p != __last && *__p == '.')
+  {
+    const char *__frac = ++__p;
+    __p = __from_chars_mantissa(__p, __last, __d, __nd, true);
+    __any |= __p != __frac;
+  }
+  if (!__any)
+    return __res;
+  __d._M_end = __p;
+
+  if (__fmt != chars_format::fixed && __p != __last && (*__p | 0x20) == 'e')
+  {
+    const char *__q = __p + 1;
+    const bool __eneg = __q != __last && *__q == '-';
+    if (__q != __last && (*__q == '-' || *__q == '+'))
+      ++__q;
+    if (__q != __last && unsigned(*__q - '0') < 10)
+    {
+      long long __e = 0;
+      for (; __q != __last && unsigned(*__q - '0') < 10; ++__q)
+        if (__e < 100000000)
+          __e = __e * 10 + (*__q - '0');
+      __d._M_exp10 = __eneg ? -__e : __e;
+      __d._M_exp += __d._M_exp10;
+      __p = __q;
+    }
+    else if (__fmt == chars_format::scientific)
+      return __res;
+  }
+  else if (__fmt == chars_format::scientific)
+    return __res;
+
+  __res.ptr = __p;
+  const unsigned long long __bits = __from_chars_double(__d);
+  if ((__bits == 0 && __d._M_w != 0) || __bits == 0x7ffULL << 52)
+  {
+    __res.ec = errc::result_out_of_range;
+    return __res;
+  }
+  __cvt._M_bits = __sign | __bits;
+  __value = __cvt._M_value;
+  __res.ec = errc();
+  return __res;
+}
+
+} // namespace stl
+} // namespace aicuda
+
+#endif /* _AICUDA_STL_CHARCONV_H_ */
@@ -0,0 +1,448 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_CONCURRENT_HASH_MAP_H_
+#define _AICUDA_STL_CONCURRENT_HASH_MAP_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_allocator.h>
+#include <aicuda_stl_atomic.h>
+#include <aicuda_stl_hash.h>
+#include <aicuda_stl_type_traits.h>
+#include <assert.h>
+#include <stdio.h>
+
+namespace aicuda
+{
+namespace stl
+{
+
+// Reinterprets a key or mapped value of up to eight bytes as the word the
+// table stores.  Bytes above the value are zero.
+template <typename _Tp>
+union __concurrent_word
+{
+  _Tp _M_value;
+  unsigned long long _M_bits;
+};
+
+// Keeps the new value: insert_or_update's default update.
+template <typename _Tp>
+struct __concurrent_assign
+{
+  AICUDA_HD _Tp
+  operator()(const _Tp &, const _Tp &__v) const
+  {
+    return __v;
+  }
+};
+
+// Hash map that any number of host or device threads may insert into and
+// look up in at the same time, without locks.  Keys and mapped values are
+// word-sized trivially copyable types (integers, floats, pointers, enums);
+// keys compare by bit pattern.  Each slot is a key word followed by its
+// value word, and slots are probed linearly from the key's hash.
+//
+// A slot's key word moves one way only: from the empty key, claimed by a
+// compare-and-swap to a busy marker, to the key once its value is written.
+// Inserting the same key therefore never creates two slots, and a lookup
+// that sees a key also sees its value.  Updates of an existing value are a
+// compare-and-swap loop on the value word.  There is no erase.
+//
+// One key bit pattern is reserved to mark empty slots: all ones by default
+// (-1 for signed integers), or the one given to the constructor.  With
+// eight-byte keys, the empty key with its lowest bit flipped is reserved
+// too, as the busy marker; narrower keys use a bit above the key instead.
+//
+// The capacity is fixed between calls to reserve() and clear(), which, like
+// construction and destruction, must not overlap any other operation.  The
+// table is sized for a load factor of at most one half; inserting past its
+// capacity is an error.
+template <typename _Key, typename _Tp, typename _Hash = hash<_Key>,
+          typename _Alloc = aicuda::stl::allocator<unsigned long long>>
+class concurrent_hash_map
+{
+  // Both go through __concurrent_word into one compare-and-swap word.
+  static_assert(sizeof(_Key) <= sizeof(unsigned long long) &&
+                    sizeof(_Tp) <= sizeof(unsigned long long),
+                "concurrent_hash_map keys and values must fit in 8 bytes");
+  static_assert(__is_trivially_copyable_type<_Key>::__value &&
+                    __is_trivially_copyable_type<_Tp>::__value,
+                "concurrent_hash_map keys and values must be trivially "
+                "copyable");
+
+  typedef typename _Alloc::template rebind<unsigned long long>::other
+      _Word_allocator;
+
+public:
+  typedef _Key key_type;
+  typedef _Tp mapped_type;
+  typedef _Hash hasher;
+  typedef size_t size_type;
+  typedef _Alloc allocator_type;
+
+  enum
+  {
+    npos = static_cast<size_type>(-1)
+  };
+
+  AICUDA_HD explicit concurrent_hash_map(
+      size_type __n = 0, const hasher &__hf = hasher(),
+      const allocator_type &__a = allocator_type())
+      : _M_hash(__hf), _M_alloc(__a), _M_slots(0), _M_mask(0),
+        _M_empty(~0ULL >> (64 - 8 * sizeof(key_type))),
+        _M_busy(_S_busy(_M_empty))
+  {
+    _M_allocate(_S_capacity_for(__n));
+  }
+
+  AICUDA_HD concurrent_hash_map(size_type __n, const key_type &__empty_key,
+                                const hasher &__hf = hasher(),
+                                const allocator_type &__a = allocator_type())
+      : _M_hash(__hf), _M_alloc(__a), _M_slots(0), _M_mask(0),
+        _M_empty(_S_bits(__empty_key)), _M_busy(_S_busy(_M_empty))
+  {
+    _M_allocate(_S_capacity_for(__n));
+  }
+
+  AICUDA_HD ~concurrent_hash_map()
+  {
+    _M_alloc.deallocate(_M_slots, 2 * capacity());
+  }
+
+  AICUDA_HD allocator_type
+  get_allocator() const
+  {
+    return allocator_type(_M_alloc);
+  }
+
+  AICUDA_HD key_type
+  empty_key() const
+  {
+    return _S_key(_M_empty);
+  }
+
+  AICUDA_HD size_type
+  capacity() const
+  {
+    return _M_mask + 1;
+  }
+
+  // Counts the published keys by walking the table, so it is exact only
+  // while no insertion is in flight.
+  AICUDA_HD size_type
+  size() const
+  {
+    size_type __n = 0;
+    for (size_type __i = 0; __i <= _M_mask; ++__i)
+      __n += _M_published(__load_acquire(_M_slots + 2 * __i));
+    return __n;
+  }
+
+  AICUDA_HD bool
+  empty() const
+  {
+    return size() == 0;
+  }
+
+  AICUDA_HD float
+  load_factor() const
+  {
+    return float(size()) / float(capacity());
+  }
+
+  AICUDA_HD hasher
+  hash_function() const
+  {
+    return _M_hash;
+  }
+
+  // Inserts (__k, __v) unless __k is present; returns whether it did.
+  AICUDA_HD bool
+  insert(const key_type &__k, const mapped_type &__v)
+  {
+    bool __inserted;
+    _M_claim(__k, __v, __inserted);
+    return __inserted;
+  }
+
+  // Inserts (__k, __v), or replaces the value of a present __k with
+  // __op(old value, __v) atomically.  Returns whether __k was inserted.
+  template <typename _Op>
+  AICUDA_HD bool
+  insert_or_update(const key_type &__k, const mapped_type &__v, _Op __op)
+  {
+    bool __inserted;
+    const size_type __i = _M_claim(__k, __v, __inserted);
+    if (__inserted || __i == npos)
+      return __inserted;
+    unsigned long long *__w = _M_slots + 2 * __i + 1;
+    unsigned long long __old = __load_acquire(__w);
+    for (;;)
+    {
+      const unsigned long long __new =
+          _S_value_bits(__op(_S_value(__old), __v));
+      const unsigned long long __prev = __compare_and_swap(__w, __old, __new);
+      if (__prev == __old)
+        return false;
+      __old = __prev;
+    }
+  }
+
+  AICUDA_HD bool
+  insert_or_update(const key_type &__k, const mapped_type &__v)
+  {
+    return insert_or_assign(__k, __v);
+  }
+
+  AICUDA_HD bool
+  insert_or_assign(const key_type &__k, const mapped_type &__v)
+  {
+    bool __inserted;
+    const size_type __i = _M_claim(__k, __v, __inserted);
+    if (!__inserted && __i != npos)
+      __store_release(_M_slots + 2 * __i + 1, _S_value_bits(__v));
+    return __inserted;
+  }
+
+  // Copies the value of __k to __v and returns true, or returns false if
+  // __k is absent.  A key whose insertion has not finished is absent.
+  AICUDA_HD bool
+  find(const key_type &__k, mapped_type &__v) const
+  {
+    const size_type __i = _M_find(__k);
+    if (__i == npos)
+      return false;
+    __v = _S_value(__load_acquire(_M_slots + 2 * __i + 1));
+    return true;
+  }
+
+  AICUDA_HD bool
+  contains(const key_type &__k) const
+  {
+    return _M_find(__k) != npos;
+  }
+
+  AICUDA_HD size_type
+  count(const key_type &__k) const
+  {
+    return contains(__k);
+  }
+
+  // Calls __f(key, value) for every published entry, in slot order.
+  template <typename _Function>
+  AICUDA_HD void
+  for_each(_Function __f) const
+  {
+    for (size_type __i = 0; __i <= _M_mask; ++__i)
+    {
+      const unsigned long long __kb = __load_acquire(_M_slots + 2 * __i);
+      if (_M_published(__kb))
+        __f(_S_key(__kb), _S_value(__load_acquire(_M_slots + 2 * __i + 1)));
+    }
+  }
+
+  // Not concurrent: no other operation may overlap these two.
+  AICUDA_HD void
+  clear()
+  {
+    _M_reset(_M_slots, capacity());
+  }
+
+  // Regrows the table so that it holds __n elements at a load factor of at
+  // most one half, keeping its entries.
+  AICUDA_HD void
+  reserve(size_type __n)
+  {
+    const size_type __cap = _S_capacity_for(__n);
+    if (__cap <= capacity())
+      return;
+    unsigned long long *__old = _M_slots;
+    const size_type __old_cap = capacity();
+    _M_allocate(__cap);
+    for (size_type __i = 0; __i < __old_cap; ++__i)
+      if (_M_published(__old[2 * __i]))
+      {
+        bool __inserted;
+        _M_claim(_S_key(__old[2 * __i]), _S_value(__old[2 * __i + 1]),
+                 __inserted);
+      }
+    _M_alloc.deallocate(__old, 2 * __old_cap);
+  }
+
+private:
+  // Copying would share or duplicate a table other threads are writing.
+  concurrent_hash_map(const concurrent_hash_map &);
+  concurrent_hash_map &operator=(const concurrent_hash_map &);
+
+  template <typename _Vp>
+  AICUDA_HD static unsigned long long
+  _S_word(const _Vp &__v)
+  {
+    __concurrent_word<_Vp> __w;
+    __w._M_bits = 0;
+    __w._M_value = __v;
+    return __w._M_bits;
+  }
+
+  AICUDA_HD static unsigned long long
+  _S_bits(const key_type &__k)
+  {
+    return _S_word(__k);
+  }
+
+  AICUDA_HD static unsigned long long
+  _S_value_bits(const mapped_type &__v)
+  {
+    return _S_word(__v);
+  }
+
+  AICUDA_HD static key_type
+  _S_key(unsigned long long __b)
+  {
+    __concurrent_word<key_type> __w;
+    __w._M_bits = __b;
+    return __w._M_value;
+  }
+
+  AICUDA_HD static mapped_type
+  _S_value(unsigned long long __b)
+  {
+    __concurrent_word<mapped_type> __w;
+    __w._M_bits = __b;
+    return __w._M_value;
+  }
+
+  AICUDA_HD static unsigned long long
+  _S_busy(unsigned long long __empty)
+  {
+    return sizeof(key_type) < 8 ? 1ULL << 63 : __empty ^ 1;
+  }
+
+  AICUDA_HD bool
+  _M_published(unsigned long long __kb) const
+  {
+    return __kb != _M_empty && __kb != _M_busy;
+  }
+
+  AICUDA_HD static size_type
+  _S_capacity_for(size_type __n)
+  {
+    size_type __cap = 16;
+    while (__cap < 2 * __n)
+      __cap <<= 1;
+    return __cap;
+  }
+
+  AICUDA_HD void
+  _M_reset(unsigned long long *__slots, size_type __cap)
+  {
+    for (size_type __i = 0; __i < __cap; ++__i)
+    {
+      __slots[2 * __i] = _M_empty;
+      __slots[2 * __i + 1] = 0;
+    }
+  }
+
+  AICUDA_HD void
+  _M_allocate(size_type __cap)
+  {
+    _M_slots = _M_alloc.allocate(2 * __cap);
+    _M_mask = __cap - 1;
+    _M_reset(_M_slots, __cap);
+  }
+
+  // Index of the slot holding __k, or npos.  A busy slot ends the probe
+  // like an empty one: the key being published there is either __k, whose
+  // insertion has not finished, or another key, in which case __k was never
+  // inserted past it.
+  AICUDA_HD size_type
+  _M_find(const key_type &__k) const
+  {
+    const unsigned long long __kb = _S_bits(__k);
+    size_type __i = _M_hash(__k) & _M_mask;
+    for (size_type __n = 0; __n <= _M_mask; ++__n, __i = (__i + 1) & _M_mask)
+    {
+      const unsigned long long __cur = __load_acquire(_M_slots + 2 * __i);
+      if (__cur == __kb)
+        return __i;
+      if (__cur == _M_empty || __cur == _M_busy)
+        return npos;
+    }
+    return npos;
+  }
+
+  // Index of the slot holding __k, claiming an empty one for (__k, __v) if
+  // __k is absent.  A thread that meets a busy slot waits for its key: it
+  // may be __k.
+  AICUDA_HD size_type
+  _M_claim(const key_type &__k, const mapped_type &__v, bool &__inserted)
+  {
+    __inserted = false;
+    const unsigned long long __kb = _S_bits(__k);
+    if (__kb == _M_empty || __kb == _M_busy)
+    {
+      printf("concurrent_hash_map: key %llx is reserved\n", __kb);
+      assert(1 < 0);
+      return npos;
+    }
+    size_type __i = _M_hash(__k) & _M_mask;
+    for (size_type __n = 0; __n <= _M_mask; ++__n, __i = (__i + 1) & _M_mask)
+    {
+      unsigned long long *__slot = _M_slots + 2 * __i;
+      unsigned long long __cur = __load_acquire(__slot);
+      if (__cur == _M_empty)
+      {
+        __cur = __compare_and_swap(__slot, _M_empty, _M_busy);
+        if (__cur == _M_empty)
+        {
+          __slot[1] = _S_value_bits(__v);
+          __store_release(__slot, __kb);
+          __inserted = true;
+          return __i;
+        }
+      }
+      while (__cur == _M_busy)
+        __cur = __load_acquire(__slot);
+      if (__cur == __kb)
+        return __i;
+    }
+    printf("concurrent_hash_map: table is full (capacity %llu)\n",
+           (unsigned long long)capacity());
+    assert(1 < 0);
+    return npos;
+  }
+
+  hasher _M_hash;
+  _Word_allocator _M_alloc;
+  unsigned long long *_M_slots;
+  size_type _M_mask;
+  unsigned long long _M_empty;
+  unsigned long long _M_busy;
+};
+
+} // namespace stl
+} // namespace aicuda
+
+#endif /* _AICUDA_STL_CONCURRENT_HASH_MAP_H_ */
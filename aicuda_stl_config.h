@@ -0,0 +1,73 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_CONFIG_H_
+#define _AICUDA_STL_CONFIG_H_ 1
+
+// AICUDA_HD qualifies every function in the library.  Under nvcc it expands
+// to __host__ __device__; with a plain host compiler it expands to nothing so
+// the containers build, test and benchmark on machines without a GPU.
+// printf, assert and operator new come from the CUDA runtime on the device
+// and from the headers below on the host.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <new>
+
+#if defined(__CUDACC__)
+#define AICUDA_HD __host__ __device__
+#else
+#define AICUDA_HD
+#endif
+
+// Set on the device pass of nvcc; device-only intrinsics branch on it.
+#if defined(__CUDA_ARCH__)
+#define AICUDA_DEVICE_CODE 1
+#else
+#define AICUDA_DEVICE_CODE 0
+#endif
+
+// Marks word types used to read and write memory of any object type, so the
+// wide string_op loops do not break strict aliasing.
+#if defined(__GNUC__) || defined(__clang__)
+#define AICUDA_MAY_ALIAS __attribute__((__may_alias__))
+#else
+#define AICUDA_MAY_ALIAS
+#endif
+
+// Word-at-a-time string scans read whole aligned words that may straddle the
+// terminator.  That never crosses a page, but AddressSanitizer reports it.
+#if defined(__SANITIZE_ADDRESS__)
+#define AICUDA_NO_SANITIZE_ADDRESS __attribute__((__no_sanitize_address__))
+#elif defined(__clang__) && defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define AICUDA_NO_SANITIZE_ADDRESS __attribute__((__no_sanitize_address__))
+#endif
+#endif
+#ifndef AICUDA_NO_SANITIZE_ADDRESS
+#define AICUDA_NO_SANITIZE_ADDRESS
+#endif
+
+#endif /* _AICUDA_STL_CONFIG_H_ */
@@ -25,6 +25,7 @@
 #ifndef _AICUDA_STL_CONSTRUCT_H_
 #define _AICUDA_STL_CONSTRUCT_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <aicuda_stl_type_traits.h>
 
 namespace aicuda
@@ -33,14 +34,14 @@ namespace stl
 {
 
 template <typename _T1, typename _T2>
-__device__ inline void
+AICUDA_HD inline void
 _Construct(_T1 *__p, const _T2 &__value)
 {
   ::new (static_cast<void *>(__p)) _T1(__value);
 }
 
 template <typename _Tp>
-__device__ inline void
+AICUDA_HD inline void
 _Destroy(_Tp *__pointer)
 {
   __pointer->~_Tp();
@@ -50,7 +51,7 @@ template <bool>
 struct _Destroy_aux
 {
   template <typename _ForwardIterator>
-  __device__ static void
+  AICUDA_HD static void
   __destroy(_ForwardIterator __first, _ForwardIterator __last)
   {
     for (; __first != __last; ++__first)
@@ -62,7 +63,7 @@ template <>
 struct _Destroy_aux<true>
 {
   template <typename _ForwardIterator>
-  __device__ static void
+  AICUDA_HD static void
       __destroy(_ForwardIterator, _ForwardIterator) {}
 };
 
@@ -70,7 +71,7 @@ template <typename _Iterator>
 struct iterator_traits;
 
 template <typename _ForwardIterator>
-__device__ inline void
+AICUDA_HD inline void
 _Destroy(_ForwardIterator __first, _ForwardIterator __last)
 {
   typedef typename iterator_traits<_ForwardIterator>::value_type
@@ -83,15 +84,15 @@ template <typename _Tp>
 class allocator;
 
 template <typename _ForwardIterator, typename _Allocator>
-__device__ void _Destroy(_ForwardIterator __first, _ForwardIterator __last,
-                         _Allocator &__alloc)
+AICUDA_HD void _Destroy(_ForwardIterator __first, _ForwardIterator __last,
+                        _Allocator &__alloc)
 {
   for (; __first != __last; ++__first)
     __alloc.destroy(&*__first);
 }
 
 template <typename _ForwardIterator, typename _Tp>
-__device__ inline void
+AICUDA_HD inline void
 _Destroy(_ForwardIterator __first, _ForwardIterator __last,
          aicuda::stl::allocator<_Tp> &)
 {
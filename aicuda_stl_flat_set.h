@@ -0,0 +1,195 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_FLAT_SET_H_
+#define _AICUDA_STL_FLAT_SET_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_flat_tree.h>
+#include <assert.h>
+
+namespace aicuda {
+namespace stl {
+
+// set over a sorted vector (see _Flat_tree).  Inserting or erasing
+// invalidates iterators, and single-element insert and erase are linear.
+template <typename _Key, typename _Compare = aicuda::stl::less<_Key>,
+          typename _Alloc = aicuda::stl::allocator<_Key>>
+class flat_set {
+ public:
+  typedef _Key key_type;
+  typedef _Key value_type;
+  typedef _Compare key_compare;
+  typedef _Compare value_compare;
+  typedef _Alloc allocator_type;
+
+ private:
+  typedef typename _Alloc::template rebind<_Key>::other _Key_alloc_type;
+
+  typedef _Flat_tree<key_type, value_type, _Identity<value_type>, key_compare,
+                     _Key_alloc_type>
+      _Rep_type;
+  _Rep_type _M_t;
+
+ public:
+  typedef typename _Rep_type::const_pointer pointer;
+  typedef typename _Rep_type::const_pointer const_pointer;
+  typedef typename _Rep_type::const_reference reference;
+  typedef typename _Rep_type::const_reference const_reference;
+  typedef typename _Rep_type::const_iterator iterator;
+  typedef typename _Rep_type::const_iterator const_iterator;
+  typedef typename _Rep_type::const_reverse_iterator reverse_iterator;
+  typedef typename _Rep_type::const_reverse_iterator const_reverse_iterator;
+  typedef typename _Rep_type::size_type size_type;
+  typedef typename _Rep_type::difference_type difference_type;
+
+  AICUDA_HD flat_set() : _M_t() {}
+
+  AICUDA_HD explicit flat_set(const _Compare &__comp,
+                              const allocator_type &__a = allocator_type())
+      : _M_t(__comp, __a) {}
+
+  // Bulk construction: one sort of the input, then duplicates are dropped.
+  // Sorted input is not re-sorted.
+  template <typename _InputIterator>
+  AICUDA_HD flat_set(_InputIterator __first, _InputIterator __last) : _M_t() {
+    _M_t._M_insert_unique(__first, __last);
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD flat_set(_InputIterator __first, _InputIterator __last,
+                     const _Compare &__comp,
+                     const allocator_type &__a = allocator_type())
+      : _M_t(__comp, __a) {
+    _M_t._M_insert_unique(__first, __last);
+  }
+
+  AICUDA_HD key_compare key_comp() const { return _M_t.key_comp(); }
+
+  AICUDA_HD value_compare value_comp() const { return _M_t.key_comp(); }
+
+  AICUDA_HD allocator_type get_allocator() const {
+    return _M_t.get_allocator();
+  }
+
+  AICUDA_HD iterator begin() const { return _M_t.begin(); }
+
+  AICUDA_HD iterator end() const { return _M_t.end(); }
+
+  AICUDA_HD reverse_iterator rbegin() const { return _M_t.rbegin(); }
+
+  AICUDA_HD reverse_iterator rend() const { return _M_t.rend(); }
+
+  AICUDA_HD bool empty() const { return _M_t.empty(); }
+
+  AICUDA_HD size_type size() const { return _M_t.size(); }
+
+  AICUDA_HD size_type max_size() const { return _M_t.max_size(); }
+
+  AICUDA_HD size_type capacity() const { return _M_t.capacity(); }
+
+  AICUDA_HD void reserve(size_type __n) { _M_t.reserve(__n); }
+
+  AICUDA_HD void swap(flat_set &__x) { _M_t.swap(__x._M_t); }
+
+  AICUDA_HD aicuda::stl::pair<iterator, bool> insert(const value_type &__x) {
+    aicuda::stl::pair<typename _Rep_type::iterator, bool> __p =
+        _M_t._M_insert_unique(__x);
+    return aicuda::stl::pair<iterator, bool>(__p.first, __p.second);
+  }
+
+  AICUDA_HD iterator insert(iterator __position, const value_type &__x) {
+    return _M_t._M_insert_unique_(__position, __x);
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD void insert(_InputIterator __first, _InputIterator __last) {
+    _M_t._M_insert_unique(__first, __last);
+  }
+
+  AICUDA_HD iterator erase(iterator __position) {
+    return _M_t.erase(__position);
+  }
+
+  AICUDA_HD size_type erase(const key_type &__x) { return _M_t.erase(__x); }
+
+  AICUDA_HD iterator erase(iterator __first, iterator __last) {
+    return _M_t.erase(__first, __last);
+  }
+
+  AICUDA_HD void clear() { _M_t.clear(); }
+
+  AICUDA_HD size_type count(const key_type &__x) const {
+    return _M_t.count(__x);
+  }
+
+  AICUDA_HD iterator find(const key_type &__x) const { return _M_t.find(__x); }
+
+  AICUDA_HD iterator lower_bound(const key_type &__x) const {
+    return _M_t.lower_bound(__x);
+  }
+
+  AICUDA_HD iterator upper_bound(const key_type &__x) const {
+    return _M_t.upper_bound(__x);
+  }
+
+  AICUDA_HD aicuda::stl::pair<iterator, iterator> equal_range(
+     const key_type &__x) const {
+    return _M_t.equal_range(__x);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  find(const _Kt &__x) const { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, size_type>::__type
+  count(const _Kt &__x) const {
+    return _M_t._M_find_tr(__x) == _M_t.end() ? 0 : 1;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  lower_bound(const _Kt &__x) const { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  upper_bound(const _Kt &__x) const { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt, aicuda::stl::pair<iterator, iterator>>::__type
+  equal_range(const _Kt &__x) const { return _M_t._M_equal_range_tr(__x); }
+};
+
+template <typename _Key, typename _Compare, typename _Alloc>
+AICUDA_HD inline void swap(flat_set<_Key, _Compare, _Alloc> &__x,
+                           flat_set<_Key, _Compare, _Alloc> &__y) {
+  __x.swap(__y);
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_FLAT_SET_H_ */
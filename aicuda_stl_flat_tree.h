@@ -0,0 +1,557 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_FLAT_TREE_H_
+#define _AICUDA_STL_FLAT_TREE_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_function.h>
+#include <aicuda_stl_pair.h>
+#include <aicuda_stl_tree.h>
+#include <aicuda_stl_vector.h>
+
+namespace aicuda
+{
+namespace stl
+{
+
+// Stable bottom-up merge sort of __a[0, __n), using __buf as scratch space
+// of the same size: insertion-sorted runs of sixteen, then merge passes
+// that alternate between the two arrays.  It does not recurse, so it suits
+// device threads with small stacks.
+template <typename _Tp, typename _Compare>
+AICUDA_HD void
+__flat_sort(_Tp *__a, _Tp *__buf, size_t __n, _Compare __comp)
+{
+  const size_t __run = 16;
+  for (size_t __lo = 0; __lo < __n; __lo += __run)
+  {
+    const size_t __hi = __n - __lo < __run ? __n : __lo + __run;
+    for (size_t __i = __lo + 1; __i < __hi; ++__i)
+    {
+      if (!__comp(__a[__i], __a[__i - 1]))
+        continue;
+      _Tp __x = __a[__i];
+      size_t __j = __i;
+      do
+      {
+        __a[__j] = __a[__j - 1];
+        --__j;
+      } while (__j > __lo && __comp(__x, __a[__j - 1]));
+      __a[__j] = __x;
+    }
+  }
+  _Tp *__src = __a;
+  _Tp *__dst = __buf;
+  for (size_t __w = __run; __w < __n; __w *= 2)
+  {
+    for (size_t __lo = 0; __lo < __n; __lo += 2 * __w)
+    {
+      const size_t __mid = __n - __lo < __w ? __n : __lo + __w;
+      const size_t __hi = __n - __mid < __w ? __n : __mid + __w;
+      size_t __i = __lo, __j = __mid, __k = __lo;
+      while (__i < __mid && __j < __hi)
+        __dst[__k++] = __comp(__src[__j], __src[__i]) ? __src[__j++]
+                                                      : __src[__i++];
+      while (__i < __mid)
+        __dst[__k++] = __src[__i++];
+      while (__j < __hi)
+        __dst[__k++] = __src[__j++];
+    }
+    aicuda::stl::swap(__src, __dst);
+  }
+  if (__src != __a)
+    for (size_t __i = 0; __i < __n; ++__i)
+      __a[__i] = __src[__i];
+}
+
+// Sorted-vector storage behind flat_map and flat_set: the elements sit in
+// one contiguous array ordered by key, with no per-element overhead, and a
+// lookup is a binary search over it.  Inserting or erasing one element
+// shifts the elements after it, so the layout suits tables that are built
+// in bulk and then mostly read.  Bulk construction and range insertion
+// sort the new elements once and merge them in; duplicate keys keep the
+// element that came first, as with map.
+//
+// Elements are stored as _Val, which must be assignable: flat_map stores
+// pair<_Key, _Tp> rather than pair<const _Key, _Tp>.
+template <typename _Key, typename _Val, typename _KeyOfValue,
+          typename _Compare, typename _Alloc = aicuda::stl::allocator<_Val>>
+class _Flat_tree
+{
+  typedef aicuda::stl::vector<_Val, _Alloc> _Rep_type;
+
+  // Orders elements by key, for the sort.
+  struct _Value_compare
+  {
+    _Compare _M_comp;
+
+    AICUDA_HD _Value_compare(const _Compare &__c)
+        : _M_comp(__c) {}
+
+    AICUDA_HD bool
+    operator()(const _Val &__x, const _Val &__y) const
+    {
+      return _M_comp(_KeyOfValue()(__x), _KeyOfValue()(__y));
+    }
+  };
+
+public:
+  typedef _Key key_type;
+  typedef _Val value_type;
+  typedef typename _Rep_type::pointer pointer;
+  typedef typename _Rep_type::const_pointer const_pointer;
+  typedef typename _Rep_type::reference reference;
+  typedef typename _Rep_type::const_reference const_reference;
+  typedef typename _Rep_type::iterator iterator;
+  typedef typename _Rep_type::const_iterator const_iterator;
+  typedef typename _Rep_type::reverse_iterator reverse_iterator;
+  typedef typename _Rep_type::const_reverse_iterator const_reverse_iterator;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Alloc allocator_type;
+
+  AICUDA_HD _Flat_tree()
+      : _M_comp(), _M_v() {}
+
+  AICUDA_HD _Flat_tree(const _Compare &__comp,
+                       const allocator_type &__a = allocator_type())
+      : _M_comp(__comp), _M_v(__a) {}
+
+  AICUDA_HD allocator_type
+  get_allocator() const
+  {
+    return _M_v.get_allocator();
+  }
+
+  AICUDA_HD _Compare
+  key_comp() const
+  {
+    return _M_comp;
+  }
+
+  AICUDA_HD iterator
+  begin()
+  {
+    return _M_v.begin();
+  }
+
+  AICUDA_HD const_iterator
+  begin() const
+  {
+    return _M_v.begin();
+  }
+
+  AICUDA_HD iterator
+  end()
+  {
+    return _M_v.end();
+  }
+
+  AICUDA_HD const_iterator
+  end() const
+  {
+    return _M_v.end();
+  }
+
+  AICUDA_HD reverse_iterator
+  rbegin()
+  {
+    return _M_v.rbegin();
+  }
+
+  AICUDA_HD const_reverse_iterator
+  rbegin() const
+  {
+    return _M_v.rbegin();
+  }
+
+  AICUDA_HD reverse_iterator
+  rend()
+  {
+    return _M_v.rend();
+  }
+
+  AICUDA_HD const_reverse_iterator
+  rend() const
+  {
+    return _M_v.rend();
+  }
+
+  AICUDA_HD bool
+  empty() const
+  {
+    return _M_v.empty();
+  }
+
+  AICUDA_HD size_type
+  size() const
+  {
+    return _M_v.size();
+  }
+
+  AICUDA_HD size_type
+  max_size() const
+  {
+    return _M_v.max_size();
+  }
+
+  AICUDA_HD size_type
+  capacity() const
+  {
+    return _M_v.capacity();
+  }
+
+  AICUDA_HD void
+  reserve(size_type __n)
+  {
+    _M_v.reserve(__n);
+  }
+
+  AICUDA_HD void
+  swap(_Flat_tree &__x)
+  {
+    aicuda::stl::swap(_M_comp, __x._M_comp);
+    _M_v.swap(__x._M_v);
+  }
+
+  AICUDA_HD void
+  clear()
+  {
+    _M_v.clear();
+  }
+
+  AICUDA_HD pair<iterator, bool>
+  _M_insert_unique(const value_type &__v)
+  {
+    const key_type &__k = _KeyOfValue()(__v);
+    iterator __pos = _M_at(_M_lower_bound(__k));
+    if (__pos != end() && !_M_comp(__k, _KeyOfValue()(*__pos)))
+      return pair<iterator, bool>(__pos, false);
+    return pair<iterator, bool>(_M_v.insert(__pos, __v), true);
+  }
+
+  // Inserts at __position when __v belongs right before it, which makes
+  // appending in key order a constant-time step; otherwise searches.
+  AICUDA_HD iterator
+  _M_insert_unique_(const_iterator __position, const value_type &__v)
+  {
+    const key_type &__k = _KeyOfValue()(__v);
+    iterator __pos = _M_at(__position.base());
+    if ((__pos == end() || _M_comp(__k, _KeyOfValue()(*__pos)))
+        && (__pos == begin() || _M_comp(_KeyOfValue()(*(__pos - 1)), __k)))
+      return _M_v.insert(__pos, __v);
+    return _M_insert_unique(__v).first;
+  }
+
+  // Gathers [__first, __last) into a separate vector, sorts it and merges
+  // it into the old elements: O(m log m + n) for m new and n old elements.
+  // The range may come from this container, so nothing in _M_v moves
+  // before it has been read.
+  template <typename _InputIterator>
+  AICUDA_HD void
+  _M_insert_unique(_InputIterator __first, _InputIterator __last)
+  {
+    _Rep_type __new(get_allocator());
+    for (; __first != __last; ++__first)
+      __new.push_back(*__first);
+    const size_type __n = __new.size();
+    if (!__n)
+      return;
+    value_type *__b = __new.data();
+    if (!_M_is_sorted(__b, __n))
+    {
+      _Rep_type __buf(__new.begin(), __new.end(), get_allocator());
+      __flat_sort(__b, __buf.data(), __n, _Value_compare(_M_comp));
+    }
+    const size_type __m = _M_unique(__b, __n);
+    const size_type __old = size();
+    if (!__old)
+    {
+      __new.erase(__new.begin() + __m, __new.end());
+      _M_v.swap(__new);
+      return;
+    }
+    const value_type *__a = _M_v.data();
+    if (_M_comp(_KeyOfValue()(__a[__old - 1]), _KeyOfValue()(*__b)))
+    {
+      _M_v.insert(_M_v.end(), __new.begin(), __new.begin() + __m);
+      return;
+    }
+    // Merge the two sorted runs, dropping new elements whose key is
+    // already present.
+    _Rep_type __merged(get_allocator());
+    __merged.reserve(__old + __m);
+    size_type __i = 0, __j = 0;
+    while (__i < __old && __j < __m)
+    {
+      if (_M_comp(_KeyOfValue()(__b[__j]), _KeyOfValue()(__a[__i])))
+        __merged.push_back(__b[__j++]);
+      else
+      {
+        if (!_M_comp(_KeyOfValue()(__a[__i]), _KeyOfValue()(__b[__j])))
+          ++__j;
+        __merged.push_back(__a[__i++]);
+      }
+    }
+    for (; __i < __old; ++__i)
+      __merged.push_back(__a[__i]);
+    for (; __j < __m; ++__j)
+      __merged.push_back(__b[__j]);
+    _M_v.swap(__merged);
+  }
+
+  AICUDA_HD iterator
+  erase(const_iterator __position)
+  {
+    return _M_v.erase(_M_at(__position.base()));
+  }
+
+  AICUDA_HD size_type
+  erase(const key_type &__k)
+  {
+    const_iterator __pos = find(__k);
+    if (__pos == end())
+      return 0;
+    erase(__pos);
+    return 1;
+  }
+
+  AICUDA_HD iterator
+  erase(const_iterator __first, const_iterator __last)
+  {
+    return _M_v.erase(_M_at(__first.base()), _M_at(__last.base()));
+  }
+
+  AICUDA_HD iterator
+  find(const key_type &__k)
+  {
+    return _M_at(_M_find(__k));
+  }
+
+  AICUDA_HD const_iterator
+  find(const key_type &__k) const
+  {
+    return const_iterator(_M_find(__k));
+  }
+
+  AICUDA_HD size_type
+  count(const key_type &__k) const
+  {
+    return _M_find(__k) != _M_v.data() + size();
+  }
+
+  AICUDA_HD iterator
+  lower_bound(const key_type &__k)
+  {
+    return _M_at(_M_lower_bound(__k));
+  }
+
+  AICUDA_HD const_iterator
+  lower_bound(const key_type &__k) const
+  {
+    return const_iterator(_M_lower_bound(__k));
+  }
+
+  AICUDA_HD iterator
+  upper_bound(const key_type &__k)
+  {
+    return _M_at(_M_upper_bound(__k));
+  }
+
+  AICUDA_HD const_iterator
+  upper_bound(const key_type &__k) const
+  {
+    return const_iterator(_M_upper_bound(__k));
+  }
+
+  AICUDA_HD pair<iterator, iterator>
+  equal_range(const key_type &__k)
+  {
+    iterator __lo = lower_bound(__k);
+    iterator __hi = __lo;
+    if (__hi != end() && !_M_comp(__k, _KeyOfValue()(*__hi)))
+      ++__hi;
+    return pair<iterator, iterator>(__lo, __hi);
+  }
+
+  AICUDA_HD pair<const_iterator, const_iterator>
+  equal_range(const key_type &__k) const
+  {
+    const_iterator __lo = lower_bound(__k);
+    const_iterator __hi = __lo;
+    if (__hi != end() && !_M_comp(__k, _KeyOfValue()(*__hi)))
+      ++__hi;
+    return pair<const_iterator, const_iterator>(__lo, __hi);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_find_tr(const _Kt &__k)
+  {
+    return _M_at(_M_find(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD const_iterator
+  _M_find_tr(const _Kt &__k) const
+  {
+    return const_iterator(_M_find(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_lower_bound_tr(const _Kt &__k)
+  {
+    return _M_at(_M_lower_bound(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD const_iterator
+  _M_lower_bound_tr(const _Kt &__k) const
+  {
+    return const_iterator(_M_lower_bound(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_upper_bound_tr(const _Kt &__k)
+  {
+    return _M_at(_M_upper_bound(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD const_iterator
+  _M_upper_bound_tr(const _Kt &__k) const
+  {
+    return const_iterator(_M_upper_bound(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD pair<iterator, iterator>
+  _M_equal_range_tr(const _Kt &__k)
+  {
+    return pair<iterator, iterator>(_M_lower_bound_tr(__k),
+                                    _M_upper_bound_tr(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD pair<const_iterator, const_iterator>
+  _M_equal_range_tr(const _Kt &__k) const
+  {
+    return pair<const_iterator, const_iterator>(_M_lower_bound_tr(__k),
+                                                _M_upper_bound_tr(__k));
+  }
+
+private:
+  AICUDA_HD iterator
+  _M_at(const value_type *__p)
+  {
+    return begin() + (__p - _M_v.data());
+  }
+
+  // Branch-free binary search: the loop runs log2(size) times whatever the
+  // keys, and the compiler turns the step into a conditional move, so
+  // lookups do not stall on mispredicted branches and neighbouring device
+  // threads do not diverge.
+  template <typename _Kt>
+  AICUDA_HD const value_type *
+  _M_lower_bound(const _Kt &__k) const
+  {
+    const value_type *__base = _M_v.data();
+    size_type __n = size();
+    if (!__n)
+      return __base;
+    while (__n > 1)
+    {
+      const size_type __half = __n / 2;
+      __base = _M_comp(_KeyOfValue()(__base[__half - 1]), __k)
+                   ? __base + __half
+                   : __base;
+      __n -= __half;
+    }
+    return __base + _M_comp(_KeyOfValue()(*__base), __k);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD const value_type *
+  _M_upper_bound(const _Kt &__k) const
+  {
+    const value_type *__base = _M_v.data();
+    size_type __n = size();
+    if (!__n)
+      return __base;
+    while (__n > 1)
+    {
+      const size_type __half = __n / 2;
+      __base = _M_comp(__k, _KeyOfValue()(__base[__half - 1]))
+                   ? __base
+                   : __base + __half;
+      __n -= __half;
+    }
+    return __base + !_M_comp(__k, _KeyOfValue()(*__base));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD const value_type *
+  _M_find(const _Kt &__k) const
+  {
+    const value_type *__end = _M_v.data() + size();
+    const value_type *__p = _M_lower_bound(__k);
+    return __p == __end || _M_comp(__k, _KeyOfValue()(*__p)) ? __end : __p;
+  }
+
+  AICUDA_HD bool
+  _M_is_sorted(const value_type *__a, size_type __n) const
+  {
+    for (size_type __i = 1; __i < __n; ++__i)
+      if (_M_comp(_KeyOfValue()(__a[__i]), _KeyOfValue()(__a[__i - 1])))
+        return false;
+    return true;
+  }
+
+  // Moves the first element of every run of equal keys in the sorted
+  // __a[0, __n) to the front; returns how many there are.
+  AICUDA_HD size_type
+  _M_unique(value_type *__a, size_type __n) const
+  {
+    size_type __m = 1;
+    for (size_type __i = 1; __i < __n; ++__i)
+      if (_M_comp(_KeyOfValue()(__a[__m - 1]), _KeyOfValue()(__a[__i])))
+      {
+        if (__m != __i)
+          __a[__m] = __a[__i];
+        ++__m;
+      }
+    return __m;
+  }
+
+  _Compare _M_comp;
+  _Rep_type _M_v;
+};
+
+} // namespace stl
+} // namespace aicuda
+
+#endif /* _AICUDA_STL_FLAT_TREE_H_ */
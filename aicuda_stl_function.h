@@ -25,6 +25,7 @@
 #ifndef _AICUDA_STL_FUNCTION_H_
 #define _AICUDA_STL_FUNCTION_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <aicuda_stl_memory.h>
 #include <aicuda_stl_type_traits.h>
 
@@ -46,27 +47,65 @@ struct binary_function {
 
 template <typename _Tp>
 struct greater : public binary_function<_Tp, _Tp, bool> {
-  __device__ bool operator()(const _Tp &__x, const _Tp &__y) const {
+  AICUDA_HD bool operator()(const _Tp &__x, const _Tp &__y) const {
     return __x > __y;
   }
 };
 
-template <typename _Tp>
+template <typename _Tp = void>
 struct less : public binary_function<_Tp, _Tp, bool> {
-  __device__ bool operator()(const _Tp &__x, const _Tp &__y) const {
+  AICUDA_HD bool operator()(const _Tp &__x, const _Tp &__y) const {
+    return __x < __y;
+  }
+};
+
+// Transparent less<>: compares mixed argument types directly, which lets
+// map/set look up a string key by string_view or const char * without
+// materializing a temporary key.
+template <>
+struct less<void> {
+  typedef void is_transparent;
+
+  template <typename _Tp, typename _Up>
+  AICUDA_HD bool operator()(const _Tp &__x, const _Up &__y) const {
     return __x < __y;
   }
 };
 
+template <typename _Tp = void>
+struct equal_to : public binary_function<_Tp, _Tp, bool> {
+  AICUDA_HD bool operator()(const _Tp &__x, const _Tp &__y) const {
+    return __x == __y;
+  }
+};
+
+// Transparent equal_to<>, the hashed containers' counterpart of less<>.
+template <>
+struct equal_to<void> {
+  typedef void is_transparent;
+
+  template <typename _Tp, typename _Up>
+  AICUDA_HD bool operator()(const _Tp &__x, const _Up &__y) const {
+    return __x == __y;
+  }
+};
+
 template <typename _Tp>
-__device__ inline void swap(_Tp &__a, _Tp &__b) {
+struct plus : public binary_function<_Tp, _Tp, _Tp> {
+  AICUDA_HD _Tp operator()(const _Tp &__x, const _Tp &__y) const {
+    return __x + __y;
+  }
+};
+
+template <typename _Tp>
+AICUDA_HD inline void swap(_Tp &__a, _Tp &__b) {
   _Tp __tmp = (__a);
   __a = (__b);
   __b = (__tmp);
 }
 
 template <typename _Tp, size_t _Nm>
-__device__ inline void swap(_Tp (&__a)[_Nm], _Tp (&__b)[_Nm]) {
+AICUDA_HD inline void swap(_Tp (&__a)[_Nm], _Tp (&__b)[_Nm]) {
   for (size_t __n = 0; __n < _Nm; ++__n) swap(__a[__n], __b[__n]);
 }
 
@@ -76,8 +115,8 @@ struct iterator_traits;
 template <bool _BoolType>
 struct __iter_swap {
   template <typename _ForwardIterator1, typename _ForwardIterator2>
-  __device__ static void iter_swap(_ForwardIterator1 __a,
-                                   _ForwardIterator2 __b) {
+  AICUDA_HD static void iter_swap(_ForwardIterator1 __a,
+                                  _ForwardIterator2 __b) {
     typedef typename iterator_traits<_ForwardIterator1>::value_type _ValueType1;
     _ValueType1 __tmp = (*__a);
     *__a = (*__b);
@@ -88,14 +127,14 @@ struct __iter_swap {
 template <>
 struct __iter_swap<true> {
   template <typename _ForwardIterator1, typename _ForwardIterator2>
-  __device__ static void iter_swap(_ForwardIterator1 __a,
-                                   _ForwardIterator2 __b) {
+  AICUDA_HD static void iter_swap(_ForwardIterator1 __a,
+                                  _ForwardIterator2 __b) {
     swap(*__a, *__b);
   }
 };
 
 template <typename _ForwardIterator1, typename _ForwardIterator2>
-__device__ inline void iter_swap(_ForwardIterator1 __a, _ForwardIterator2 __b) {
+AICUDA_HD inline void iter_swap(_ForwardIterator1 __a, _ForwardIterator2 __b) {
   typedef typename iterator_traits<_ForwardIterator1>::value_type _ValueType1;
   typedef typename iterator_traits<_ForwardIterator2>::value_type _ValueType2;
 
@@ -111,36 +150,36 @@ __device__ inline void iter_swap(_ForwardIterator1 __a, _ForwardIterator2 __b) {
 }
 
 template <typename _ForwardIterator1, typename _ForwardIterator2>
-__device__ _ForwardIterator2 swap_ranges(_ForwardIterator1 __first1,
-                                         _ForwardIterator1 __last1,
-                                         _ForwardIterator2 __first2) {
+AICUDA_HD _ForwardIterator2 swap_ranges(_ForwardIterator1 __first1,
+                                        _ForwardIterator1 __last1,
+                                        _ForwardIterator2 __first2) {
   for (; __first1 != __last1; ++__first1, ++__first2)
     aicuda::stl::iter_swap(__first1, __first2);
   return __first2;
 }
 
 template <typename _Tp>
-__device__ inline const _Tp &min(const _Tp &__a, const _Tp &__b) {
+AICUDA_HD inline const _Tp &min(const _Tp &__a, const _Tp &__b) {
   if (__b < __a) return __b;
   return __a;
 }
 
 template <typename _Tp>
-__device__ inline const _Tp &max(const _Tp &__a, const _Tp &__b) {
+AICUDA_HD inline const _Tp &max(const _Tp &__a, const _Tp &__b) {
   if (__a < __b) return __b;
   return __a;
 }
 
 template <typename _Tp, typename _Compare>
-__device__ inline const _Tp &min(const _Tp &__a, const _Tp &__b,
-                                 _Compare __comp) {
+AICUDA_HD inline const _Tp &min(const _Tp &__a, const _Tp &__b,
+                                _Compare __comp) {
   if (__comp(__b, __a)) return __b;
   return __a;
 }
 
 template <typename _Tp, typename _Compare>
-__device__ inline const _Tp &max(const _Tp &__a, const _Tp &__b,
-                                 _Compare __comp) {
+AICUDA_HD inline const _Tp &max(const _Tp &__a, const _Tp &__b,
+                                _Compare __comp) {
   if (__comp(__a, __b)) return __b;
   return __a;
 }
@@ -148,12 +187,12 @@ __device__ inline const _Tp &max(const _Tp &__a, const _Tp &__b,
 template <typename _Iterator,
           bool _IsNormal = __is_normal_iterator<_Iterator>::__value>
 struct __niter_base {
-  __device__ static _Iterator __b(_Iterator __it) { return __it; }
+  AICUDA_HD static _Iterator __b(_Iterator __it) { return __it; }
 };
 
 template <typename _Iterator>
 struct __niter_base<_Iterator, true> {
-  __device__ static typename _Iterator::iterator_type __b(_Iterator __it) {
+  AICUDA_HD static typename _Iterator::iterator_type __b(_Iterator __it) {
     return __it.base();
   }
 };
@@ -161,12 +200,12 @@ struct __niter_base<_Iterator, true> {
 template <typename _Iterator,
           bool _IsMove = __is_move_iterator<_Iterator>::__value>
 struct __miter_base {
-  __device__ static _Iterator __b(_Iterator __it) { return __it; }
+  AICUDA_HD static _Iterator __b(_Iterator __it) { return __it; }
 };
 
 template <typename _Iterator>
 struct __miter_base<_Iterator, true> {
-  __device__ static typename _Iterator::iterator_type __b(_Iterator __it) {
+  AICUDA_HD static typename _Iterator::iterator_type __b(_Iterator __it) {
     return __it.base();
   }
 };
@@ -174,7 +213,7 @@ struct __miter_base<_Iterator, true> {
 template <bool, bool, typename>
 struct __copy_move {
   template <typename _II, typename _OI>
-  __device__ static _OI __copy_m(_II __first, _II __last, _OI __result) {
+  AICUDA_HD static _OI __copy_m(_II __first, _II __last, _OI __result) {
     for (; __first != __last; ++__result, ++__first) *__result = *__first;
     return __result;
   }
@@ -185,7 +224,7 @@ struct random_access_iterator_tag;
 template <>
 struct __copy_move<false, false, random_access_iterator_tag> {
   template <typename _II, typename _OI>
-  __device__ static _OI __copy_m(_II __first, _II __last, _OI __result) {
+  AICUDA_HD static _OI __copy_m(_II __first, _II __last, _OI __result) {
     typedef typename iterator_traits<_II>::difference_type _Distance;
     for (_Distance __n = __last - __first; __n > 0; --__n) {
       *__result = *__first;
@@ -199,15 +238,15 @@ struct __copy_move<false, false, random_access_iterator_tag> {
 template <bool _IsMove>
 struct __copy_move<_IsMove, true, random_access_iterator_tag> {
   template <typename _Tp>
-  __device__ static _Tp *__copy_m(const _Tp *__first, const _Tp *__last,
-                                  _Tp *__result) {
+  AICUDA_HD static _Tp *__copy_m(const _Tp *__first, const _Tp *__last,
+                                 _Tp *__result) {
     string_op::memmove(__result, __first, sizeof(_Tp) * (__last - __first));
     return __result + (__last - __first);
   }
 };
 
 template <bool _IsMove, typename _II, typename _OI>
-__device__ inline _OI __copy_move_a(_II __first, _II __last, _OI __result) {
+AICUDA_HD inline _OI __copy_move_a(_II __first, _II __last, _OI __result) {
   typedef typename iterator_traits<_II>::value_type _ValueTypeI;
   typedef typename iterator_traits<_OI>::value_type _ValueTypeO;
   typedef typename iterator_traits<_II>::iterator_category _Category;
@@ -223,7 +262,7 @@ template <typename _CharT>
 struct char_traits;
 
 template <bool _IsMove, typename _II, typename _OI>
-__device__ inline _OI __copy_move_a2(_II __first, _II __last, _OI __result) {
+AICUDA_HD inline _OI __copy_move_a2(_II __first, _II __last, _OI __result) {
   return _OI(aicuda::stl::__copy_move_a<_IsMove>(
       aicuda::stl::__niter_base<_II>::__b(__first),
       aicuda::stl::__niter_base<_II>::__b(__last),
@@ -231,7 +270,7 @@ __device__ inline _OI __copy_move_a2(_II __first, _II __last, _OI __result) {
 }
 
 template <typename _II, typename _OI>
-__device__ inline _OI copy(_II __first, _II __last, _OI __result) {
+AICUDA_HD inline _OI copy(_II __first, _II __last, _OI __result) {
   return (aicuda::stl::__copy_move_a2<__is_move_iterator<_II>::__value>(
       aicuda::stl::__miter_base<_II>::__b(__first),
       aicuda::stl::__miter_base<_II>::__b(__last), __result));
@@ -240,8 +279,8 @@ __device__ inline _OI copy(_II __first, _II __last, _OI __result) {
 template <bool, bool, typename>
 struct __copy_move_backward {
   template <typename _BI1, typename _BI2>
-  __device__ static _BI2 __copy_move_b(_BI1 __first, _BI1 __last,
-                                       _BI2 __result) {
+  AICUDA_HD static _BI2 __copy_move_b(_BI1 __first, _BI1 __last,
+                                      _BI2 __result) {
     while (__first != __last) *--__result = *--__last;
     return __result;
   }
@@ -250,8 +289,8 @@ struct __copy_move_backward {
 template <>
 struct __copy_move_backward<false, false, random_access_iterator_tag> {
   template <typename _BI1, typename _BI2>
-  __device__ static _BI2 __copy_move_b(_BI1 __first, _BI1 __last,
-                                       _BI2 __result) {
+  AICUDA_HD static _BI2 __copy_move_b(_BI1 __first, _BI1 __last,
+                                      _BI2 __result) {
     typename iterator_traits<_BI1>::difference_type __n;
     for (__n = __last - __first; __n > 0; --__n) *--__result = *--__last;
     return __result;
@@ -261,8 +300,8 @@ struct __copy_move_backward<false, false, random_access_iterator_tag> {
 template <bool _IsMove>
 struct __copy_move_backward<_IsMove, true, random_access_iterator_tag> {
   template <typename _Tp>
-  __device__ static _Tp *__copy_move_b(const _Tp *__first, const _Tp *__last,
-                                       _Tp *__result) {
+  AICUDA_HD static _Tp *__copy_move_b(const _Tp *__first, const _Tp *__last,
+                                      _Tp *__result) {
     const ptrdiff_t _Num = __last - __first;
     string_op::memmove(__result - _Num, __first, sizeof(_Tp) * _Num);
     return __result - _Num;
@@ -270,8 +309,8 @@ struct __copy_move_backward<_IsMove, true, random_access_iterator_tag> {
 };
 
 template <bool _IsMove, typename _BI1, typename _BI2>
-__device__ inline _BI2 __copy_move_backward_a(_BI1 __first, _BI1 __last,
-                                              _BI2 __result) {
+AICUDA_HD inline _BI2 __copy_move_backward_a(_BI1 __first, _BI1 __last,
+                                             _BI2 __result) {
   typedef typename iterator_traits<_BI1>::value_type _ValueType1;
   typedef typename iterator_traits<_BI2>::value_type _ValueType2;
   typedef typename iterator_traits<_BI1>::iterator_category _Category;
@@ -286,8 +325,8 @@ __device__ inline _BI2 __copy_move_backward_a(_BI1 __first, _BI1 __last,
 }
 
 template <bool _IsMove, typename _BI1, typename _BI2>
-__device__ inline _BI2 __copy_move_backward_a2(_BI1 __first, _BI1 __last,
-                                               _BI2 __result) {
+AICUDA_HD inline _BI2 __copy_move_backward_a2(_BI1 __first, _BI1 __last,
+                                              _BI2 __result) {
   return _BI2(aicuda::stl::__copy_move_backward_a<_IsMove>(
       aicuda::stl::__niter_base<_BI1>::__b(__first),
       aicuda::stl::__niter_base<_BI1>::__b(__last),
@@ -295,7 +334,7 @@ __device__ inline _BI2 __copy_move_backward_a2(_BI1 __first, _BI1 __last,
 }
 
 template <typename _BI1, typename _BI2>
-__device__ inline _BI2 copy_backward(_BI1 __first, _BI1 __last, _BI2 __result) {
+AICUDA_HD inline _BI2 copy_backward(_BI1 __first, _BI1 __last, _BI2 __result) {
   return (
       aicuda::stl::__copy_move_backward_a2<__is_move_iterator<_BI1>::__value>(
           aicuda::stl::__miter_base<_BI1>::__b(__first),
@@ -303,7 +342,7 @@ __device__ inline _BI2 copy_backward(_BI1 __first, _BI1 __last, _BI2 __result) {
 }
 
 template <typename _ForwardIterator, typename _Tp>
-__device__ inline
+AICUDA_HD inline
     typename aicuda::stl::__enable_if<!__is_scalar<_Tp>::__value, void>::__type
     __fill_a(_ForwardIterator __first, _ForwardIterator __last,
              const _Tp &__value) {
@@ -311,7 +350,7 @@ __device__ inline
 }
 
 template <typename _ForwardIterator, typename _Tp>
-__device__ inline
+AICUDA_HD inline
     typename aicuda::stl::__enable_if<__is_scalar<_Tp>::__value, void>::__type
     __fill_a(_ForwardIterator __first, _ForwardIterator __last,
              const _Tp &__value) {
@@ -320,7 +359,7 @@ __device__ inline
 }
 
 template <typename _Tp>
-__device__ inline
+AICUDA_HD inline
     typename aicuda::stl::__enable_if<__is_byte<_Tp>::__value, void>::__type
     __fill_a(_Tp *__first, _Tp *__last, const _Tp &__c) {
   const _Tp __tmp = __c;
@@ -328,16 +367,38 @@ __device__ inline
                     __last - __first);
 }
 
+// Trivially copyable elements: a value made of one repeated byte (0, -1,
+// ...) becomes a memset, any other value whose size divides 16 is stored 16
+// bytes at a time.
+template <typename _Tp>
+AICUDA_HD inline typename aicuda::stl::__enable_if<
+    __is_trivially_copyable_type<_Tp>::__value && !__is_byte<_Tp>::__value, void>::__type
+__fill_a(_Tp *__first, _Tp *__last, const _Tp &__value) {
+  const _Tp __tmp = __value;
+  if (__first >= __last) return;
+  const unsigned char *__b = reinterpret_cast<const unsigned char *>(&__tmp);
+  bool __same = true;
+  for (size_t __i = 1; __i < sizeof(_Tp); ++__i)
+    if (__b[__i] != __b[0]) __same = false;
+  if (__same)
+    string_op::memset(__first, __b[0], (__last - __first) * sizeof(_Tp));
+  else if (16 % sizeof(_Tp) == 0)
+    string_op::memset_pattern(__first, &__tmp, sizeof(_Tp),
+                              (__last - __first) * sizeof(_Tp));
+  else
+    for (; __first != __last; ++__first) *__first = __tmp;
+}
+
 template <typename _ForwardIterator, typename _Tp>
-__device__ inline void fill(_ForwardIterator __first, _ForwardIterator __last,
-                            const _Tp &__value) {
+AICUDA_HD inline void fill(_ForwardIterator __first, _ForwardIterator __last,
+                           const _Tp &__value) {
   aicuda::stl::__fill_a(
       aicuda::stl::__niter_base<_ForwardIterator>::__b(__first),
       aicuda::stl::__niter_base<_ForwardIterator>::__b(__last), __value);
 }
 
 template <typename _OutputIterator, typename _Size, typename _Tp>
-__device__ inline typename aicuda::stl::__enable_if<!__is_scalar<_Tp>::__value,
+AICUDA_HD inline typename aicuda::stl::__enable_if<!__is_scalar<_Tp>::__value,
                                                     _OutputIterator>::__type
 __fill_n_a(_OutputIterator __first, _Size __n, const _Tp &__value) {
   for (; __n > 0; --__n, ++__first) *__first = __value;
@@ -345,7 +406,7 @@ __fill_n_a(_OutputIterator __first, _Size __n, const _Tp &__value) {
 }
 
 template <typename _OutputIterator, typename _Size, typename _Tp>
-__device__ inline typename aicuda::stl::__enable_if<__is_scalar<_Tp>::__value,
+AICUDA_HD inline typename aicuda::stl::__enable_if<__is_scalar<_Tp>::__value,
                                                     _OutputIterator>::__type
 __fill_n_a(_OutputIterator __first, _Size __n, const _Tp &__value) {
   const _Tp __tmp = __value;
@@ -354,46 +415,56 @@ __fill_n_a(_OutputIterator __first, _Size __n, const _Tp &__value) {
 }
 
 template <typename _Size, typename _Tp>
-__device__ inline
+AICUDA_HD inline
     typename aicuda::stl::__enable_if<__is_byte<_Tp>::__value, _Tp *>::__type
     __fill_n_a(_Tp *__first, _Size __n, const _Tp &__c) {
+  if (__n <= 0) return __first;
   aicuda::stl::__fill_a(__first, __first + __n, __c);
   return __first + __n;
 }
 
+template <typename _Size, typename _Tp>
+AICUDA_HD inline typename aicuda::stl::__enable_if<
+    __is_trivially_copyable_type<_Tp>::__value && !__is_byte<_Tp>::__value, _Tp *>::__type
+__fill_n_a(_Tp *__first, _Size __n, const _Tp &__value) {
+  if (__n <= 0) return __first;
+  aicuda::stl::__fill_a(__first, __first + __n, __value);
+  return __first + __n;
+}
+
 template <typename _OI, typename _Size, typename _Tp>
-__device__ inline _OI fill_n(_OI __first, _Size __n, const _Tp &__value) {
+AICUDA_HD inline _OI fill_n(_OI __first, _Size __n, const _Tp &__value) {
   return _OI(aicuda::stl::__fill_n_a(
       aicuda::stl::__niter_base<_OI>::__b(__first), __n, __value));
 }
 
 template <typename _Tp>
 struct _Identity : public unary_function<_Tp, _Tp> {
-  __device__ _Tp &operator()(_Tp &__x) const { return __x; }
+  AICUDA_HD _Tp &operator()(_Tp &__x) const { return __x; }
 
-  __device__ const _Tp &operator()(const _Tp &__x) const { return __x; }
+  AICUDA_HD const _Tp &operator()(const _Tp &__x) const { return __x; }
 };
 
 template <typename _Pair>
 struct _Select1st : public unary_function<_Pair, typename _Pair::first_type> {
-  __device__ typename _Pair::first_type &operator()(_Pair &__x) const {
+  AICUDA_HD typename _Pair::first_type &operator()(_Pair &__x) const {
     return __x.first;
   }
 
-  __device__ const typename _Pair::first_type &operator()(
-      const _Pair &__x) const {
+  AICUDA_HD const typename _Pair::first_type &operator()(
+     const _Pair &__x) const {
     return __x.first;
   }
 };
 
 template <typename _Pair>
 struct _Select2nd : public unary_function<_Pair, typename _Pair::second_type> {
-  __device__ typename _Pair::second_type &operator()(_Pair &__x) const {
+  AICUDA_HD typename _Pair::second_type &operator()(_Pair &__x) const {
     return __x.second;
   }
 
-  __device__ const typename _Pair::second_type &operator()(
-      const _Pair &__x) const {
+  AICUDA_HD const typename _Pair::second_type &operator()(
+     const _Pair &__x) const {
     return __x.second;
   }
 };
@@ -0,0 +1,276 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_HASH_H_
+#define _AICUDA_STL_HASH_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_charconv.h>
+#include <aicuda_stl_pair.h>
+#include <aicuda_stl_string.h>
+#include <aicuda_stl_string_view.h>
+
+namespace aicuda
+{
+namespace stl
+{
+
+// Hashing for the hashed containers: hash<T> for the integer, floating and
+// pointer types, basic_string, basic_string_view and pair.  Every result
+// is fully mixed, so a table may take its bucket from the low bits.
+// Strings hash their bytes with wyhash (final version 4); equal strings
+// hash equal whether held as a basic_string or a basic_string_view.
+
+// wyhash's default secret.
+AICUDA_HD inline unsigned long long __hash_secret(int __i)
+{
+  return __i == 0   ? 0x2d358dccaa6c78a5ULL
+         : __i == 1 ? 0x8bb84b93962eacc9ULL
+         : __i == 2 ? 0x4b33a62ed433d4a3ULL
+                    : 0x4d5a2da51de1aa47ULL;
+}
+
+// The 128-bit product of __a and __b, folded to 64 bits.
+AICUDA_HD inline unsigned long long __hash_mix(unsigned long long __a,
+                                               unsigned long long __b)
+{
+  return (__a * __b) ^ __umul_hi(__a, __b);
+}
+
+// Four and eight bytes from an arbitrary address.  The device faults on
+// misaligned wide loads, so it assembles unaligned words from bytes.
+AICUDA_HD inline unsigned long long __hash_load4(const unsigned char *__p)
+{
+#if AICUDA_DEVICE_CODE
+  if (((size_t)__p & 3) == 0)
+    return *(const unsigned int *)__p;
+  return (unsigned long long)__p[0] | (unsigned long long)__p[1] << 8 |
+         (unsigned long long)__p[2] << 16 | (unsigned long long)__p[3] << 24;
+#else
+  unsigned int __v;
+  __builtin_memcpy(&__v, __p, 4);
+  return __v;
+#endif
+}
+
+AICUDA_HD inline unsigned long long __hash_load8(const unsigned char *__p)
+{
+#if AICUDA_DEVICE_CODE
+  if (((size_t)__p & 7) == 0)
+    return *(const unsigned long long *)__p;
+  return __hash_load4(__p) | __hash_load4(__p + 4) << 32;
+#else
+  unsigned long long __v;
+  __builtin_memcpy(&__v, __p, 8);
+  return __v;
+#endif
+}
+
+// Hash of the __len bytes at __key.  Inputs over 48 bytes are consumed 48
+// at a time as three independent multiply lanes of two 8-byte loads each,
+// which keeps the multipliers busy instead of waiting on one chain.
+AICUDA_HD inline size_t __hash_bytes(const void *__key, size_t __len,
+                                     unsigned long long __seed = 0)
+{
+  const unsigned char *__p = (const unsigned char *)__key;
+  __seed ^= __hash_mix(__seed ^ __hash_secret(0), __hash_secret(1));
+  unsigned long long __a, __b;
+  if (__len <= 16)
+  {
+    if (__len >= 4)
+    {
+      const size_t __mid = (__len >> 3) << 2;
+      __a = __hash_load4(__p) << 32 | __hash_load4(__p + __mid);
+      __b = __hash_load4(__p + __len - 4) << 32 |
+            __hash_load4(__p + __len - 4 - __mid);
+    }
+    else if (__len > 0)
+    {
+      __a = (unsigned long long)__p[0] << 16 |
+            (unsigned long long)__p[__len >> 1] << 8 | __p[__len - 1];
+      __b = 0;
+    }
+    else
+      __a = __b = 0;
+  }
+  else
+  {
+    size_t __i = __len;
+    if (__i > 48)
+    {
+      unsigned long long __see1 = __seed, __see2 = __seed;
+      do
+      {
+        __seed = __hash_mix(__hash_load8(__p) ^ __hash_secret(1),
+                            __hash_load8(__p + 8) ^ __seed);
+        __see1 = __hash_mix(__hash_load8(__p + 16) ^ __hash_secret(2),
+                            __hash_load8(__p + 24) ^ __see1);
+        __see2 = __hash_mix(__hash_load8(__p + 32) ^ __hash_secret(3),
+                            __hash_load8(__p + 40) ^ __see2);
+        __p += 48;
+        __i -= 48;
+      } while (__i > 48);
+      __seed ^= __see1 ^ __see2;
+    }
+    while (__i > 16)
+    {
+      __seed = __hash_mix(__hash_load8(__p) ^ __hash_secret(1),
+                          __hash_load8(__p + 8) ^ __seed);
+      __i -= 16;
+      __p += 16;
+    }
+    __a = __hash_load8(__p + __i - 16);
+    __b = __hash_load8(__p + __i - 8);
+  }
+  __a ^= __hash_secret(1);
+  __b ^= __seed;
+  const unsigned long long __lo = __a * __b;
+  const unsigned long long __hi = __umul_hi(__a, __b);
+  return size_t(__hash_mix(__lo ^ __hash_secret(0) ^ __len,
+                           __hi ^ __hash_secret(1)));
+}
+
+// A 64-bit value mixed with one wide multiply; bijective inputs like
+// sequential keys come out spread across every bit.
+AICUDA_HD inline size_t __hash_int(unsigned long long __x)
+{
+  return size_t(__hash_mix(__x ^ __hash_secret(0), __hash_secret(1)));
+}
+
+// Combines two hashes, order-sensitively.
+AICUDA_HD inline size_t __hash_combine(size_t __h1, size_t __h2)
+{
+  return size_t(__hash_mix(__h1 ^ __hash_secret(2), __h2 ^ __hash_secret(3)));
+}
+
+template <typename _Tp>
+struct hash;
+
+#define _AICUDA_HASH_INT(_Tp)                                                  \
+  template <>                                                                  \
+  struct hash<_Tp>                                                             \
+  {                                                                            \
+    typedef _Tp argument_type;                                                 \
+    typedef size_t result_type;                                                \
+    AICUDA_HD size_t operator()(_Tp __x) const                                 \
+    {                                                                          \
+      return __hash_int((unsigned long long)__x);                              \
+    }                                                                          \
+  };
+
+_AICUDA_HASH_INT(bool)
+_AICUDA_HASH_INT(char)
+_AICUDA_HASH_INT(signed char)
+_AICUDA_HASH_INT(unsigned char)
+_AICUDA_HASH_INT(wchar_t)
+_AICUDA_HASH_INT(short)
+_AICUDA_HASH_INT(unsigned short)
+_AICUDA_HASH_INT(int)
+_AICUDA_HASH_INT(unsigned int)
+_AICUDA_HASH_INT(long)
+_AICUDA_HASH_INT(unsigned long)
+_AICUDA_HASH_INT(long long)
+_AICUDA_HASH_INT(unsigned long long)
+
+#undef _AICUDA_HASH_INT
+
+// 0.0 and -0.0 compare equal, so they hash alike.
+template <>
+struct hash<float>
+{
+  typedef float argument_type;
+  typedef size_t result_type;
+  AICUDA_HD size_t operator()(float __x) const
+  {
+    union
+    {
+      float _M_value;
+      unsigned int _M_bits;
+    } __cvt;
+    __cvt._M_value = __x;
+    return __x == 0.0f ? __hash_int(0) : __hash_int(__cvt._M_bits);
+  }
+};
+
+template <>
+struct hash<double>
+{
+  typedef double argument_type;
+  typedef size_t result_type;
+  AICUDA_HD size_t operator()(double __x) const
+  {
+    __double_bits __cvt;
+    __cvt._M_value = __x;
+    return __x == 0.0 ? __hash_int(0) : __hash_int(__cvt._M_bits);
+  }
+};
+
+template <typename _Tp>
+struct hash<_Tp *>
+{
+  typedef _Tp *argument_type;
+  typedef size_t result_type;
+  AICUDA_HD size_t operator()(_Tp *__p) const
+  {
+    return __hash_int((unsigned long long)(size_t)__p);
+  }
+};
+
+template <typename _CharT, typename _Traits>
+struct hash<basic_string_view<_CharT, _Traits> >
+{
+  typedef basic_string_view<_CharT, _Traits> argument_type;
+  typedef size_t result_type;
+  AICUDA_HD size_t operator()(const argument_type &__s) const
+  {
+    return __hash_bytes(__s.data(), __s.size() * sizeof(_CharT));
+  }
+};
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+struct hash<basic_string<_CharT, _Traits, _Alloc> >
+{
+  typedef basic_string<_CharT, _Traits, _Alloc> argument_type;
+  typedef size_t result_type;
+  AICUDA_HD size_t operator()(const argument_type &__s) const
+  {
+    return __hash_bytes(__s.data(), __s.size() * sizeof(_CharT));
+  }
+};
+
+template <typename _T1, typename _T2>
+struct hash<pair<_T1, _T2> >
+{
+  typedef pair<_T1, _T2> argument_type;
+  typedef size_t result_type;
+  AICUDA_HD size_t operator()(const argument_type &__p) const
+  {
+    return __hash_combine(hash<_T1>()(__p.first), hash<_T2>()(__p.second));
+  }
+};
+
+} // namespace stl
+} // namespace aicuda
+
+#endif /* _AICUDA_STL_HASH_H_ */
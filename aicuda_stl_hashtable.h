@@ -0,0 +1,837 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_HASHTABLE_H_
+#define _AICUDA_STL_HASHTABLE_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_allocator.h>
+#include <aicuda_stl_function.h>
+#include <aicuda_stl_hash.h>
+#include <aicuda_stl_iterator.h>
+#include <aicuda_stl_pair.h>
+#include <assert.h>
+#include <stdio.h>
+
+namespace aicuda
+{
+namespace stl
+{
+
+// Open-addressing hash table behind unordered_map and unordered_set, laid
+// out as a Swiss table: a flat array of slots plus one control byte per
+// slot.  A full slot's control byte holds the low seven bits of its hash
+// (h2); the rest of the hash (h1) picks the first group of eight slots to
+// probe, and further groups follow a triangular sequence.  A lookup loads
+// a group's eight control bytes as one aligned word and compares h2 against
+// all of them at once, so most misses and hits touch one word and one slot.
+// Groups are aligned, so the loads are safe on the device too.
+//
+// The hasher must mix well into the low bits, as hash<> does.
+
+struct _Hashtable_ctrl
+{
+  typedef unsigned long long AICUDA_MAY_ALIAS _Word;
+
+  enum
+  {
+    _S_group = 8,
+    _S_empty = -128,
+    _S_deleted = -2,
+    _S_sentinel = -1
+  };
+
+  static const unsigned long long _S_lsbs = 0x0101010101010101ULL;
+  static const unsigned long long _S_msbs = 0x8080808080808080ULL;
+
+  AICUDA_HD static _Word
+  _S_load(const signed char *__g)
+  {
+    return *(const _Word *)__g;
+  }
+
+  // Bytes equal to __h2.  A byte just above a true match may be marked
+  // spuriously, but only a full one, so callers still compare keys.
+  AICUDA_HD static _Word
+  _S_match(_Word __w, size_t __h2)
+  {
+    const _Word __x = __w ^ (_S_lsbs * __h2);
+    return (__x - _S_lsbs) & ~__x & _S_msbs;
+  }
+
+  AICUDA_HD static _Word
+  _S_match_empty(_Word __w)
+  {
+    return __w & ~(__w << 6) & _S_msbs;
+  }
+
+  AICUDA_HD static _Word
+  _S_match_empty_or_deleted(_Word __w)
+  {
+    return __w & ~(__w << 7) & _S_msbs;
+  }
+
+  AICUDA_HD static size_t
+  _S_first(_Word __m)
+  {
+#if AICUDA_DEVICE_CODE
+    return size_t(__ffsll((long long)__m) - 1) >> 3;
+#else
+    return size_t(__builtin_ctzll(__m)) >> 3;
+#endif
+  }
+};
+
+template <typename _Tp>
+struct _Hashtable_iterator
+{
+  typedef _Tp value_type;
+  typedef _Tp &reference;
+  typedef _Tp *pointer;
+
+  typedef forward_iterator_tag iterator_category;
+  typedef ptrdiff_t difference_type;
+
+  typedef _Hashtable_iterator<_Tp> _Self;
+
+  AICUDA_HD _Hashtable_iterator()
+      : _M_ctrl(), _M_slot() {}
+
+  AICUDA_HD _Hashtable_iterator(const signed char *__c, _Tp *__s)
+      : _M_ctrl(__c), _M_slot(__s) {}
+
+  AICUDA_HD reference
+  operator*() const
+  {
+    return *_M_slot;
+  }
+
+  AICUDA_HD pointer
+  operator->() const
+  {
+    return _M_slot;
+  }
+
+  AICUDA_HD _Self &
+  operator++()
+  {
+    ++_M_ctrl;
+    ++_M_slot;
+    _M_skip_free();
+    return *this;
+  }
+
+  AICUDA_HD _Self
+  operator++(int)
+  {
+    _Self __tmp = *this;
+    ++*this;
+    return __tmp;
+  }
+
+  AICUDA_HD bool
+  operator==(const _Self &__x) const
+  {
+    return _M_slot == __x._M_slot;
+  }
+
+  AICUDA_HD bool
+  operator!=(const _Self &__x) const
+  {
+    return _M_slot != __x._M_slot;
+  }
+
+  // Advances to the next full slot or to the sentinel after the last one.
+  AICUDA_HD void
+  _M_skip_free()
+  {
+    while (*_M_ctrl < _Hashtable_ctrl::_S_sentinel)
+    {
+      ++_M_ctrl;
+      ++_M_slot;
+    }
+  }
+
+  const signed char *_M_ctrl;
+  _Tp *_M_slot;
+};
+
+template <typename _Tp>
+struct _Hashtable_const_iterator
+{
+  typedef _Tp value_type;
+  typedef const _Tp &reference;
+  typedef const _Tp *pointer;
+
+  typedef _Hashtable_iterator<_Tp> iterator;
+
+  typedef forward_iterator_tag iterator_category;
+  typedef ptrdiff_t difference_type;
+
+  typedef _Hashtable_const_iterator<_Tp> _Self;
+
+  AICUDA_HD _Hashtable_const_iterator()
+      : _M_ctrl(), _M_slot() {}
+
+  AICUDA_HD _Hashtable_const_iterator(const signed char *__c, const _Tp *__s)
+      : _M_ctrl(__c), _M_slot(__s) {}
+
+  AICUDA_HD _Hashtable_const_iterator(const iterator &__it)
+      : _M_ctrl(__it._M_ctrl), _M_slot(__it._M_slot) {}
+
+  AICUDA_HD reference
+  operator*() const
+  {
+    return *_M_slot;
+  }
+
+  AICUDA_HD pointer
+  operator->() const
+  {
+    return _M_slot;
+  }
+
+  AICUDA_HD _Self &
+  operator++()
+  {
+    ++_M_ctrl;
+    ++_M_slot;
+    while (*_M_ctrl < _Hashtable_ctrl::_S_sentinel)
+    {
+      ++_M_ctrl;
+      ++_M_slot;
+    }
+    return *this;
+  }
+
+  AICUDA_HD _Self
+  operator++(int)
+  {
+    _Self __tmp = *this;
+    ++*this;
+    return __tmp;
+  }
+
+  AICUDA_HD bool
+  operator==(const _Self &__x) const
+  {
+    return _M_slot == __x._M_slot;
+  }
+
+  AICUDA_HD bool
+  operator!=(const _Self &__x) const
+  {
+    return _M_slot != __x._M_slot;
+  }
+
+  const signed char *_M_ctrl;
+  const _Tp *_M_slot;
+};
+
+template <typename _Val>
+AICUDA_HD inline bool
+operator==(const _Hashtable_iterator<_Val> &__x,
+           const _Hashtable_const_iterator<_Val> &__y)
+{
+  return __x._M_slot == __y._M_slot;
+}
+
+template <typename _Val>
+AICUDA_HD inline bool
+operator!=(const _Hashtable_iterator<_Val> &__x,
+           const _Hashtable_const_iterator<_Val> &__y)
+{
+  return __x._M_slot != __y._M_slot;
+}
+
+// Yields _Res only when both the hasher and the key equality declare
+// is_transparent, as for heterogeneous lookup in the tree containers.
+template <typename _Hash, typename _Pred, typename _Kt, typename _Res,
+          typename = void>
+struct __if_hash_transparent
+{
+};
+
+template <typename _Hash, typename _Pred, typename _Kt, typename _Res>
+struct __if_hash_transparent<
+    _Hash, _Pred, _Kt, _Res,
+    typename __void_type<pair<typename _Hash::is_transparent *,
+                              typename _Pred::is_transparent *> >::__type>
+{
+  typedef _Res __type;
+};
+
+template <typename _Key, typename _Val, typename _KeyOfValue, typename _Hash,
+          typename _Pred, typename _Alloc = aicuda::stl::allocator<_Val>>
+class _Hashtable
+{
+  typedef typename _Alloc::template rebind<_Val>::other _Slot_allocator;
+  typedef typename _Alloc::template rebind<unsigned long long>::other
+      _Ctrl_allocator;
+  typedef _Hashtable_ctrl _Ctrl;
+
+public:
+  typedef _Key key_type;
+  typedef _Val value_type;
+  typedef _Hash hasher;
+  typedef _Pred key_equal;
+  typedef value_type *pointer;
+  typedef const value_type *const_pointer;
+  typedef value_type &reference;
+  typedef const value_type &const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Alloc allocator_type;
+  typedef _Hashtable_iterator<value_type> iterator;
+  typedef _Hashtable_const_iterator<value_type> const_iterator;
+
+  enum
+  {
+    npos = static_cast<size_type>(-1)
+  };
+
+  AICUDA_HD explicit _Hashtable(size_type __n = 0,
+                                const hasher &__hf = hasher(),
+                                const key_equal &__eql = key_equal(),
+                                const allocator_type &__a = allocator_type())
+      : _M_hash(__hf), _M_eq(__eql), _M_alloc(__a), _M_ctrl(0), _M_slots(0),
+        _M_capacity(0), _M_size(0), _M_deleted(0), _M_limit(0),
+        _M_max_load(0.875f)
+  {
+    if (__n)
+      _M_rehash(_M_capacity_for(__n));
+  }
+
+  AICUDA_HD _Hashtable(const _Hashtable &__x)
+      : _M_hash(__x._M_hash), _M_eq(__x._M_eq), _M_alloc(__x._M_alloc),
+        _M_ctrl(0), _M_slots(0), _M_capacity(0), _M_size(0), _M_deleted(0),
+        _M_limit(0), _M_max_load(__x._M_max_load)
+  {
+    _M_copy_from(__x);
+  }
+
+  AICUDA_HD ~_Hashtable()
+  {
+    _M_deallocate();
+  }
+
+  AICUDA_HD _Hashtable &
+  operator=(const _Hashtable &__x)
+  {
+    if (this != &__x)
+    {
+      _M_deallocate();
+      _M_hash = __x._M_hash;
+      _M_eq = __x._M_eq;
+      _M_max_load = __x._M_max_load;
+      _M_copy_from(__x);
+    }
+    return *this;
+  }
+
+  AICUDA_HD allocator_type
+  get_allocator() const
+  {
+    return allocator_type(_M_alloc);
+  }
+
+  AICUDA_HD iterator
+  begin()
+  {
+    iterator __it(_M_ctrl, _M_slots);
+    if (_M_ctrl)
+      __it._M_skip_free();
+    return __it;
+  }
+
+  AICUDA_HD const_iterator
+  begin() const
+  {
+    return const_cast<_Hashtable *>(this)->begin();
+  }
+
+  AICUDA_HD iterator
+  end()
+  {
+    return iterator(_M_ctrl + _M_capacity, _M_slots + _M_capacity);
+  }
+
+  AICUDA_HD const_iterator
+  end() const
+  {
+    return const_iterator(_M_ctrl + _M_capacity, _M_slots + _M_capacity);
+  }
+
+  AICUDA_HD bool
+  empty() const
+  {
+    return _M_size == 0;
+  }
+
+  AICUDA_HD size_type
+  size() const
+  {
+    return _M_size;
+  }
+
+  AICUDA_HD size_type
+  max_size() const
+  {
+    return _M_alloc.max_size();
+  }
+
+  AICUDA_HD hasher
+  hash_function() const
+  {
+    return _M_hash;
+  }
+
+  AICUDA_HD key_equal
+  key_eq() const
+  {
+    return _M_eq;
+  }
+
+  // Slots, the open-addressing counterpart of buckets.
+  AICUDA_HD size_type
+  bucket_count() const
+  {
+    return _M_capacity;
+  }
+
+  AICUDA_HD float
+  load_factor() const
+  {
+    return _M_capacity ? float(_M_size) / float(_M_capacity) : 0.0f;
+  }
+
+  AICUDA_HD float
+  max_load_factor() const
+  {
+    return _M_max_load;
+  }
+
+  // Takes effect from the next insertion; values above 1 mean 1, since a
+  // slot holds one element.
+  AICUDA_HD void
+  max_load_factor(float __z)
+  {
+    if (!(__z > 0.0f))
+    {
+      printf("_Hashtable::max_load_factor: %f is not positive\n", double(__z));
+      assert(1 < 0);
+    }
+    _M_max_load = __z < 1.0f ? __z : 1.0f;
+    _M_limit = _M_max_elements(_M_capacity);
+  }
+
+  // Resizes to at least __n slots and at least enough for size() elements
+  // under max_load_factor(), dropping tombstones.
+  AICUDA_HD void
+  rehash(size_type __n)
+  {
+    size_type __cap = _M_capacity_for(_M_size);
+    while (__cap < __n)
+      __cap <<= 1;
+    if (__cap != _M_capacity || _M_deleted)
+      _M_rehash(__cap);
+  }
+
+  AICUDA_HD void
+  reserve(size_type __n)
+  {
+    if (__n > _M_limit)
+      _M_rehash(_M_capacity_for(__n));
+  }
+
+  AICUDA_HD iterator
+  find(const key_type &__k)
+  {
+    return _M_iter(_M_find(__k));
+  }
+
+  AICUDA_HD const_iterator
+  find(const key_type &__k) const
+  {
+    return const_cast<_Hashtable *>(this)->find(__k);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_find_tr(const _Kt &__k)
+  {
+    return _M_iter(_M_find(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD const_iterator
+  _M_find_tr(const _Kt &__k) const
+  {
+    return const_cast<_Hashtable *>(this)->_M_find_tr(__k);
+  }
+
+  // The element with key __k, or a new slot for it whose control byte is
+  // set but whose value the caller must construct with _M_construct
+  // before touching the table again.
+  AICUDA_HD pair<iterator, bool>
+  _M_find_or_prepare(const key_type &__k)
+  {
+    const size_t __h = _M_hash(__k);
+    const size_type __i = _M_find(__k, __h);
+    if (__i != size_type(npos))
+      return pair<iterator, bool>(_M_iter(__i), false);
+    return pair<iterator, bool>(_M_iter(_M_prepare_insert(__h)), true);
+  }
+
+  AICUDA_HD void
+  _M_construct(iterator __it, const value_type &__v)
+  {
+    _M_alloc.construct(__it._M_slot, __v);
+  }
+
+  // Whether __p lies outside the slot array.  Growing the table releases
+  // that array, so an argument that refers into it must be copied before
+  // _M_find_or_prepare is called.
+  AICUDA_HD bool
+  _M_disjunct(const void *__p) const
+  {
+    return (less<const void *>()(__p, _M_slots) ||
+            !less<const void *>()(__p, _M_slots + _M_capacity));
+  }
+
+  AICUDA_HD pair<iterator, bool>
+  _M_insert_unique(const value_type &__v)
+  {
+    if (!_M_disjunct(&__v))
+    {
+      const value_type __vc(__v);
+      return _M_insert_unique(__vc);
+    }
+    pair<iterator, bool> __r = _M_find_or_prepare(_KeyOfValue()(__v));
+    if (__r.second)
+      _M_construct(__r.first, __v);
+    return __r;
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD void
+  _M_insert_unique(_InputIterator __first, _InputIterator __last)
+  {
+    for (; __first != __last; ++__first)
+      _M_insert_unique(*__first);
+  }
+
+  AICUDA_HD void
+  erase(const_iterator __position)
+  {
+    _M_erase_at(size_type(__position._M_slot - _M_slots));
+  }
+
+  AICUDA_HD size_type
+  erase(const key_type &__k)
+  {
+    const size_type __i = _M_find(__k);
+    if (__i == size_type(npos))
+      return 0;
+    _M_erase_at(__i);
+    return 1;
+  }
+
+  AICUDA_HD void
+  erase(const_iterator __first, const_iterator __last)
+  {
+    while (__first != __last)
+    {
+      const_iterator __next = __first;
+      ++__next;
+      erase(__first);
+      __first = __next;
+    }
+  }
+
+  AICUDA_HD void
+  clear()
+  {
+    _M_destroy_all();
+    _M_reset_ctrl(_M_ctrl, _M_capacity);
+    _M_size = 0;
+    _M_deleted = 0;
+  }
+
+  AICUDA_HD void
+  swap(_Hashtable &__x)
+  {
+    aicuda::stl::swap(_M_hash, __x._M_hash);
+    aicuda::stl::swap(_M_eq, __x._M_eq);
+    aicuda::stl::swap(_M_ctrl, __x._M_ctrl);
+    aicuda::stl::swap(_M_slots, __x._M_slots);
+    aicuda::stl::swap(_M_capacity, __x._M_capacity);
+    aicuda::stl::swap(_M_size, __x._M_size);
+    aicuda::stl::swap(_M_deleted, __x._M_deleted);
+    aicuda::stl::swap(_M_limit, __x._M_limit);
+    aicuda::stl::swap(_M_max_load, __x._M_max_load);
+  }
+
+private:
+  AICUDA_HD iterator
+  _M_iter(size_type __i)
+  {
+    if (__i == size_type(npos))
+      return end();
+    return iterator(_M_ctrl + __i, _M_slots + __i);
+  }
+
+  AICUDA_HD size_type
+  _M_max_elements(size_type __cap) const
+  {
+    return size_type(float(__cap) * _M_max_load);
+  }
+
+  // Smallest power-of-two slot count, at least one group, that holds __n
+  // elements under the maximum load factor.
+  AICUDA_HD size_type
+  _M_capacity_for(size_type __n) const
+  {
+    size_type __cap = _Ctrl::_S_group;
+    while (_M_max_elements(__cap) < __n)
+      __cap <<= 1;
+    return __cap;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD size_type
+  _M_find(const _Kt &__k)
+  {
+    return _M_find(__k, _M_hash(__k));
+  }
+
+  // Index of the element with key __k and hash __h, or npos.  The probe
+  // stops at the first group with an empty slot: an insertion would have
+  // used it.
+  template <typename _Kt>
+  AICUDA_HD size_type
+  _M_find(const _Kt &__k, size_t __h)
+  {
+    if (!_M_capacity)
+      return npos;
+    const size_type __mask = (_M_capacity >> 3) - 1;
+    size_type __g = (__h >> 7) & __mask;
+    for (size_type __step = 0; __step <= __mask;)
+    {
+      const _Ctrl::_Word __w = _Ctrl::_S_load(_M_ctrl + (__g << 3));
+      for (_Ctrl::_Word __m = _Ctrl::_S_match(__w, __h & 0x7f); __m;
+           __m &= __m - 1)
+      {
+        const size_type __i = (__g << 3) + _Ctrl::_S_first(__m);
+        if (_M_eq(_KeyOfValue()(_M_slots[__i]), __k))
+          return __i;
+      }
+      if (_Ctrl::_S_match_empty(__w))
+        return npos;
+      __g = (__g + ++__step) & __mask;
+    }
+    return npos;
+  }
+
+  // First empty or deleted slot on __h's probe sequence, or npos.
+  AICUDA_HD size_type
+  _M_find_free(size_t __h) const
+  {
+    if (!_M_capacity)
+      return npos;
+    const size_type __mask = (_M_capacity >> 3) - 1;
+    size_type __g = (__h >> 7) & __mask;
+    for (size_type __step = 0; __step <= __mask;)
+    {
+      const _Ctrl::_Word __m = _Ctrl::_S_match_empty_or_deleted(
+          _Ctrl::_S_load(_M_ctrl + (__g << 3)));
+      if (__m)
+        return (__g << 3) + _Ctrl::_S_first(__m);
+      __g = (__g + ++__step) & __mask;
+    }
+    return npos;
+  }
+
+  // Claims a slot for a new element with hash __h.  Reusing a tombstone
+  // is always allowed; taking an empty slot is not once elements and
+  // tombstones reach the load limit, and then the table grows, or is
+  // rebuilt at its size if tombstones are what fill it.
+  AICUDA_HD size_type
+  _M_prepare_insert(size_t __h)
+  {
+    size_type __i = _M_find_free(__h);
+    if (__i == size_type(npos) ||
+        (_M_ctrl[__i] == _Ctrl::_S_empty && _M_size + _M_deleted >= _M_limit))
+    {
+      const size_type __cap = _M_capacity_for(_M_size + 1);
+      _M_rehash(__cap > _M_capacity ? __cap : _M_capacity);
+      __i = _M_find_free(__h);
+    }
+    if (_M_ctrl[__i] == _Ctrl::_S_deleted)
+      --_M_deleted;
+    _M_ctrl[__i] = (signed char)(__h & 0x7f);
+    ++_M_size;
+    return __i;
+  }
+
+  // A slot in a group that still has an empty slot can become empty
+  // again: no probe has ever passed over that group.  Otherwise it
+  // becomes a tombstone.
+  AICUDA_HD void
+  _M_erase_at(size_type __i)
+  {
+    _M_alloc.destroy(_M_slots + __i);
+    const signed char *__g = _M_ctrl + (__i & ~size_type(_Ctrl::_S_group - 1));
+    if (_Ctrl::_S_match_empty(_Ctrl::_S_load(__g)))
+      _M_ctrl[__i] = _Ctrl::_S_empty;
+    else
+    {
+      _M_ctrl[__i] = _Ctrl::_S_deleted;
+      ++_M_deleted;
+    }
+    --_M_size;
+  }
+
+  // Control words for __cap slots plus the sentinel after them.
+  AICUDA_HD static size_type
+  _S_ctrl_words(size_type __cap)
+  {
+    return (__cap >> 3) + 1;
+  }
+
+  AICUDA_HD static void
+  _S_reset_ctrl(signed char *__ctrl, size_type __cap)
+  {
+    _Ctrl::_Word *__w = (_Ctrl::_Word *)__ctrl;
+    for (size_type __n = _S_ctrl_words(__cap); __n; --__n)
+      *__w++ = _Ctrl::_S_msbs;
+    __ctrl[__cap] = _Ctrl::_S_sentinel;
+  }
+
+  AICUDA_HD void
+  _M_reset_ctrl(signed char *__ctrl, size_type __cap)
+  {
+    if (__ctrl)
+      _S_reset_ctrl(__ctrl, __cap);
+  }
+
+  AICUDA_HD void
+  _M_allocate(size_type __cap)
+  {
+    _Ctrl_allocator __ca(_M_alloc);
+    _M_ctrl = (signed char *)__ca.allocate(_S_ctrl_words(__cap));
+    _M_slots = _M_alloc.allocate(__cap);
+    _M_capacity = __cap;
+    _M_limit = _M_max_elements(__cap);
+    _S_reset_ctrl(_M_ctrl, __cap);
+  }
+
+  AICUDA_HD void
+  _M_destroy_all()
+  {
+    for (size_type __i = 0; __i < _M_capacity; ++__i)
+      if (_M_ctrl[__i] >= 0)
+        _M_alloc.destroy(_M_slots + __i);
+  }
+
+  AICUDA_HD void
+  _M_deallocate()
+  {
+    if (!_M_ctrl)
+      return;
+    _M_destroy_all();
+    _Ctrl_allocator __ca(_M_alloc);
+    __ca.deallocate((unsigned long long *)_M_ctrl, _S_ctrl_words(_M_capacity));
+    _M_alloc.deallocate(_M_slots, _M_capacity);
+    _M_ctrl = 0;
+    _M_slots = 0;
+    _M_capacity = 0;
+    _M_size = 0;
+    _M_deleted = 0;
+    _M_limit = 0;
+  }
+
+  // Moves every element into a fresh table of __cap slots.
+  AICUDA_HD void
+  _M_rehash(size_type __cap)
+  {
+    signed char *const __old_ctrl = _M_ctrl;
+    value_type *const __old_slots = _M_slots;
+    const size_type __old_cap = _M_capacity;
+    _M_allocate(__cap);
+    for (size_type __i = 0; __i < __old_cap; ++__i)
+    {
+      if (__old_ctrl[__i] < 0)
+        continue;
+      const size_t __h = _M_hash(_KeyOfValue()(__old_slots[__i]));
+      const size_type __j = _M_find_free(__h);
+      _M_ctrl[__j] = (signed char)(__h & 0x7f);
+      _M_alloc.construct(_M_slots + __j, __old_slots[__i]);
+      _M_alloc.destroy(__old_slots + __i);
+    }
+    _M_deleted = 0;
+    if (__old_ctrl)
+    {
+      _Ctrl_allocator __ca(_M_alloc);
+      __ca.deallocate((unsigned long long *)__old_ctrl,
+                      _S_ctrl_words(__old_cap));
+      _M_alloc.deallocate(__old_slots, __old_cap);
+    }
+  }
+
+  // Copies __x slot for slot; the layout, tombstones included, stays valid
+  // because the hasher is the same.
+  AICUDA_HD void
+  _M_copy_from(const _Hashtable &__x)
+  {
+    if (!__x._M_ctrl)
+      return;
+    _M_allocate(__x._M_capacity);
+    const _Ctrl::_Word *__src = (const _Ctrl::_Word *)__x._M_ctrl;
+    _Ctrl::_Word *__dst = (_Ctrl::_Word *)_M_ctrl;
+    for (size_type __n = _S_ctrl_words(_M_capacity); __n; --__n)
+      *__dst++ = *__src++;
+    for (size_type __i = 0; __i < _M_capacity; ++__i)
+      if (_M_ctrl[__i] >= 0)
+        _M_alloc.construct(_M_slots + __i, __x._M_slots[__i]);
+    _M_size = __x._M_size;
+    _M_deleted = __x._M_deleted;
+  }
+
+  hasher _M_hash;
+  key_equal _M_eq;
+  _Slot_allocator _M_alloc;
+  signed char *_M_ctrl;
+  value_type *_M_slots;
+  size_type _M_capacity;
+  size_type _M_size;
+  size_type _M_deleted;
+  size_type _M_limit;
+  float _M_max_load;
+};
+
+} // namespace stl
+} // namespace aicuda
+
+#endif /* _AICUDA_STL_HASHTABLE_H_ */
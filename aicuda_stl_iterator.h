@@ -25,6 +25,7 @@
 #ifndef _AICUDA_STL_ITERATOR_H_
 #define _AICUDA_STL_ITERATOR_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <stddef.h>
 #include <aicuda_stl_type_traits.h>
 
@@ -95,14 +96,14 @@ struct iterator_traits<const _Tp *>
 };
 
 template <typename _Iter>
-__device__ inline typename iterator_traits<_Iter>::iterator_category
+AICUDA_HD inline typename iterator_traits<_Iter>::iterator_category
 __iterator_category(const _Iter &)
 {
   return typename iterator_traits<_Iter>::iterator_category();
 }
 
 template <typename _InputIterator>
-__device__ inline typename iterator_traits<_InputIterator>::difference_type
+AICUDA_HD inline typename iterator_traits<_InputIterator>::difference_type
 __distance(_InputIterator __first, _InputIterator __last,
            input_iterator_tag)
 {
@@ -116,7 +117,7 @@ __distance(_InputIterator __first, _InputIterator __last,
 }
 
 template <typename _RandomAccessIterator>
-__device__ inline typename iterator_traits<_RandomAccessIterator>::difference_type
+AICUDA_HD inline typename iterator_traits<_RandomAccessIterator>::difference_type
 __distance(_RandomAccessIterator __first, _RandomAccessIterator __last,
            random_access_iterator_tag)
 {
@@ -124,7 +125,7 @@ __distance(_RandomAccessIterator __first, _RandomAccessIterator __last,
 }
 
 template <typename _InputIterator>
-__device__ inline typename iterator_traits<_InputIterator>::difference_type
+AICUDA_HD inline typename iterator_traits<_InputIterator>::difference_type
 distance(_InputIterator __first, _InputIterator __last)
 {
 
@@ -132,7 +133,7 @@ distance(_InputIterator __first, _InputIterator __last)
 }
 
 template <typename _InputIterator, typename _Distance>
-__device__ inline void
+AICUDA_HD inline void
 __advance(_InputIterator &__i, _Distance __n, input_iterator_tag)
 {
   while (__n--)
@@ -140,7 +141,7 @@ __advance(_InputIterator &__i, _Distance __n, input_iterator_tag)
 }
 
 template <typename _BidirectionalIterator, typename _Distance>
-__device__ inline void
+AICUDA_HD inline void
 __advance(_BidirectionalIterator &__i, _Distance __n,
           bidirectional_iterator_tag)
 {
@@ -153,7 +154,7 @@ __advance(_BidirectionalIterator &__i, _Distance __n,
 }
 
 template <typename _RandomAccessIterator, typename _Distance>
-__device__ inline void
+AICUDA_HD inline void
 __advance(_RandomAccessIterator &__i, _Distance __n,
           random_access_iterator_tag)
 {
@@ -161,7 +162,7 @@ __advance(_RandomAccessIterator &__i, _Distance __n,
 }
 
 template <typename _InputIterator, typename _Distance>
-__device__ inline void
+AICUDA_HD inline void
 advance(_InputIterator &__i, _Distance __n)
 {
   typename iterator_traits<_InputIterator>::difference_type __d = __n;
@@ -187,44 +188,44 @@ public:
   typedef typename iterator_traits<_Iterator>::pointer pointer;
 
 public:
-  __device__ reverse_iterator() : current() {}
+  AICUDA_HD reverse_iterator() : current() {}
 
-  __device__ explicit reverse_iterator(iterator_type __x) : current(__x) {}
+  AICUDA_HD explicit reverse_iterator(iterator_type __x) : current(__x) {}
 
-  __device__ reverse_iterator(const reverse_iterator &__x)
+  AICUDA_HD reverse_iterator(const reverse_iterator &__x)
       : current(__x.current) {}
 
   template <typename _Iter>
-  __device__ reverse_iterator(const reverse_iterator<_Iter> &__x)
+  AICUDA_HD reverse_iterator(const reverse_iterator<_Iter> &__x)
       : current(__x.base()) {}
 
-  __device__ iterator_type
+  AICUDA_HD iterator_type
   base() const
   {
     return current;
   }
 
-  __device__ reference
+  AICUDA_HD reference
   operator*() const
   {
     _Iterator __tmp = current;
     return *--__tmp;
   }
 
-  __device__ pointer
+  AICUDA_HD pointer
   operator->() const
   {
     return &(operator*());
   }
 
-  __device__ reverse_iterator &
+  AICUDA_HD reverse_iterator &
   operator++()
   {
     --current;
     return *this;
   }
 
-  __device__ reverse_iterator
+  AICUDA_HD reverse_iterator
   operator++(int)
   {
     reverse_iterator __tmp = *this;
@@ -232,14 +233,14 @@ public:
     return __tmp;
   }
 
-  __device__ reverse_iterator &
+  AICUDA_HD reverse_iterator &
   operator--()
   {
     ++current;
     return *this;
   }
 
-  __device__ reverse_iterator
+  AICUDA_HD reverse_iterator
   operator--(int)
   {
     reverse_iterator __tmp = *this;
@@ -247,33 +248,33 @@ public:
     return __tmp;
   }
 
-  __device__ reverse_iterator
+  AICUDA_HD reverse_iterator
   operator+(difference_type __n) const
   {
     return reverse_iterator(current - __n);
   }
 
-  __device__ reverse_iterator &
+  AICUDA_HD reverse_iterator &
   operator+=(difference_type __n)
   {
     current -= __n;
     return *this;
   }
 
-  __device__ reverse_iterator
+  AICUDA_HD reverse_iterator
   operator-(difference_type __n) const
   {
     return reverse_iterator(current + __n);
   }
 
-  __device__ reverse_iterator &
+  AICUDA_HD reverse_iterator &
   operator-=(difference_type __n)
   {
     current += __n;
     return *this;
   }
 
-  __device__ reference
+  AICUDA_HD reference
   operator[](difference_type __n) const
   {
     return *(*this + __n);
@@ -281,7 +282,7 @@ public:
 };
 
 template <typename _Iterator>
-__device__ inline bool
+AICUDA_HD inline bool
 operator==(const reverse_iterator<_Iterator> &__x,
            const reverse_iterator<_Iterator> &__y)
 {
@@ -289,7 +290,7 @@ operator==(const reverse_iterator<_Iterator> &__x,
 }
 
 template <typename _Iterator>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<(const reverse_iterator<_Iterator> &__x,
           const reverse_iterator<_Iterator> &__y)
 {
@@ -297,7 +298,7 @@ operator<(const reverse_iterator<_Iterator> &__x,
 }
 
 template <typename _Iterator>
-__device__ inline bool
+AICUDA_HD inline bool
 operator!=(const reverse_iterator<_Iterator> &__x,
            const reverse_iterator<_Iterator> &__y)
 {
@@ -305,7 +306,7 @@ operator!=(const reverse_iterator<_Iterator> &__x,
 }
 
 template <typename _Iterator>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>(const reverse_iterator<_Iterator> &__x,
           const reverse_iterator<_Iterator> &__y)
 {
@@ -313,7 +314,7 @@ operator>(const reverse_iterator<_Iterator> &__x,
 }
 
 template <typename _Iterator>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<=(const reverse_iterator<_Iterator> &__x,
            const reverse_iterator<_Iterator> &__y)
 {
@@ -321,7 +322,7 @@ operator<=(const reverse_iterator<_Iterator> &__x,
 }
 
 template <typename _Iterator>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>=(const reverse_iterator<_Iterator> &__x,
            const reverse_iterator<_Iterator> &__y)
 {
@@ -329,7 +330,7 @@ operator>=(const reverse_iterator<_Iterator> &__x,
 }
 
 template <typename _Iterator>
-__device__ inline typename reverse_iterator<_Iterator>::difference_type
+AICUDA_HD inline typename reverse_iterator<_Iterator>::difference_type
 operator-(const reverse_iterator<_Iterator> &__x,
           const reverse_iterator<_Iterator> &__y)
 {
@@ -337,7 +338,7 @@ operator-(const reverse_iterator<_Iterator> &__x,
 }
 
 template <typename _Iterator>
-__device__ inline reverse_iterator<_Iterator>
+AICUDA_HD inline reverse_iterator<_Iterator>
 operator+(typename reverse_iterator<_Iterator>::difference_type __n,
           const reverse_iterator<_Iterator> &__x)
 {
@@ -345,7 +346,7 @@ operator+(typename reverse_iterator<_Iterator>::difference_type __n,
 }
 
 template <typename _IteratorL, typename _IteratorR>
-__device__ inline bool
+AICUDA_HD inline bool
 operator==(const reverse_iterator<_IteratorL> &__x,
            const reverse_iterator<_IteratorR> &__y)
 {
@@ -353,7 +354,7 @@ operator==(const reverse_iterator<_IteratorL> &__x,
 }
 
 template <typename _IteratorL, typename _IteratorR>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<(const reverse_iterator<_IteratorL> &__x,
           const reverse_iterator<_IteratorR> &__y)
 {
@@ -361,7 +362,7 @@ operator<(const reverse_iterator<_IteratorL> &__x,
 }
 
 template <typename _IteratorL, typename _IteratorR>
-__device__ inline bool
+AICUDA_HD inline bool
 operator!=(const reverse_iterator<_IteratorL> &__x,
            const reverse_iterator<_IteratorR> &__y)
 {
@@ -369,7 +370,7 @@ operator!=(const reverse_iterator<_IteratorL> &__x,
 }
 
 template <typename _IteratorL, typename _IteratorR>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>(const reverse_iterator<_IteratorL> &__x,
           const reverse_iterator<_IteratorR> &__y)
 {
@@ -377,7 +378,7 @@ operator>(const reverse_iterator<_IteratorL> &__x,
 }
 
 template <typename _IteratorL, typename _IteratorR>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<=(const reverse_iterator<_IteratorL> &__x,
            const reverse_iterator<_IteratorR> &__y)
 {
@@ -385,7 +386,7 @@ operator<=(const reverse_iterator<_IteratorL> &__x,
 }
 
 template <typename _IteratorL, typename _IteratorR>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>=(const reverse_iterator<_IteratorL> &__x,
            const reverse_iterator<_IteratorR> &__y)
 {
@@ -393,7 +394,7 @@ operator>=(const reverse_iterator<_IteratorL> &__x,
 }
 
 template <typename _IteratorL, typename _IteratorR>
-__device__ inline typename reverse_iterator<_IteratorL>::difference_type
+AICUDA_HD inline typename reverse_iterator<_IteratorL>::difference_type
 operator-(const reverse_iterator<_IteratorL> &__x,
           const reverse_iterator<_IteratorR> &__y)
 
@@ -411,28 +412,28 @@ protected:
 public:
   typedef _Container container_type;
 
-  __device__ explicit back_insert_iterator(_Container &__x) : container(&__x) {}
+  AICUDA_HD explicit back_insert_iterator(_Container &__x) : container(&__x) {}
 
-  __device__ back_insert_iterator &
+  AICUDA_HD back_insert_iterator &
   operator=(typename _Container::const_reference __value)
   {
     container->push_back(__value);
     return *this;
   }
 
-  __device__ back_insert_iterator &
+  AICUDA_HD back_insert_iterator &
   operator*()
   {
     return *this;
   }
 
-  __device__ back_insert_iterator &
+  AICUDA_HD back_insert_iterator &
   operator++()
   {
     return *this;
   }
 
-  __device__ back_insert_iterator
+  AICUDA_HD back_insert_iterator
   operator++(int)
   {
     return *this;
@@ -440,7 +441,7 @@ public:
 };
 
 template <typename _Container>
-__device__ inline back_insert_iterator<_Container>
+AICUDA_HD inline back_insert_iterator<_Container>
 back_inserter(_Container &__x)
 {
   return back_insert_iterator<_Container>(__x);
@@ -456,28 +457,28 @@ protected:
 public:
   typedef _Container container_type;
 
-  __device__ explicit front_insert_iterator(_Container &__x) : container(&__x) {}
+  AICUDA_HD explicit front_insert_iterator(_Container &__x) : container(&__x) {}
 
-  __device__ front_insert_iterator &
+  AICUDA_HD front_insert_iterator &
   operator=(typename _Container::const_reference __value)
   {
     container->push_front(__value);
     return *this;
   }
 
-  __device__ front_insert_iterator &
+  AICUDA_HD front_insert_iterator &
   operator*()
   {
     return *this;
   }
 
-  __device__ front_insert_iterator &
+  AICUDA_HD front_insert_iterator &
   operator++()
   {
     return *this;
   }
 
-  __device__ front_insert_iterator
+  AICUDA_HD front_insert_iterator
   operator++(int)
   {
     return *this;
@@ -485,7 +486,7 @@ public:
 };
 
 template <typename _Container>
-__device__ inline front_insert_iterator<_Container>
+AICUDA_HD inline front_insert_iterator<_Container>
 front_inserter(_Container &__x)
 {
   return front_insert_iterator<_Container>(__x);
@@ -502,10 +503,10 @@ protected:
 public:
   typedef _Container container_type;
 
-  __device__ insert_iterator(_Container &__x, typename _Container::iterator __i)
+  AICUDA_HD insert_iterator(_Container &__x, typename _Container::iterator __i)
       : container(&__x), iter(__i) {}
 
-  __device__ insert_iterator &
+  AICUDA_HD insert_iterator &
   operator=(typename _Container::const_reference __value)
   {
     iter = container->insert(iter, __value);
@@ -513,19 +514,19 @@ public:
     return *this;
   }
 
-  __device__ insert_iterator &
+  AICUDA_HD insert_iterator &
   operator*()
   {
     return *this;
   }
 
-  __device__ insert_iterator &
+  AICUDA_HD insert_iterator &
   operator++()
   {
     return *this;
   }
 
-  __device__ insert_iterator &
+  AICUDA_HD insert_iterator &
   operator++(int)
   {
     return *this;
@@ -533,7 +534,7 @@ public:
 };
 
 template <typename _Container, typename _Iterator>
-__device__ inline insert_iterator<_Container>
+AICUDA_HD inline insert_iterator<_Container>
 inserter(_Container &__x, _Iterator __i)
 {
   return insert_iterator<_Container>(__x,
@@ -556,88 +557,88 @@ public:
   typedef typename iterator_traits<_Iterator>::reference reference;
   typedef typename iterator_traits<_Iterator>::pointer pointer;
 
-  __device__ __normal_iterator() : _M_current(_Iterator()) {}
+  AICUDA_HD __normal_iterator() : _M_current(_Iterator()) {}
 
-  __device__ explicit __normal_iterator(const _Iterator &__i) : _M_current(__i) {}
+  AICUDA_HD explicit __normal_iterator(const _Iterator &__i) : _M_current(__i) {}
 
   template <typename _Iter>
-  __device__ __normal_iterator(const __normal_iterator<_Iter,
-                                                       typename aicuda::stl::__enable_if<
-                                                           (aicuda::stl::__are_same<_Iter, typename _Container::pointer>::__value),
-                                                           _Container>::__type> &__i)
+  AICUDA_HD __normal_iterator(const __normal_iterator<_Iter,
+                                                      typename aicuda::stl::__enable_if<
+                                                          (aicuda::stl::__are_same<_Iter, typename _Container::pointer>::__value),
+                                                          _Container>::__type> &__i)
       : _M_current(__i.base()) {}
 
-  __device__ reference
+  AICUDA_HD reference
   operator*() const
   {
     return *_M_current;
   }
 
-  __device__ pointer
+  AICUDA_HD pointer
   operator->() const
   {
     return _M_current;
   }
 
-  __device__ __normal_iterator &
+  AICUDA_HD __normal_iterator &
   operator++()
   {
     ++_M_current;
     return *this;
   }
 
-  __device__ __normal_iterator
+  AICUDA_HD __normal_iterator
   operator++(int)
   {
     return __normal_iterator(_M_current++);
   }
 
-  __device__ __normal_iterator &
+  AICUDA_HD __normal_iterator &
   operator--()
   {
     --_M_current;
     return *this;
   }
 
-  __device__ __normal_iterator
+  AICUDA_HD __normal_iterator
   operator--(int)
   {
     return __normal_iterator(_M_current--);
   }
 
-  __device__ reference
+  AICUDA_HD reference
   operator[](const difference_type &__n) const
   {
     return _M_current[__n];
   }
 
-  __device__ __normal_iterator &
+  AICUDA_HD __normal_iterator &
   operator+=(const difference_type &__n)
   {
     _M_current += __n;
     return *this;
   }
 
-  __device__ __normal_iterator
+  AICUDA_HD __normal_iterator
   operator+(const difference_type &__n) const
   {
     return __normal_iterator(_M_current + __n);
   }
 
-  __device__ __normal_iterator &
+  AICUDA_HD __normal_iterator &
   operator-=(const difference_type &__n)
   {
     _M_current -= __n;
     return *this;
   }
 
-  __device__ __normal_iterator
+  AICUDA_HD __normal_iterator
   operator-(const difference_type &__n) const
   {
     return __normal_iterator(_M_current - __n);
   }
 
-  __device__ const _Iterator &
+  AICUDA_HD const _Iterator &
   base() const
   {
     return _M_current;
@@ -645,7 +646,7 @@ public:
 };
 
 template <typename _IteratorL, typename _IteratorR, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator==(const __normal_iterator<_IteratorL, _Container> &__lhs,
            const __normal_iterator<_IteratorR, _Container> &__rhs)
 {
@@ -653,7 +654,7 @@ operator==(const __normal_iterator<_IteratorL, _Container> &__lhs,
 }
 
 template <typename _Iterator, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator==(const __normal_iterator<_Iterator, _Container> &__lhs,
            const __normal_iterator<_Iterator, _Container> &__rhs)
 {
@@ -661,7 +662,7 @@ operator==(const __normal_iterator<_Iterator, _Container> &__lhs,
 }
 
 template <typename _IteratorL, typename _IteratorR, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator!=(const __normal_iterator<_IteratorL, _Container> &__lhs,
            const __normal_iterator<_IteratorR, _Container> &__rhs)
 {
@@ -669,7 +670,7 @@ operator!=(const __normal_iterator<_IteratorL, _Container> &__lhs,
 }
 
 template <typename _Iterator, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator!=(const __normal_iterator<_Iterator, _Container> &__lhs,
            const __normal_iterator<_Iterator, _Container> &__rhs)
 {
@@ -677,7 +678,7 @@ operator!=(const __normal_iterator<_Iterator, _Container> &__lhs,
 }
 
 template <typename _IteratorL, typename _IteratorR, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<(const __normal_iterator<_IteratorL, _Container> &__lhs,
           const __normal_iterator<_IteratorR, _Container> &__rhs)
 {
@@ -685,7 +686,7 @@ operator<(const __normal_iterator<_IteratorL, _Container> &__lhs,
 }
 
 template <typename _Iterator, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<(const __normal_iterator<_Iterator, _Container> &__lhs,
           const __normal_iterator<_Iterator, _Container> &__rhs)
 {
@@ -693,7 +694,7 @@ operator<(const __normal_iterator<_Iterator, _Container> &__lhs,
 }
 
 template <typename _IteratorL, typename _IteratorR, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>(const __normal_iterator<_IteratorL, _Container> &__lhs,
           const __normal_iterator<_IteratorR, _Container> &__rhs)
 {
@@ -701,7 +702,7 @@ operator>(const __normal_iterator<_IteratorL, _Container> &__lhs,
 }
 
 template <typename _Iterator, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>(const __normal_iterator<_Iterator, _Container> &__lhs,
           const __normal_iterator<_Iterator, _Container> &__rhs)
 {
@@ -709,7 +710,7 @@ operator>(const __normal_iterator<_Iterator, _Container> &__lhs,
 }
 
 template <typename _IteratorL, typename _IteratorR, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<=(const __normal_iterator<_IteratorL, _Container> &__lhs,
            const __normal_iterator<_IteratorR, _Container> &__rhs)
 {
@@ -717,7 +718,7 @@ operator<=(const __normal_iterator<_IteratorL, _Container> &__lhs,
 }
 
 template <typename _Iterator, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<=(const __normal_iterator<_Iterator, _Container> &__lhs,
            const __normal_iterator<_Iterator, _Container> &__rhs)
 {
@@ -725,7 +726,7 @@ operator<=(const __normal_iterator<_Iterator, _Container> &__lhs,
 }
 
 template <typename _IteratorL, typename _IteratorR, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>=(const __normal_iterator<_IteratorL, _Container> &__lhs,
            const __normal_iterator<_IteratorR, _Container> &__rhs)
 {
@@ -733,7 +734,7 @@ operator>=(const __normal_iterator<_IteratorL, _Container> &__lhs,
 }
 
 template <typename _Iterator, typename _Container>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>=(const __normal_iterator<_Iterator, _Container> &__lhs,
            const __normal_iterator<_Iterator, _Container> &__rhs)
 {
@@ -741,7 +742,7 @@ operator>=(const __normal_iterator<_Iterator, _Container> &__lhs,
 }
 
 template <typename _IteratorL, typename _IteratorR, typename _Container>
-__device__ inline typename __normal_iterator<_IteratorL, _Container>::difference_type
+AICUDA_HD inline typename __normal_iterator<_IteratorL, _Container>::difference_type
 operator-(const __normal_iterator<_IteratorL, _Container> &__lhs,
           const __normal_iterator<_IteratorR, _Container> &__rhs)
 
@@ -750,7 +751,7 @@ operator-(const __normal_iterator<_IteratorL, _Container> &__lhs,
 }
 
 template <typename _Iterator, typename _Container>
-__device__ inline typename __normal_iterator<_Iterator, _Container>::difference_type
+AICUDA_HD inline typename __normal_iterator<_Iterator, _Container>::difference_type
 operator-(const __normal_iterator<_Iterator, _Container> &__lhs,
           const __normal_iterator<_Iterator, _Container> &__rhs)
 {
@@ -758,7 +759,7 @@ operator-(const __normal_iterator<_Iterator, _Container> &__lhs,
 }
 
 template <typename _Iterator, typename _Container>
-__device__ inline __normal_iterator<_Iterator, _Container>
+AICUDA_HD inline __normal_iterator<_Iterator, _Container>
 operator+(typename __normal_iterator<_Iterator, _Container>::difference_type
               __n,
           const __normal_iterator<_Iterator, _Container> &__i)
@@ -25,7 +25,9 @@
 #ifndef _AICUDA_STL_LIST_H_
 #define _AICUDA_STL_LIST_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <aicuda_stl_allocator.h>
+#include <aicuda_stl_function.h>
 #include <aicuda_stl_iterator.h>
 
 namespace aicuda {
@@ -35,7 +37,7 @@ struct _List_node_base {
   _List_node_base *_M_next;
   _List_node_base *_M_prev;
 
-  __device__ static void swap(_List_node_base &__x, _List_node_base &__y) {
+  AICUDA_HD static void swap(_List_node_base &__x, _List_node_base &__y) {
     if (__x._M_next != &__x) {
       if (__y._M_next != &__y) {
         // Both __x and __y are not empty.
@@ -59,8 +61,8 @@ struct _List_node_base {
     }
   }
 
-  __device__ void transfer(_List_node_base *const __first,
-                           _List_node_base *const __last) {
+  AICUDA_HD void transfer(_List_node_base *const __first,
+                          _List_node_base *const __last) {
     if (this != __last) {
       // Remove [first, last) from its old position.
       __last->_M_prev->_M_next = this;
@@ -75,7 +77,7 @@ struct _List_node_base {
     }
   }
 
-  __device__ void reverse() {
+  AICUDA_HD void reverse() {
     _List_node_base *__tmp = this;
     do {
       aicuda::stl::swap(__tmp->_M_next, __tmp->_M_prev);
@@ -85,14 +87,14 @@ struct _List_node_base {
     } while (__tmp != this);
   }
 
-  __device__ void hook(_List_node_base *const __position) {
+  AICUDA_HD void hook(_List_node_base *const __position) {
     this->_M_next = __position;
     this->_M_prev = __position->_M_prev;
     __position->_M_prev->_M_next = this;
     __position->_M_prev = this;
   }
 
-  __device__ void unhook() {
+  AICUDA_HD void unhook() {
     _List_node_base *const __next_node = this->_M_next;
     _List_node_base *const __prev_node = this->_M_prev;
     __prev_node->_M_next = __next_node;
@@ -116,45 +118,45 @@ struct _List_iterator {
   typedef _Tp *pointer;
   typedef _Tp &reference;
 
-  __device__ _List_iterator() : _M_node() {}
+  AICUDA_HD _List_iterator() : _M_node() {}
 
-  __device__ explicit _List_iterator(_List_node_base *__x) : _M_node(__x) {}
+  AICUDA_HD explicit _List_iterator(_List_node_base *__x) : _M_node(__x) {}
 
-  __device__ reference operator*() const {
+  AICUDA_HD reference operator*() const {
     return static_cast<_Node *>(_M_node)->_M_data;
   }
 
-  __device__ pointer operator->() const {
+  AICUDA_HD pointer operator->() const {
     return &static_cast<_Node *>(_M_node)->_M_data;
   }
 
-  __device__ _Self &operator++() {
+  AICUDA_HD _Self &operator++() {
     _M_node = _M_node->_M_next;
     return *this;
   }
 
-  __device__ _Self operator++(int) {
+  AICUDA_HD _Self operator++(int) {
     _Self __tmp = *this;
     _M_node = _M_node->_M_next;
     return __tmp;
   }
 
-  __device__ _Self &operator--() {
+  AICUDA_HD _Self &operator--() {
     _M_node = _M_node->_M_prev;
     return *this;
   }
 
-  __device__ _Self operator--(int) {
+  AICUDA_HD _Self operator--(int) {
     _Self __tmp = *this;
     _M_node = _M_node->_M_prev;
     return __tmp;
   }
 
-  __device__ bool operator==(const _Self &__x) const {
+  AICUDA_HD bool operator==(const _Self &__x) const {
     return _M_node == __x._M_node;
   }
 
-  __device__ bool operator!=(const _Self &__x) const {
+  AICUDA_HD bool operator!=(const _Self &__x) const {
     return _M_node != __x._M_node;
   }
 
@@ -173,48 +175,48 @@ struct _List_const_iterator {
   typedef const _Tp *pointer;
   typedef const _Tp &reference;
 
-  __device__ _List_const_iterator() : _M_node() {}
+  AICUDA_HD _List_const_iterator() : _M_node() {}
 
-  __device__ explicit _List_const_iterator(const _List_node_base *__x)
+  AICUDA_HD explicit _List_const_iterator(const _List_node_base *__x)
       : _M_node(__x) {}
 
-  __device__ _List_const_iterator(const iterator &__x) : _M_node(__x._M_node) {}
+  AICUDA_HD _List_const_iterator(const iterator &__x) : _M_node(__x._M_node) {}
 
-  __device__ reference operator*() const {
+  AICUDA_HD reference operator*() const {
     return static_cast<_Node *>(_M_node)->_M_data;
   }
 
-  __device__ pointer operator->() const {
+  AICUDA_HD pointer operator->() const {
     return &static_cast<_Node *>(_M_node)->_M_data;
   }
 
-  __device__ _Self &operator++() {
+  AICUDA_HD _Self &operator++() {
     _M_node = _M_node->_M_next;
     return *this;
   }
 
-  __device__ _Self operator++(int) {
+  AICUDA_HD _Self operator++(int) {
     _Self __tmp = *this;
     _M_node = _M_node->_M_next;
     return __tmp;
   }
 
-  __device__ _Self &operator--() {
+  AICUDA_HD _Self &operator--() {
     _M_node = _M_node->_M_prev;
     return *this;
   }
 
-  __device__ _Self operator--(int) {
+  AICUDA_HD _Self operator--(int) {
     _Self __tmp = *this;
     _M_node = _M_node->_M_prev;
     return __tmp;
   }
 
-  __device__ bool operator==(const _Self &__x) const {
+  AICUDA_HD bool operator==(const _Self &__x) const {
     return _M_node == __x._M_node;
   }
 
-  __device__ bool operator!=(const _Self &__x) const {
+  AICUDA_HD bool operator!=(const _Self &__x) const {
     return _M_node != __x._M_node;
   }
 
@@ -222,14 +224,14 @@ struct _List_const_iterator {
 };
 
 template <typename _Val>
-__device__ inline bool operator==(const _List_iterator<_Val> &__x,
-                                  const _List_const_iterator<_Val> &__y) {
+AICUDA_HD inline bool operator==(const _List_iterator<_Val> &__x,
+                                 const _List_const_iterator<_Val> &__y) {
   return __x._M_node == __y._M_node;
 }
 
 template <typename _Val>
-__device__ inline bool operator!=(const _List_iterator<_Val> &__x,
-                                  const _List_const_iterator<_Val> &__y) {
+AICUDA_HD inline bool operator!=(const _List_iterator<_Val> &__x,
+                                 const _List_const_iterator<_Val> &__y) {
   return __x._M_node != __y._M_node;
 }
 
@@ -244,50 +246,50 @@ class _List_base {
   struct _List_impl : public _Node_alloc_type {
     _List_node_base _M_node;
 
-    __device__ _List_impl() : _Node_alloc_type(), _M_node() {}
+    AICUDA_HD _List_impl() : _Node_alloc_type(), _M_node() {}
 
-    __device__ _List_impl(const _Node_alloc_type &__a)
+    AICUDA_HD _List_impl(const _Node_alloc_type &__a)
         : _Node_alloc_type(__a), _M_node() {}
   };
 
   _List_impl _M_impl;
 
-  __device__ _List_node<_Tp> *_M_get_node() {
+  AICUDA_HD _List_node<_Tp> *_M_get_node() {
     return _M_impl._Node_alloc_type::allocate(1);
   }
 
-  __device__ void _M_put_node(_List_node<_Tp> *__p) {
+  AICUDA_HD void _M_put_node(_List_node<_Tp> *__p) {
     _M_impl._Node_alloc_type::deallocate(__p, 1);
   }
 
  public:
   typedef _Alloc allocator_type;
 
-  __device__ _Node_alloc_type &_M_get_Node_allocator() {
+  AICUDA_HD _Node_alloc_type &_M_get_Node_allocator() {
     return *static_cast<_Node_alloc_type *>(&this->_M_impl);
   }
 
-  __device__ const _Node_alloc_type &_M_get_Node_allocator() const {
+  AICUDA_HD const _Node_alloc_type &_M_get_Node_allocator() const {
     return *static_cast<const _Node_alloc_type *>(&this->_M_impl);
   }
 
-  __device__ _Tp_alloc_type _M_get_Tp_allocator() const {
+  AICUDA_HD _Tp_alloc_type _M_get_Tp_allocator() const {
     return _Tp_alloc_type(_M_get_Node_allocator());
   }
 
-  __device__ allocator_type get_allocator() const {
+  AICUDA_HD allocator_type get_allocator() const {
     return allocator_type(_M_get_Node_allocator());
   }
 
-  __device__ _List_base() : _M_impl() { _M_init(); }
+  AICUDA_HD _List_base() : _M_impl() { _M_init(); }
 
-  __device__ _List_base(const allocator_type &__a) : _M_impl(__a) { _M_init(); }
+  AICUDA_HD _List_base(const allocator_type &__a) : _M_impl(__a) { _M_init(); }
 
-  __device__ ~_List_base() { _M_clear(); }
+  AICUDA_HD ~_List_base() { _M_clear(); }
 
-  __device__ void _M_clear();
+  AICUDA_HD void _M_clear();
 
-  __device__ void _M_init() {
+  AICUDA_HD void _M_init() {
     this->_M_impl._M_node._M_next = &this->_M_impl._M_node;
     this->_M_impl._M_node._M_prev = &this->_M_impl._M_node;
   }
@@ -323,165 +325,165 @@ class list : protected _List_base<_Tp, _Alloc> {
   using _Base::_M_impl;
   using _Base::_M_put_node;
 
-  __device__ _Node *_M_create_node(const value_type &__x) {
+  AICUDA_HD _Node *_M_create_node(const value_type &__x) {
     _Node *__p = this->_M_get_node();
     _M_get_Tp_allocator().construct(&__p->_M_data, __x);
     return __p;
   }
 
  public:
-  __device__ list() : _Base() {}
+  AICUDA_HD list() : _Base() {}
 
-  __device__ explicit list(const allocator_type &__a) : _Base(__a) {}
+  AICUDA_HD explicit list(const allocator_type &__a) : _Base(__a) {}
 
-  __device__ explicit list(size_type __n,
-                           const value_type &__value = value_type(),
-                           const allocator_type &__a = allocator_type())
+  AICUDA_HD explicit list(size_type __n,
+                          const value_type &__value = value_type(),
+                          const allocator_type &__a = allocator_type())
       : _Base(__a) {
     _M_fill_initialize(__n, __value);
   }
 
-  __device__ list(const list &__x) : _Base(__x._M_get_Node_allocator()) {
+  AICUDA_HD list(const list &__x) : _Base(__x._M_get_Node_allocator()) {
     _M_initialize_dispatch(__x.begin(), __x.end(), __false_type());
   }
 
   template <typename _InputIterator>
-  __device__ list(_InputIterator __first, _InputIterator __last,
-                  const allocator_type &__a = allocator_type())
+  AICUDA_HD list(_InputIterator __first, _InputIterator __last,
+                 const allocator_type &__a = allocator_type())
       : _Base(__a) {
     typedef
         typename aicuda::stl::__is_integer<_InputIterator>::__type _Integral;
     _M_initialize_dispatch(__first, __last, _Integral());
   }
 
-  __device__ list &operator=(const list &__x);
+  AICUDA_HD list &operator=(const list &__x);
 
-  __device__ void assign(size_type __n, const value_type &__val) {
+  AICUDA_HD void assign(size_type __n, const value_type &__val) {
     _M_fill_assign(__n, __val);
   }
 
   template <typename _InputIterator>
-  __device__ void assign(_InputIterator __first, _InputIterator __last) {
+  AICUDA_HD void assign(_InputIterator __first, _InputIterator __last) {
     typedef
         typename aicuda::stl::__is_integer<_InputIterator>::__type _Integral;
     _M_assign_dispatch(__first, __last, _Integral());
   }
 
-  __device__ allocator_type get_allocator() const {
+  AICUDA_HD allocator_type get_allocator() const {
     return _Base::get_allocator();
   }
 
-  __device__ iterator begin() {
+  AICUDA_HD iterator begin() {
     return iterator(this->_M_impl._M_node._M_next);
   }
 
-  __device__ const_iterator begin() const {
+  AICUDA_HD const_iterator begin() const {
     return const_iterator(this->_M_impl._M_node._M_next);
   }
 
-  __device__ iterator end() { return iterator(&this->_M_impl._M_node); }
+  AICUDA_HD iterator end() { return iterator(&this->_M_impl._M_node); }
 
-  __device__ const_iterator end() const {
+  AICUDA_HD const_iterator end() const {
     return const_iterator(&this->_M_impl._M_node);
   }
 
-  __device__ reverse_iterator rbegin() { return reverse_iterator(end()); }
+  AICUDA_HD reverse_iterator rbegin() { return reverse_iterator(end()); }
 
-  __device__ const_reverse_iterator rbegin() const {
+  AICUDA_HD const_reverse_iterator rbegin() const {
     return const_reverse_iterator(end());
   }
 
-  __device__ reverse_iterator rend() { return reverse_iterator(begin()); }
+  AICUDA_HD reverse_iterator rend() { return reverse_iterator(begin()); }
 
-  __device__ const_reverse_iterator rend() const {
+  AICUDA_HD const_reverse_iterator rend() const {
     return const_reverse_iterator(begin());
   }
 
-  __device__ bool empty() const {
+  AICUDA_HD bool empty() const {
     return this->_M_impl._M_node._M_next == &this->_M_impl._M_node;
   }
 
-  __device__ size_type size() const {
+  AICUDA_HD size_type size() const {
     return aicuda::stl::distance(begin(), end());
   }
 
-  __device__ size_type max_size() const {
+  AICUDA_HD size_type max_size() const {
     return _M_get_Node_allocator().max_size();
   }
 
-  __device__ void resize(size_type __new_size, value_type __x = value_type());
+  AICUDA_HD void resize(size_type __new_size, value_type __x = value_type());
 
-  __device__ reference front() { return *begin(); }
+  AICUDA_HD reference front() { return *begin(); }
 
-  __device__ const_reference front() const { return *begin(); }
+  AICUDA_HD const_reference front() const { return *begin(); }
 
-  __device__ reference back() {
+  AICUDA_HD reference back() {
     iterator __tmp = end();
     --__tmp;
     return *__tmp;
   }
 
-  __device__ const_reference back() const {
+  AICUDA_HD const_reference back() const {
     const_iterator __tmp = end();
     --__tmp;
     return *__tmp;
   }
 
-  __device__ void push_front(const value_type &__x) {
+  AICUDA_HD void push_front(const value_type &__x) {
     this->_M_insert(begin(), __x);
   }
 
-  __device__ void pop_front() { this->_M_erase(begin()); }
+  AICUDA_HD void pop_front() { this->_M_erase(begin()); }
 
-  __device__ void push_back(const value_type &__x) {
+  AICUDA_HD void push_back(const value_type &__x) {
     this->_M_insert(end(), __x);
   }
 
-  __device__ void pop_back() {
+  AICUDA_HD void pop_back() {
     this->_M_erase(iterator(this->_M_impl._M_node._M_prev));
   }
 
-  __device__ iterator insert(iterator __position, const value_type &__x);
+  AICUDA_HD iterator insert(iterator __position, const value_type &__x);
 
-  __device__ void insert(iterator __position, size_type __n,
-                         const value_type &__x) {
+  AICUDA_HD void insert(iterator __position, size_type __n,
+                        const value_type &__x) {
     list __tmp(__n, __x, _M_get_Node_allocator());
     splice(__position, __tmp);
   }
 
   template <typename _InputIterator>
-  __device__ void insert(iterator __position, _InputIterator __first,
-                         _InputIterator __last) {
+  AICUDA_HD void insert(iterator __position, _InputIterator __first,
+                        _InputIterator __last) {
     list __tmp(__first, __last, _M_get_Node_allocator());
     splice(__position, __tmp);
   }
 
-  __device__ iterator erase(iterator __position);
+  AICUDA_HD iterator erase(iterator __position);
 
-  __device__ iterator erase(iterator __first, iterator __last) {
+  AICUDA_HD iterator erase(iterator __first, iterator __last) {
     while (__first != __last) __first = erase(__first);
     return __last;
   }
 
-  __device__ void swap(list &__x) {
+  AICUDA_HD void swap(list &__x) {
     _List_node_base::swap(this->_M_impl._M_node, __x._M_impl._M_node);
     aicuda::stl::__alloc_swap<typename _Base::_Node_alloc_type>::_S_do_it(
         _M_get_Node_allocator(), __x._M_get_Node_allocator());
   }
 
-  __device__ void clear() {
+  AICUDA_HD void clear() {
     _Base::_M_clear();
     _Base::_M_init();
   }
 
-  __device__ void splice(iterator __position, list &__x) {
+  AICUDA_HD void splice(iterator __position, list &__x) {
     if (!__x.empty()) {
       _M_check_equal_allocators(__x);
       this->_M_transfer(__position, __x.begin(), __x.end());
     }
   }
 
-  __device__ void splice(iterator __position, list &__x, iterator __i) {
+  AICUDA_HD void splice(iterator __position, list &__x, iterator __i) {
     iterator __j = __i;
     ++__j;
     if (__position == __i || __position == __j) return;
@@ -491,8 +493,8 @@ class list : protected _List_base<_Tp, _Alloc> {
     this->_M_transfer(__position, __i, __j);
   }
 
-  __device__ void splice(iterator __position, list &__x, iterator __first,
-                         iterator __last) {
+  AICUDA_HD void splice(iterator __position, list &__x, iterator __first,
+                        iterator __last) {
     if (__first != __last) {
       if (this != &__x) _M_check_equal_allocators(__x);
 
@@ -500,68 +502,68 @@ class list : protected _List_base<_Tp, _Alloc> {
     }
   }
 
-  __device__ void remove(const _Tp &__value);
+  AICUDA_HD void remove(const _Tp &__value);
 
   template <typename _Predicate>
-  __device__ void remove_if(_Predicate);
+  AICUDA_HD void remove_if(_Predicate);
 
-  __device__ void unique();
+  AICUDA_HD void unique();
 
   template <typename _BinaryPredicate>
-  __device__ void unique(_BinaryPredicate);
+  AICUDA_HD void unique(_BinaryPredicate);
 
-  __device__ void merge(list &__x);
+  AICUDA_HD void merge(list &__x);
 
   template <typename _StrictWeakOrdering>
-  __device__ void merge(list &, _StrictWeakOrdering);
+  AICUDA_HD void merge(list &, _StrictWeakOrdering);
 
-  __device__ void reverse() { this->_M_impl._M_node.reverse(); }
+  AICUDA_HD void reverse() { this->_M_impl._M_node.reverse(); }
 
-  __device__ void sort();
+  AICUDA_HD void sort();
 
   template <typename _StrictWeakOrdering>
-  __device__ void sort(_StrictWeakOrdering);
+  AICUDA_HD void sort(_StrictWeakOrdering);
 
  protected:
   template <typename _Integer>
-  __device__ void _M_initialize_dispatch(_Integer __n, _Integer __x,
-                                         __true_type) {
+  AICUDA_HD void _M_initialize_dispatch(_Integer __n, _Integer __x,
+                                        __true_type) {
     _M_fill_initialize(static_cast<size_type>(__n), __x);
   }
 
   template <typename _InputIterator>
-  __device__ void _M_initialize_dispatch(_InputIterator __first,
-                                         _InputIterator __last, __false_type) {
+  AICUDA_HD void _M_initialize_dispatch(_InputIterator __first,
+                                        _InputIterator __last, __false_type) {
     for (; __first != __last; ++__first) push_back(*__first);
   }
 
-  __device__ void _M_fill_initialize(size_type __n, const value_type &__x) {
+  AICUDA_HD void _M_fill_initialize(size_type __n, const value_type &__x) {
     for (; __n > 0; --__n) push_back(__x);
   }
 
   template <typename _Integer>
-  __device__ void _M_assign_dispatch(_Integer __n, _Integer __val,
-                                     __true_type) {
+  AICUDA_HD void _M_assign_dispatch(_Integer __n, _Integer __val,
+                                    __true_type) {
     _M_fill_assign(__n, __val);
   }
 
   template <typename _InputIterator>
-  __device__ void _M_assign_dispatch(_InputIterator __first,
-                                     _InputIterator __last, __false_type);
+  AICUDA_HD void _M_assign_dispatch(_InputIterator __first,
+                                    _InputIterator __last, __false_type);
 
-  __device__ void _M_fill_assign(size_type __n, const value_type &__val);
+  AICUDA_HD void _M_fill_assign(size_type __n, const value_type &__val);
 
-  __device__ void _M_transfer(iterator __position, iterator __first,
-                              iterator __last) {
+  AICUDA_HD void _M_transfer(iterator __position, iterator __first,
+                             iterator __last) {
     __position._M_node->transfer(__first._M_node, __last._M_node);
   }
 
-  __device__ void _M_insert(iterator __position, const value_type &__x) {
+  AICUDA_HD void _M_insert(iterator __position, const value_type &__x) {
     _Node *__tmp = _M_create_node(__x);
     __tmp->hook(__position._M_node);
   }
 
-  __device__ void _M_erase(iterator __position) {
+  AICUDA_HD void _M_erase(iterator __position) {
     __position._M_node->unhook();
     _Node *__n = static_cast<_Node *>(__position._M_node);
 
@@ -570,7 +572,7 @@ class list : protected _List_base<_Tp, _Alloc> {
     _M_put_node(__n);
   }
 
-  __device__ void _M_check_equal_allocators(list &__x) {
+  AICUDA_HD void _M_check_equal_allocators(list &__x) {
     if (aicuda::stl::__alloc_neq<typename _Base::_Node_alloc_type>::_S_do_it(
             _M_get_Node_allocator(), __x._M_get_Node_allocator())) {
       printf("list::_M_check_equal_allocators\n");
@@ -580,12 +582,12 @@ class list : protected _List_base<_Tp, _Alloc> {
 };
 
 template <typename _Tp, typename _Alloc>
-__device__ inline void swap(list<_Tp, _Alloc> &__x, list<_Tp, _Alloc> &__y) {
+AICUDA_HD inline void swap(list<_Tp, _Alloc> &__x, list<_Tp, _Alloc> &__y) {
   __x.swap(__y);
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void _List_base<_Tp, _Alloc>::_M_clear() {
+AICUDA_HD void _List_base<_Tp, _Alloc>::_M_clear() {
   typedef _List_node<_Tp> _Node;
   _Node *__cur = static_cast<_Node *>(this->_M_impl._M_node._M_next);
   while (__cur != &this->_M_impl._M_node) {
@@ -599,24 +601,24 @@ __device__ void _List_base<_Tp, _Alloc>::_M_clear() {
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ typename list<_Tp, _Alloc>::iterator list<_Tp, _Alloc>::insert(
-    iterator __position, const value_type &__x) {
+AICUDA_HD typename list<_Tp, _Alloc>::iterator list<_Tp, _Alloc>::insert(
+   iterator __position, const value_type &__x) {
   _Node *__tmp = _M_create_node(__x);
   __tmp->hook(__position._M_node);
   return iterator(__tmp);
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ typename list<_Tp, _Alloc>::iterator list<_Tp, _Alloc>::erase(
-    iterator __position) {
+AICUDA_HD typename list<_Tp, _Alloc>::iterator list<_Tp, _Alloc>::erase(
+   iterator __position) {
   iterator __ret = iterator(__position._M_node->_M_next);
   _M_erase(__position);
   return __ret;
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void list<_Tp, _Alloc>::resize(size_type __new_size,
-                                          value_type __x) {
+AICUDA_HD void list<_Tp, _Alloc>::resize(size_type __new_size,
+                                         value_type __x) {
   iterator __i = begin();
   size_type __len = 0;
   for (; __i != end() && __len < __new_size; ++__i, ++__len)
@@ -628,7 +630,7 @@ __device__ void list<_Tp, _Alloc>::resize(size_type __new_size,
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ list<_Tp, _Alloc> &list<_Tp, _Alloc>::operator=(const list &__x) {
+AICUDA_HD list<_Tp, _Alloc> &list<_Tp, _Alloc>::operator=(const list &__x) {
   if (this != &__x) {
     iterator __first1 = begin();
     iterator __last1 = end();
@@ -645,8 +647,8 @@ __device__ list<_Tp, _Alloc> &list<_Tp, _Alloc>::operator=(const list &__x) {
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void list<_Tp, _Alloc>::_M_fill_assign(size_type __n,
-                                                  const value_type &__val) {
+AICUDA_HD void list<_Tp, _Alloc>::_M_fill_assign(size_type __n,
+                                                 const value_type &__val) {
   iterator __i = begin();
   for (; __i != end() && __n > 0; ++__i, --__n) *__i = __val;
   if (__n > 0)
@@ -657,9 +659,9 @@ __device__ void list<_Tp, _Alloc>::_M_fill_assign(size_type __n,
 
 template <typename _Tp, typename _Alloc>
 template <typename _InputIterator>
-__device__ void list<_Tp, _Alloc>::_M_assign_dispatch(_InputIterator __first2,
-                                                      _InputIterator __last2,
-                                                      __false_type) {
+AICUDA_HD void list<_Tp, _Alloc>::_M_assign_dispatch(_InputIterator __first2,
+                                                     _InputIterator __last2,
+                                                     __false_type) {
   iterator __first1 = begin();
   iterator __last1 = end();
   for (; __first1 != __last1 && __first2 != __last2; ++__first1, ++__first2)
@@ -671,7 +673,7 @@ __device__ void list<_Tp, _Alloc>::_M_assign_dispatch(_InputIterator __first2,
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void list<_Tp, _Alloc>::remove(const value_type &__value) {
+AICUDA_HD void list<_Tp, _Alloc>::remove(const value_type &__value) {
   iterator __first = begin();
   iterator __last = end();
   iterator __extra = __last;
@@ -690,7 +692,7 @@ __device__ void list<_Tp, _Alloc>::remove(const value_type &__value) {
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void list<_Tp, _Alloc>::unique() {
+AICUDA_HD void list<_Tp, _Alloc>::unique() {
   iterator __first = begin();
   iterator __last = end();
   if (__first == __last) return;
@@ -705,7 +707,7 @@ __device__ void list<_Tp, _Alloc>::unique() {
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void list<_Tp, _Alloc>::merge(list &__x) {
+AICUDA_HD void list<_Tp, _Alloc>::merge(list &__x) {
   if (this != &__x) {
     _M_check_equal_allocators(__x);
 
@@ -726,8 +728,8 @@ __device__ void list<_Tp, _Alloc>::merge(list &__x) {
 
 template <typename _Tp, typename _Alloc>
 template <typename _StrictWeakOrdering>
-__device__ void list<_Tp, _Alloc>::merge(list &__x,
-                                         _StrictWeakOrdering __comp) {
+AICUDA_HD void list<_Tp, _Alloc>::merge(list &__x,
+                                        _StrictWeakOrdering __comp) {
   if (this != &__x) {
     _M_check_equal_allocators(__x);
 
@@ -747,7 +749,7 @@ __device__ void list<_Tp, _Alloc>::merge(list &__x,
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void list<_Tp, _Alloc>::sort() {
+AICUDA_HD void list<_Tp, _Alloc>::sort() {
   if (this->_M_impl._M_node._M_next != &this->_M_impl._M_node &&
       this->_M_impl._M_node._M_next->_M_next != &this->_M_impl._M_node) {
     list __carry;
@@ -775,7 +777,7 @@ __device__ void list<_Tp, _Alloc>::sort() {
 
 template <typename _Tp, typename _Alloc>
 template <typename _Predicate>
-__device__ void list<_Tp, _Alloc>::remove_if(_Predicate __pred) {
+AICUDA_HD void list<_Tp, _Alloc>::remove_if(_Predicate __pred) {
   iterator __first = begin();
   iterator __last = end();
   while (__first != __last) {
@@ -788,7 +790,7 @@ __device__ void list<_Tp, _Alloc>::remove_if(_Predicate __pred) {
 
 template <typename _Tp, typename _Alloc>
 template <typename _BinaryPredicate>
-__device__ void list<_Tp, _Alloc>::unique(_BinaryPredicate __binary_pred) {
+AICUDA_HD void list<_Tp, _Alloc>::unique(_BinaryPredicate __binary_pred) {
   iterator __first = begin();
   iterator __last = end();
   if (__first == __last) return;
@@ -804,7 +806,7 @@ __device__ void list<_Tp, _Alloc>::unique(_BinaryPredicate __binary_pred) {
 
 template <typename _Tp, typename _Alloc>
 template <typename _StrictWeakOrdering>
-__device__ void list<_Tp, _Alloc>::sort(_StrictWeakOrdering __comp) {
+AICUDA_HD void list<_Tp, _Alloc>::sort(_StrictWeakOrdering __comp) {
   if (this->_M_impl._M_node._M_next != &this->_M_impl._M_node &&
       this->_M_impl._M_node._M_next->_M_next != &this->_M_impl._M_node) {
     list __carry;
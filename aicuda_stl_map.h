@@ -25,6 +25,7 @@
 #ifndef _AICUDA_STL_MAP_H_
 #define _AICUDA_STL_MAP_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <aicuda_stl_tree.h>
 #include <assert.h>
 
@@ -54,11 +55,11 @@ class map {
    protected:
     _Compare comp;
 
-    __device__ value_compare(_Compare __c) : comp(__c) {}
+    AICUDA_HD value_compare(_Compare __c) : comp(__c) {}
 
    public:
-    __device__ bool operator()(const value_type &__x,
-                               const value_type &__y) const {
+    AICUDA_HD bool operator()(const value_type &__x,
+                              const value_type &__y) const {
       return comp(__x.first, __y.first);
     }
   };
@@ -84,59 +85,59 @@ class map {
   typedef typename _Rep_type::reverse_iterator reverse_iterator;
   typedef typename _Rep_type::const_reverse_iterator const_reverse_iterator;
 
-  __device__ map() : _M_t() {}
+  AICUDA_HD map() : _M_t() {}
 
-  __device__ explicit map(const _Compare &__comp,
-                          const allocator_type &__a = allocator_type())
+  AICUDA_HD explicit map(const _Compare &__comp,
+                         const allocator_type &__a = allocator_type())
       : _M_t(__comp, __a) {}
 
-  __device__ map(const map &__x) : _M_t(__x._M_t) {}
+  AICUDA_HD map(const map &__x) : _M_t(__x._M_t) {}
 
   template <typename _InputIterator>
-  __device__ map(_InputIterator __first, _InputIterator __last) : _M_t() {
+  AICUDA_HD map(_InputIterator __first, _InputIterator __last) : _M_t() {
     _M_t._M_insert_unique(__first, __last);
   }
 
   template <typename _InputIterator>
-  __device__ map(_InputIterator __first, _InputIterator __last,
-                 const _Compare &__comp,
-                 const allocator_type &__a = allocator_type())
+  AICUDA_HD map(_InputIterator __first, _InputIterator __last,
+                const _Compare &__comp,
+                const allocator_type &__a = allocator_type())
       : _M_t(__comp, __a) {
     _M_t._M_insert_unique(__first, __last);
   }
 
-  __device__ map &operator=(const map &__x) {
+  AICUDA_HD map &operator=(const map &__x) {
     _M_t = __x._M_t;
     return *this;
   }
 
-  __device__ allocator_type get_allocator() const {
+  AICUDA_HD allocator_type get_allocator() const {
     return _M_t.get_allocator();
   }
 
-  __device__ iterator begin() { return _M_t.begin(); }
+  AICUDA_HD iterator begin() { return _M_t.begin(); }
 
-  __device__ const_iterator begin() const { return _M_t.begin(); }
+  AICUDA_HD const_iterator begin() const { return _M_t.begin(); }
 
-  __device__ iterator end() { return _M_t.end(); }
+  AICUDA_HD iterator end() { return _M_t.end(); }
 
-  __device__ const_iterator end() const { return _M_t.end(); }
+  AICUDA_HD const_iterator end() const { return _M_t.end(); }
 
-  __device__ reverse_iterator rbegin() { return _M_t.rbegin(); }
+  AICUDA_HD reverse_iterator rbegin() { return _M_t.rbegin(); }
 
-  __device__ const_reverse_iterator rbegin() const { return _M_t.rbegin(); }
+  AICUDA_HD const_reverse_iterator rbegin() const { return _M_t.rbegin(); }
 
-  __device__ reverse_iterator rend() { return _M_t.rend(); }
+  AICUDA_HD reverse_iterator rend() { return _M_t.rend(); }
 
-  __device__ const_reverse_iterator rend() const { return _M_t.rend(); }
+  AICUDA_HD const_reverse_iterator rend() const { return _M_t.rend(); }
 
-  __device__ bool empty() const { return _M_t.empty(); }
+  AICUDA_HD bool empty() const { return _M_t.empty(); }
 
-  __device__ size_type size() const { return _M_t.size(); }
+  AICUDA_HD size_type size() const { return _M_t.size(); }
 
-  __device__ size_type max_size() const { return _M_t.max_size(); }
+  AICUDA_HD size_type max_size() const { return _M_t.max_size(); }
 
-  __device__ mapped_type &operator[](const key_type &__k) {
+  AICUDA_HD mapped_type &operator[](const key_type &__k) {
     iterator __i = lower_bound(__k);
 
     if (__i == end() || key_comp()(__k, (*__i).first))
@@ -144,89 +145,133 @@ class map {
     return (*__i).second;
   }
 
-  __device__ mapped_type &at(const key_type &__k) {
+  AICUDA_HD mapped_type &at(const key_type &__k) {
     iterator __i = lower_bound(__k);
     if (__i == end() || key_comp()(__k, (*__i).first)) assert(1 < 0);
     return (*__i).second;
   }
 
-  __device__ const mapped_type &at(const key_type &__k) const {
+  AICUDA_HD const mapped_type &at(const key_type &__k) const {
     const_iterator __i = lower_bound(__k);
     if (__i == end() || key_comp()(__k, (*__i).first)) assert(1 < 0);
     return (*__i).second;
   }
 
-  __device__ aicuda::stl::pair<iterator, bool> insert(const value_type &__x) {
+  AICUDA_HD aicuda::stl::pair<iterator, bool> insert(const value_type &__x) {
     return _M_t._M_insert_unique(__x);
   }
 
-  __device__ iterator insert(iterator __position, const value_type &__x) {
+  AICUDA_HD iterator insert(iterator __position, const value_type &__x) {
     return _M_t._M_insert_unique_(__position, __x);
   }
 
   template <typename _InputIterator>
-  __device__ void insert(_InputIterator __first, _InputIterator __last) {
+  AICUDA_HD void insert(_InputIterator __first, _InputIterator __last) {
     _M_t._M_insert_unique(__first, __last);
   }
 
-  __device__ void erase(iterator __position) { _M_t.erase(__position); }
+  AICUDA_HD void erase(iterator __position) { _M_t.erase(__position); }
 
-  __device__ size_type erase(const key_type &__x) { return _M_t.erase(__x); }
+  AICUDA_HD size_type erase(const key_type &__x) { return _M_t.erase(__x); }
 
-  __device__ void erase(iterator __first, iterator __last) {
+  AICUDA_HD void erase(iterator __first, iterator __last) {
     _M_t.erase(__first, __last);
   }
 
-  __device__ void swap(map &__x) { _M_t.swap(__x._M_t); }
+  AICUDA_HD void swap(map &__x) { _M_t.swap(__x._M_t); }
 
-  __device__ void clear() { _M_t.clear(); }
+  AICUDA_HD void clear() { _M_t.clear(); }
 
-  __device__ key_compare key_comp() const { return _M_t.key_comp(); }
+  AICUDA_HD key_compare key_comp() const { return _M_t.key_comp(); }
 
-  __device__ value_compare value_comp() const {
+  AICUDA_HD value_compare value_comp() const {
     return value_compare(_M_t.key_comp());
   }
 
-  __device__ iterator find(const key_type &__x) { return _M_t.find(__x); }
+  AICUDA_HD iterator find(const key_type &__x) { return _M_t.find(__x); }
 
-  __device__ const_iterator find(const key_type &__x) const {
+  AICUDA_HD const_iterator find(const key_type &__x) const {
     return _M_t.find(__x);
   }
 
-  __device__ size_type count(const key_type &__x) const {
+  AICUDA_HD size_type count(const key_type &__x) const {
     return _M_t.find(__x) == _M_t.end() ? 0 : 1;
   }
 
-  __device__ iterator lower_bound(const key_type &__x) {
+  AICUDA_HD iterator lower_bound(const key_type &__x) {
     return _M_t.lower_bound(__x);
   }
 
-  __device__ const_iterator lower_bound(const key_type &__x) const {
+  AICUDA_HD const_iterator lower_bound(const key_type &__x) const {
     return _M_t.lower_bound(__x);
   }
 
-  __device__ iterator upper_bound(const key_type &__x) {
+  AICUDA_HD iterator upper_bound(const key_type &__x) {
     return _M_t.upper_bound(__x);
   }
 
-  __device__ const_iterator upper_bound(const key_type &__x) const {
+  AICUDA_HD const_iterator upper_bound(const key_type &__x) const {
     return _M_t.upper_bound(__x);
   }
 
-  __device__ aicuda::stl::pair<iterator, iterator> equal_range(
-      const key_type &__x) {
+  AICUDA_HD aicuda::stl::pair<iterator, iterator> equal_range(
+     const key_type &__x) {
     return _M_t.equal_range(__x);
   }
 
-  __device__ aicuda::stl::pair<const_iterator, const_iterator> equal_range(
-      const key_type &__x) const {
+  AICUDA_HD aicuda::stl::pair<const_iterator, const_iterator> equal_range(
+     const key_type &__x) const {
     return _M_t.equal_range(__x);
   }
+
+  // Lookup by any key type the comparator can order against key_type, e.g.
+  // a string_view into a map<string, _Tp, less<> >.  Only available when
+  // _Compare is transparent.
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  find(const _Kt &__x) { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  find(const _Kt &__x) const { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, size_type>::__type
+  count(const _Kt &__x) const {
+    return _M_t._M_find_tr(__x) == _M_t.end() ? 0 : 1;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  lower_bound(const _Kt &__x) { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  lower_bound(const _Kt &__x) const { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  upper_bound(const _Kt &__x) { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  upper_bound(const _Kt &__x) const { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt, aicuda::stl::pair<iterator, iterator>>::__type
+  equal_range(const _Kt &__x) { return _M_t._M_equal_range_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt,
+      aicuda::stl::pair<const_iterator, const_iterator>>::__type
+  equal_range(const _Kt &__x) const { return _M_t._M_equal_range_tr(__x); }
 };
 
 template <typename _Key, typename _Tp, typename _Compare, typename _Alloc>
-__device__ inline void swap(map<_Key, _Tp, _Compare, _Alloc> &__x,
-                            map<_Key, _Tp, _Compare, _Alloc> &__y) {
+AICUDA_HD inline void swap(map<_Key, _Tp, _Compare, _Alloc> &__x,
+                           map<_Key, _Tp, _Compare, _Alloc> &__y) {
   __x.swap(__y);
 }
 
@@ -253,11 +298,11 @@ class multimap {
    protected:
     _Compare comp;
 
-    __device__ value_compare(_Compare __c) : comp(__c) {}
+    AICUDA_HD value_compare(_Compare __c) : comp(__c) {}
 
    public:
-    __device__ bool operator()(const value_type &__x,
-                               const value_type &__y) const {
+    AICUDA_HD bool operator()(const value_type &__x,
+                              const value_type &__y) const {
       return comp(__x.first, __y.first);
     }
   };
@@ -283,129 +328,170 @@ class multimap {
   typedef typename _Rep_type::reverse_iterator reverse_iterator;
   typedef typename _Rep_type::const_reverse_iterator const_reverse_iterator;
 
-  __device__ multimap() : _M_t() {}
+  AICUDA_HD multimap() : _M_t() {}
 
-  __device__ explicit multimap(const _Compare &__comp,
-                               const allocator_type &__a = allocator_type())
+  AICUDA_HD explicit multimap(const _Compare &__comp,
+                              const allocator_type &__a = allocator_type())
       : _M_t(__comp, __a) {}
 
-  __device__ multimap(const multimap &__x) : _M_t(__x._M_t) {}
+  AICUDA_HD multimap(const multimap &__x) : _M_t(__x._M_t) {}
 
   template <typename _InputIterator>
-  __device__ multimap(_InputIterator __first, _InputIterator __last) : _M_t() {
+  AICUDA_HD multimap(_InputIterator __first, _InputIterator __last) : _M_t() {
     _M_t._M_insert_equal(__first, __last);
   }
 
   template <typename _InputIterator>
-  __device__ multimap(_InputIterator __first, _InputIterator __last,
-                      const _Compare &__comp,
-                      const allocator_type &__a = allocator_type())
+  AICUDA_HD multimap(_InputIterator __first, _InputIterator __last,
+                     const _Compare &__comp,
+                     const allocator_type &__a = allocator_type())
       : _M_t(__comp, __a) {
     _M_t._M_insert_equal(__first, __last);
   }
 
-  __device__ multimap &operator=(const multimap &__x) {
+  AICUDA_HD multimap &operator=(const multimap &__x) {
     _M_t = __x._M_t;
     return *this;
   }
 
-  __device__ allocator_type get_allocator() const {
+  AICUDA_HD allocator_type get_allocator() const {
     return _M_t.get_allocator();
   }
 
-  __device__ iterator begin() { return _M_t.begin(); }
+  AICUDA_HD iterator begin() { return _M_t.begin(); }
 
-  __device__ const_iterator begin() const { return _M_t.begin(); }
+  AICUDA_HD const_iterator begin() const { return _M_t.begin(); }
 
-  __device__ iterator end() { return _M_t.end(); }
+  AICUDA_HD iterator end() { return _M_t.end(); }
 
-  __device__ const_iterator end() const { return _M_t.end(); }
+  AICUDA_HD const_iterator end() const { return _M_t.end(); }
 
-  __device__ reverse_iterator rbegin() { return _M_t.rbegin(); }
+  AICUDA_HD reverse_iterator rbegin() { return _M_t.rbegin(); }
 
-  __device__ const_reverse_iterator rbegin() const { return _M_t.rbegin(); }
+  AICUDA_HD const_reverse_iterator rbegin() const { return _M_t.rbegin(); }
 
-  __device__ reverse_iterator rend() { return _M_t.rend(); }
+  AICUDA_HD reverse_iterator rend() { return _M_t.rend(); }
 
-  __device__ const_reverse_iterator rend() const { return _M_t.rend(); }
+  AICUDA_HD const_reverse_iterator rend() const { return _M_t.rend(); }
 
-  __device__ bool empty() const { return _M_t.empty(); }
+  AICUDA_HD bool empty() const { return _M_t.empty(); }
 
-  __device__ size_type size() const { return _M_t.size(); }
+  AICUDA_HD size_type size() const { return _M_t.size(); }
 
-  __device__ size_type max_size() const { return _M_t.max_size(); }
+  AICUDA_HD size_type max_size() const { return _M_t.max_size(); }
 
-  __device__ iterator insert(const value_type &__x) {
+  AICUDA_HD iterator insert(const value_type &__x) {
     return _M_t._M_insert_equal(__x);
   }
 
-  __device__ iterator insert(iterator __position, const value_type &__x) {
+  AICUDA_HD iterator insert(iterator __position, const value_type &__x) {
     return _M_t._M_insert_equal_(__position, __x);
   }
 
   template <typename _InputIterator>
-  __device__ void insert(_InputIterator __first, _InputIterator __last) {
+  AICUDA_HD void insert(_InputIterator __first, _InputIterator __last) {
     _M_t._M_insert_equal(__first, __last);
   }
 
-  __device__ void erase(iterator __position) { _M_t.erase(__position); }
+  AICUDA_HD void erase(iterator __position) { _M_t.erase(__position); }
 
-  __device__ size_type erase(const key_type &__x) { return _M_t.erase(__x); }
+  AICUDA_HD size_type erase(const key_type &__x) { return _M_t.erase(__x); }
 
-  __device__ void erase(iterator __first, iterator __last) {
+  AICUDA_HD void erase(iterator __first, iterator __last) {
     _M_t.erase(__first, __last);
   }
 
-  __device__ void swap(multimap &__x) { _M_t.swap(__x._M_t); }
+  AICUDA_HD void swap(multimap &__x) { _M_t.swap(__x._M_t); }
 
-  __device__ void clear() { _M_t.clear(); }
+  AICUDA_HD void clear() { _M_t.clear(); }
 
-  __device__ key_compare key_comp() const { return _M_t.key_comp(); }
+  AICUDA_HD key_compare key_comp() const { return _M_t.key_comp(); }
 
-  __device__ value_compare value_comp() const {
+  AICUDA_HD value_compare value_comp() const {
     return value_compare(_M_t.key_comp());
   }
 
-  __device__ iterator find(const key_type &__x) { return _M_t.find(__x); }
+  AICUDA_HD iterator find(const key_type &__x) { return _M_t.find(__x); }
 
-  __device__ const_iterator find(const key_type &__x) const {
+  AICUDA_HD const_iterator find(const key_type &__x) const {
     return _M_t.find(__x);
   }
 
-  __device__ size_type count(const key_type &__x) const {
+  AICUDA_HD size_type count(const key_type &__x) const {
     return _M_t.count(__x);
   }
 
-  __device__ iterator lower_bound(const key_type &__x) {
+  AICUDA_HD iterator lower_bound(const key_type &__x) {
     return _M_t.lower_bound(__x);
   }
 
-  __device__ const_iterator lower_bound(const key_type &__x) const {
+  AICUDA_HD const_iterator lower_bound(const key_type &__x) const {
     return _M_t.lower_bound(__x);
   }
 
-  __device__ iterator upper_bound(const key_type &__x) {
+  AICUDA_HD iterator upper_bound(const key_type &__x) {
     return _M_t.upper_bound(__x);
   }
 
-  __device__ const_iterator upper_bound(const key_type &__x) const {
+  AICUDA_HD const_iterator upper_bound(const key_type &__x) const {
     return _M_t.upper_bound(__x);
   }
 
-  __device__ aicuda::stl::pair<iterator, iterator> equal_range(
-      const key_type &__x) {
+  AICUDA_HD aicuda::stl::pair<iterator, iterator> equal_range(
+     const key_type &__x) {
     return _M_t.equal_range(__x);
   }
 
-  __device__ aicuda::stl::pair<const_iterator, const_iterator> equal_range(
-      const key_type &__x) const {
+  AICUDA_HD aicuda::stl::pair<const_iterator, const_iterator> equal_range(
+     const key_type &__x) const {
     return _M_t.equal_range(__x);
   }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  find(const _Kt &__x) { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  find(const _Kt &__x) const { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, size_type>::__type
+  count(const _Kt &__x) const {
+    return _M_t._M_count_tr(__x);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  lower_bound(const _Kt &__x) { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  lower_bound(const _Kt &__x) const { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  upper_bound(const _Kt &__x) { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  upper_bound(const _Kt &__x) const { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt, aicuda::stl::pair<iterator, iterator>>::__type
+  equal_range(const _Kt &__x) { return _M_t._M_equal_range_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt,
+      aicuda::stl::pair<const_iterator, const_iterator>>::__type
+  equal_range(const _Kt &__x) const { return _M_t._M_equal_range_tr(__x); }
 };
 
 template <typename _Key, typename _Tp, typename _Compare, typename _Alloc>
-__device__ inline void swap(multimap<_Key, _Tp, _Compare, _Alloc> &__x,
-                            multimap<_Key, _Tp, _Compare, _Alloc> &__y) {
+AICUDA_HD inline void swap(multimap<_Key, _Tp, _Compare, _Alloc> &__x,
+                           multimap<_Key, _Tp, _Compare, _Alloc> &__y) {
   __x.swap(__y);
 }
 
@@ -25,40 +25,82 @@
 #ifndef _AICUDA_STL_MEMORY_H_
 #define _AICUDA_STL_MEMORY_H_ 1
 
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_charconv.h>
+
 namespace aicuda {
 namespace stl {
 
 class string_op {
  public:
-  __device__ static inline void *memset(void *s, int c, size_t n) {
+  AICUDA_HD static inline void *memset(void *s, int c, size_t n) {
     unsigned char *p = (unsigned char *)s;
-    for (size_t i = 0; i < n; ++i) {
-      p[i] = c;
+    if (n >= 32) {
+      for (; (size_t)p & 15; --n) *p++ = (unsigned char)c;
+      const _Word8 w = _S_lsb_bytes * (unsigned char)c;
+      const _Word16 v = {w, w};
+      for (; n >= 16; n -= 16, p += 16) *(_Word16 *)p = v;
     }
+    for (; n; --n) *p++ = (unsigned char)c;
     return s;
   }
 
-  __device__ static inline void *memcpy(void *s1, const void *s2, size_t n) {
-    unsigned char *p1 = (unsigned char *)s1;
-    const unsigned char *p2 = (const unsigned char *)s2;
-
-    for (size_t i = 0; i < n; ++i) {
-      p1[i] = p2[i];
+  // Fills n bytes at s with repeats of the size-byte pattern, as BSD's
+  // memset_pattern4/8/16.  Patterns whose size divides 16 are stored 16
+  // bytes at a time.
+  AICUDA_HD static inline void *memset_pattern(void *s, const void *pattern,
+                                               size_t size, size_t n) {
+    unsigned char *p = (unsigned char *)s;
+    const unsigned char *pat = (const unsigned char *)pattern;
+    size_t k = 0;
+    if (n >= 32 && 16 % size == 0) {
+      for (; (size_t)p & 15; --n) {
+        *p++ = pat[k];
+        if (++k == size) k = 0;
+      }
+      _Word16 v;
+      for (size_t i = 0; i < 16; ++i)
+        ((unsigned char *)&v)[i] = pat[(k + i) % size];
+      for (; n >= 16; n -= 16, p += 16) *(_Word16 *)p = v;
+    }
+    for (; n; --n) {
+      *p++ = pat[k];
+      if (++k == size) k = 0;
     }
+    return s;
+  }
+
+  AICUDA_HD static inline void *memcpy(void *s1, const void *s2, size_t n) {
+    _S_copy_forward((unsigned char *)s1, (const unsigned char *)s2, n);
     return s1;
   }
 
-  __device__ static inline size_t strlen(const char *s) {
-    size_t size = 0;
-    while (*s++ != '\0') ++size;
-    return size;
+  // Scans a word at a time once s is aligned; the aligned word holding the
+  // terminator may be read past it, which cannot fault.
+  AICUDA_NO_SANITIZE_ADDRESS AICUDA_HD static inline size_t strlen(
+      const char *s) {
+    const char *p = s;
+    for (; (size_t)p & (sizeof(_Word8) - 1); ++p)
+      if (*p == '\0') return p - s;
+    const _Word8 *w = (const _Word8 *)p;
+    while (!_S_zero_bytes(*w)) ++w;
+    return (const char *)w - s + _S_first_marked_byte(_S_zero_bytes(*w));
   }
 
-  __device__ static inline int memcmp(const void *s1, const void *s2,
-                                      size_t n) {
+  AICUDA_HD static inline int memcmp(const void *s1, const void *s2,
+                                     size_t n) {
     const unsigned char *p1 = (const unsigned char *)s1;
     const unsigned char *p2 = (const unsigned char *)s2;
 
+    // Skip equal words while both sides can be read aligned; the byte loop
+    // below then locates the difference inside the first unequal word.
+    if (n >= 16 && _S_common_align(p1, p2) >= sizeof(_Word8)) {
+      for (; (size_t)p1 & (sizeof(_Word8) - 1); ++p1, ++p2, --n)
+        if (*p1 != *p2) return *p1 - *p2;
+      for (; n >= sizeof(_Word8); p1 += 8, p2 += 8, n -= 8)
+        if (*(const _Word8 *)p1 != *(const _Word8 *)p2) break;
+    }
+
     for (size_t i = 0; i < n; ++i) {
       if (p1[i] != p2[i]) {
         return p1[i] - p2[i];
@@ -68,37 +110,86 @@ class string_op {
     return 0;
   }
 
-  __device__ static inline void *memchr(const void *s1, int ch, size_t n) {
-    char *src = (char *)s1;
-    for (size_t i = 0; i < n; ++i) {
-      if (src[i] == ch) {
-        return src + i;
+  AICUDA_HD static inline void *memchr(const void *s1, int ch, size_t n) {
+    const unsigned char *p = (const unsigned char *)s1;
+    const unsigned char c = (unsigned char)ch;
+
+    if (n >= 16) {
+      for (; (size_t)p & (sizeof(_Word8) - 1); ++p, --n)
+        if (*p == c) return (void *)p;
+      const _Word8 pattern = _S_lsb_bytes * c;
+      for (; n >= sizeof(_Word8); p += 8, n -= 8) {
+        const _Word8 m = _S_zero_bytes(*(const _Word8 *)p ^ pattern);
+        if (m) return (void *)(p + _S_first_marked_byte(m));
       }
     }
+
+    for (; n; ++p, --n)
+      if (*p == c) return (void *)p;
     return NULL;
   }
 
-  __device__ static void *memmove(void *dst, const void *src, size_t count) {
-    char *tmpdst = (char *)dst;
-    char *tmpsrc = (char *)src;
+  // Last byte equal to ch among the n at s1, scanning down a word at a
+  // time once aligned.
+  AICUDA_HD static inline void *memrchr(const void *s1, int ch, size_t n) {
+    const unsigned char *p = (const unsigned char *)s1 + n;
+    const unsigned char c = (unsigned char)ch;
 
-    if (tmpdst <= tmpsrc || tmpdst >= tmpsrc + count) {
-      while (count--) {
-        *tmpdst++ = *tmpsrc++;
-      }
-    } else {
-      tmpdst = tmpdst + count - 1;
-      tmpsrc = tmpsrc + count - 1;
-      while (count--) {
-        *tmpdst-- = *tmpsrc--;
+    if (n >= 16) {
+      for (; (size_t)p & (sizeof(_Word8) - 1); --n)
+        if (*--p == c) return (void *)p;
+      const _Word8 pattern = _S_lsb_bytes * c;
+      for (; n >= sizeof(_Word8); n -= 8) {
+        p -= 8;
+        const _Word8 m = _S_exact_zero_bytes(*(const _Word8 *)p ^ pattern);
+        if (m) return (void *)(p + _S_last_marked_byte(m));
       }
     }
 
+    for (; n; --n)
+      if (*--p == c) return (void *)p;
+    return NULL;
+  }
+
+  // First occurrence of the nl-byte needle in the hl bytes at haystack.
+  // Candidates come from a memchr scan for the needle's first byte; once
+  // they cost more than twice the distance scanned, the search switches
+  // to Two-Way (Crochemore and Perrin), so it stays linear.
+  AICUDA_HD static inline void *memmem(const void *haystack, size_t hl,
+                                       const void *needle, size_t nl) {
+    const _Bytes<false> h = {(const unsigned char *)haystack, hl};
+    const _Bytes<false> n = {(const unsigned char *)needle, nl};
+    const size_t i = _S_search(h, n);
+    return i == size_t(-1) ? NULL : (void *)((const unsigned char *)haystack + i);
+  }
+
+  // Last occurrence: memmem on both strings read backwards.
+  AICUDA_HD static inline void *memrmem(const void *haystack, size_t hl,
+                                        const void *needle, size_t nl) {
+    const _Bytes<true> h = {(const unsigned char *)haystack, hl};
+    const _Bytes<true> n = {(const unsigned char *)needle, nl};
+    const size_t i = _S_search(h, n);
+    return i == size_t(-1)
+               ? NULL
+               : (void *)((const unsigned char *)haystack + (hl - nl - i));
+  }
+
+  AICUDA_HD static void *memmove(void *dst, const void *src, size_t count) {
+    unsigned char *d = (unsigned char *)dst;
+    const unsigned char *s = (const unsigned char *)src;
+
+    // Every word is loaded before it is stored, so copying upwards is safe
+    // when the destination starts below the source, and downwards otherwise.
+    if (d <= s || d >= s + count)
+      _S_copy_forward(d, s, count);
+    else
+      _S_copy_backward(d + count, s + count, count);
+
     return dst;
   }
 
-  __device__ static inline void strlcpy(char *dest, const char *source,
-                                        size_t max) {
+  AICUDA_HD static inline void strlcpy(char *dest, const char *source,
+                                       size_t max) {
     max = max == 0 ? 1 : max;
     const char *end = source + (max - 1);
     for (; source != end; ++source, ++dest) {
@@ -108,7 +199,7 @@ class string_op {
     *dest = '\0';
   }
 
-  __device__ static inline int strcmp(const char *left, const char *right) {
+  AICUDA_HD static inline int strcmp(const char *left, const char *right) {
     while (*left != '\0' && *right != '\0') {
       if (*left != *right) return -1;
 
@@ -122,153 +213,157 @@ class string_op {
   }
   
 
-  __device__ static inline int isspace(int x) {
+  AICUDA_HD static inline int isspace(int x) {
     if (x == ' ' || x == '\t' || x == '\n' || x == '\f' || x == '\b' ||
         x == '\r')
       return 1;
     else
       return 0;
   }
-  __device__ static inline int isdigit(int x) {
+  AICUDA_HD static inline int isdigit(int x) {
     if (x <= '9' && x >= '0')
       return 1;
     else
       return 0;
   }
-  __device__ static inline int atoi(const char *nptr) {
-    int c;     /* current char */
-    int total; /* current total */
-    int sign;  /* if '-', then negative, otherwise positive */
-    /* skip whitespace */
-    while (isspace((int)(unsigned char)*nptr)) ++nptr;
-    c = (int)(unsigned char)*nptr++;
-    sign = c; /* save sign indication */
-    if (c == '-' || c == '+') c = (int)(unsigned char)*nptr++; /* skip sign */
-    total = 0;
-    while (isdigit(c)) {
-      total = 10 * total + (c - '0');  /* accumulate digit */
-      c = (int)(unsigned char)*nptr++; /* get next char */
-    }
-    if (sign == '-')
-      return -total;
-    else
-      return total; /* return result, negated if necessary */
+  // Leading whitespace and a sign are skipped and the digits read by
+  // from_chars; values out of range clamp to the nearest limit, as strtol.
+  AICUDA_HD static inline int atoi(const char *nptr) {
+    return _S_parse_signed<int>(nptr);
   }
 
-  __device__ static long inline atol(const char *nptr) {
-    int c;
-    int sign;
-    long total;
-    while (isspace((int)(unsigned char)*nptr)) {
-      ++nptr;
-    }
-    c = (int)(unsigned char)*nptr++;
-    sign = c;
-    if (c == '-' || c == '+') {
-      c = (int)(unsigned char)*nptr++;
-    }
-    total = 0;
-    while (isdigit(c)) {
-      total = 10 * total + (c - '0');
-      c = (int)(unsigned char)*nptr++;
-    }
-    return (sign == '-') ? -total : total;
+  AICUDA_HD static long inline atol(const char *nptr) {
+    return _S_parse_signed<long>(nptr);
   }
 
-  __device__ static inline char *strstr(const char *str1, const char *str2) {
-    int n;
-    if (*str2) {
-      while (*str1) {
-        for (n = 0; *(str1 + n) == *(str2 + n); n++) {
-          if (!*(str2 + n + 1)) {
-            return (char *)str1;
-          }
-        }
-        str1++;
-      }
-      return NULL;
-    }
-    return NULL;
+  // An empty needle matches nothing here, unlike C's strstr.
+  AICUDA_HD static inline char *strstr(const char *str1, const char *str2) {
+    const size_t nl = strlen(str2);
+    if (!nl) return NULL;
+    return (char *)memmem(str1, strlen(str1), str2, nl);
   }
-  __device__ static inline int tolower(int c) {
+  AICUDA_HD static inline int tolower(int c) {
     if ((c >= 'A') && (c <= 'Z')) return c + ('a' - 'A');
     return c;
   }
 
-  __device__ static inline int toupper(int c) {
+  AICUDA_HD static inline int toupper(int c) {
     if ((c >= 'a') && (c <= 'z')) return c + ('A' - 'a');
     return c;
   }
-  __device__ static inline char *strchr(const char *str, int ch) {
+  AICUDA_HD static inline char *strchr(const char *str, int ch) {
     while (*str && *str != (char)ch) str++;
 
     if (*str == (char)ch) return ((char *)str);
     return (NULL);
   }
-  __device__  static inline bool is_character_in_string(char ch, char* str)
+  AICUDA_HD  static inline bool is_character_in_string(char ch, char* str)
   {
       //assert(string != NULL);
-      while(*str)
-      {
-          if(ch==*str++)
-          {
-              return true;
-          }
-      }
-      return false;
+      return ch != '\0' && strchr(str, ch) != NULL;
   }
-  __device__ static inline int strspn(const char *s,const char *accept)
+
+  // Length of the leading run of the n bytes at s that are in (memspn) or
+  // not in (memcspn) the k-byte set; memrspn and memrcspn measure the
+  // trailing run.  The set is turned into a 256-bit map once, so a scan
+  // costs one lookup per byte whatever k is; a one-byte set scans words.
+  AICUDA_HD static inline size_t memspn(const void *s, size_t n,
+                                        const void *set, size_t k) {
+    const unsigned char *p = (const unsigned char *)s;
+    if (k == 1) return _S_run(p, n, *(const unsigned char *)set);
+    const _Byteset b = _S_byteset((const unsigned char *)set, k);
+    size_t i = 0;
+    while (i < n && b.has(p[i])) ++i;
+    return i;
+  }
+
+  AICUDA_HD static inline size_t memcspn(const void *s, size_t n,
+                                         const void *set, size_t k) {
+    const unsigned char *p = (const unsigned char *)s;
+    if (k == 1) {
+      const void *r = memchr(p, *(const unsigned char *)set, n);
+      return r ? size_t((const unsigned char *)r - p) : n;
+    }
+    const _Byteset b = _S_byteset((const unsigned char *)set, k);
+    size_t i = 0;
+    while (i < n && !b.has(p[i])) ++i;
+    return i;
+  }
+
+  AICUDA_HD static inline size_t memrspn(const void *s, size_t n,
+                                         const void *set, size_t k) {
+    const unsigned char *p = (const unsigned char *)s;
+    if (k == 1) return _S_rrun(p, n, *(const unsigned char *)set);
+    const _Byteset b = _S_byteset((const unsigned char *)set, k);
+    size_t i = n;
+    while (i && b.has(p[i - 1])) --i;
+    return n - i;
+  }
+
+  AICUDA_HD static inline size_t memrcspn(const void *s, size_t n,
+                                          const void *set, size_t k) {
+    const unsigned char *p = (const unsigned char *)s;
+    if (k == 1) {
+      const void *r = memrchr(p, *(const unsigned char *)set, n);
+      return r ? n - 1 - size_t((const unsigned char *)r - p) : n;
+    }
+    const _Byteset b = _S_byteset((const unsigned char *)set, k);
+    size_t i = n;
+    while (i && !b.has(p[i - 1])) --i;
+    return n - i;
+  }
+
+  AICUDA_HD static inline int strspn(const char *s,const char *accept)
   {  
-      const char *p;
-      const char *a;
-      int count = 0;
-      for(p = s; *p != '\0'; ++p)
-      {
-          for (a = accept; *a != '\0'; ++a)
-          {
-              if (*p == *a)
-              {
-                  break;
-              }
-          }
-          if (*a == '\0')
-          {
-              return count;
-          }
-          ++count;
+      if (accept[0] == '\0') return 0;
+      const char *p = s;
+      if (accept[1] == '\0') {
+          while (*p == accept[0]) ++p;
+          return p - s;
       }
-      return count;
+      const _Byteset b = _S_byteset(accept);
+      while (b.has((unsigned char)*p)) ++p;
+      return p - s;
   }
-  __device__ static inline char * strpbrk(const char * cs,const char * ct)
+  AICUDA_HD static inline size_t strcspn(const char *s, const char *reject)
   {
-      const char *sc1,*sc2;
-      for( sc1 = cs; *sc1 != '\0'; ++sc1) 
-      {
-          for( sc2 = ct; *sc2 != '\0'; ++sc2) 
-          {
-              if (*sc1 == *sc2)
-                  return (char *) sc1;
-          }
+      const char *p = s;
+      if (reject[0] == '\0' || reject[1] == '\0') {
+          while (*p && *p != reject[0]) ++p;
+          return p - s;
       }
-      return NULL;
+      _Byteset b = _S_byteset(reject);
+      b.add('\0');
+      while (!b.has((unsigned char)*p)) ++p;
+      return p - s;
+  }
+  AICUDA_HD static inline char * strpbrk(const char * cs,const char * ct)
+  {
+      const char *sc = cs + strcspn(cs, ct);
+      return *sc ? (char *)sc : NULL;
   }
 
 
-  __device__ static inline char *strtok_r(char *s, const char *delim, char **save_ptr) 
+  // The delimiter map is built once per call rather than once per scan.
+  AICUDA_HD static inline char *strtok_r(char *s, const char *delim, char **save_ptr) 
   {  
       char *token;
       if (s == NULL) s = *save_ptr;
+      const _Byteset b = _S_byteset(delim);
       /* Scan leading delimiters.  */
-      s += strspn(s, delim);
+      while (b.has((unsigned char)*s)) ++s;
       if (*s == '\0')
+      {
+          *save_ptr = s;
           return NULL;
+      }
       
       /* Find the end of the token.  */
       token = s;
-      s = strpbrk(token, delim);
-      if (s == NULL)
+      while (*s && !b.has((unsigned char)*s)) ++s;
+      if (*s == '\0')
           /* This token finishes the string.  */
-          *save_ptr = strchr(token, '\0');
+          *save_ptr = s;
       else
       {
           /* Terminate the token and make *SAVE_PTR point past it.  */
@@ -278,6 +373,318 @@ class string_op {
       
       return token;
   }
+
+ private:
+  typedef unsigned int AICUDA_MAY_ALIAS _Word4;
+  typedef unsigned long long AICUDA_MAY_ALIAS _Word8;
+  struct AICUDA_MAY_ALIAS _Word16 {
+    alignas(16) unsigned long long _M_lo;
+    unsigned long long _M_hi;
+  };
+
+  template <typename _Tp>
+  AICUDA_HD static inline _Tp _S_parse_signed(const char *nptr) {
+    while (isspace((int)(unsigned char)*nptr)) ++nptr;
+    const bool neg = *nptr == '-';
+    if (*nptr == '-' || *nptr == '+') ++nptr;
+    unsigned long long mag = 0;
+    const from_chars_result r = from_chars(nptr, nptr + strlen(nptr), mag);
+    const unsigned long long lim =
+        (1ULL << (sizeof(_Tp) * 8 - 1)) - (neg ? 0 : 1);
+    if (r.ec == errc::result_out_of_range || mag > lim) mag = lim;
+    return neg ? _Tp(0ULL - mag) : _Tp(mag);
+  }
+
+  static const unsigned long long _S_lsb_bytes = 0x0101010101010101ULL;
+  static const unsigned long long _S_msb_bytes = 0x8080808080808080ULL;
+
+  // Sets the high bit of every zero byte of v.  Bytes above the first zero
+  // may be marked spuriously; the lowest mark is always exact.
+  AICUDA_HD static inline unsigned long long _S_zero_bytes(unsigned long long v) {
+    return (v - _S_lsb_bytes) & ~v & _S_msb_bytes;
+  }
+
+  // Sets the high bit of exactly the zero bytes of v.
+  AICUDA_HD static inline unsigned long long _S_exact_zero_bytes(
+      unsigned long long v) {
+    const unsigned long long low7 = ~_S_msb_bytes;
+    return ~(((v & low7) + low7) | v | low7);
+  }
+
+  AICUDA_HD static inline size_t _S_last_marked_byte(unsigned long long m) {
+#if AICUDA_DEVICE_CODE
+    return size_t(63 - __clzll((long long)m)) >> 3;
+#else
+    return size_t(63 - __builtin_clzll(m)) >> 3;
+#endif
+  }
+
+  // One bit per byte value.
+  struct _Byteset {
+    unsigned int w[8];
+    AICUDA_HD void add(unsigned char c) { w[c >> 5] |= 1u << (c & 31); }
+    AICUDA_HD bool has(unsigned char c) const {
+      return (w[c >> 5] >> (c & 31)) & 1;
+    }
+  };
+
+  AICUDA_HD static inline _Byteset _S_byteset(const unsigned char *set,
+                                              size_t k) {
+    _Byteset b = {{0, 0, 0, 0, 0, 0, 0, 0}};
+    for (size_t i = 0; i < k; ++i) b.add(set[i]);
+    return b;
+  }
+
+  // The bytes of the string set, without its terminator.
+  AICUDA_HD static inline _Byteset _S_byteset(const char *set) {
+    _Byteset b = {{0, 0, 0, 0, 0, 0, 0, 0}};
+    for (; *set; ++set) b.add((unsigned char)*set);
+    return b;
+  }
+
+  // Length of the leading (_S_run) or trailing (_S_rrun) run of c in the n
+  // bytes at p, comparing whole words once aligned.
+  AICUDA_HD static inline size_t _S_run(const unsigned char *p, size_t n,
+                                        unsigned char c) {
+    const unsigned char *q = p;
+    const unsigned char *const end = p + n;
+    if (n >= 16) {
+      for (; (size_t)q & (sizeof(_Word8) - 1); ++q)
+        if (*q != c) return q - p;
+      const _Word8 pattern = _S_lsb_bytes * c;
+      for (; end - q >= 8; q += 8)
+        if (*(const _Word8 *)q != pattern) break;
+    }
+    while (q < end && *q == c) ++q;
+    return q - p;
+  }
+
+  AICUDA_HD static inline size_t _S_rrun(const unsigned char *p, size_t n,
+                                         unsigned char c) {
+    const unsigned char *q = p + n;
+    if (n >= 16) {
+      for (; (size_t)q & (sizeof(_Word8) - 1); --q)
+        if (q[-1] != c) return p + n - q;
+      const _Word8 pattern = _S_lsb_bytes * c;
+      for (; q - p >= 8; q -= 8)
+        if (*(const _Word8 *)(q - 8) != pattern) break;
+    }
+    while (q > p && q[-1] == c) --q;
+    return p + n - q;
+  }
+
+  // n bytes at p, read backwards when _Rev, so one search serves both
+  // directions.
+  template <bool _Rev>
+  struct _Bytes {
+    const unsigned char *p;
+    size_t n;
+    AICUDA_HD unsigned char operator[](size_t i) const {
+      return _Rev ? p[n - 1 - i] : p[i];
+    }
+  };
+
+  // Index of the first c in h[from, to), or -1.
+  AICUDA_HD static inline size_t _S_find_byte(const _Bytes<false> &h,
+                                              size_t from, size_t to,
+                                              unsigned char c) {
+    const void *r = memchr(h.p + from, c, to - from);
+    return r ? size_t((const unsigned char *)r - h.p) : size_t(-1);
+  }
+
+  AICUDA_HD static inline size_t _S_find_byte(const _Bytes<true> &h,
+                                              size_t from, size_t to,
+                                              unsigned char c) {
+    const void *r = memrchr(h.p + (h.n - to), c, to - from);
+    return r ? h.n - 1 - size_t((const unsigned char *)r - h.p) : size_t(-1);
+  }
+
+  template <bool _Rev>
+  AICUDA_HD static size_t _S_search(const _Bytes<_Rev> &h,
+                                    const _Bytes<_Rev> &n) {
+    const size_t l = n.n;
+    if (l > h.n) return size_t(-1);
+    if (l == 0) return 0;
+    const size_t last = h.n - l;
+    size_t pos = 0;
+    size_t work = 0;
+    for (;;) {
+      pos = _S_find_byte(h, pos, last + 1, n[0]);
+      if (pos == size_t(-1)) return pos;
+      size_t k = 1;
+      while (k < l && h[pos + k] == n[k]) ++k;
+      if (k == l) return pos;
+      if (++pos > last) return size_t(-1);
+      // Each candidate costs a scan call besides its comparison; dense
+      // candidates or long partial matches hand over to Two-Way.
+      work += k + 16;
+      if (work > 2 * pos + 256) return _S_two_way(h, pos, n);
+    }
+  }
+
+  // Two-Way from h[pos], after musl's memmem: the needle is split at a
+  // critical factorisation, the right part compared first and the left
+  // part second, and the byte under the window's end gives a skip.  The
+  // skips are capped at 255 to keep the table small on the device stack.
+  template <bool _Rev>
+  AICUDA_HD static size_t _S_two_way(const _Bytes<_Rev> &h, size_t pos,
+                                     const _Bytes<_Rev> &n) {
+    const size_t l = n.n;
+    unsigned char skip[256];
+    const unsigned char far = l < 255 ? (unsigned char)l : 255;
+    for (size_t i = 0; i < 256; ++i) skip[i] = far;
+    for (size_t i = 0; i < l; ++i)
+      skip[n[i]] = l - 1 - i < 255 ? (unsigned char)(l - 1 - i) : 255;
+
+    // Maximal suffix for each byte order; the later one is critical.
+    size_t ms, p0, ip, jp, k, p;
+    ip = size_t(-1);
+    jp = 0;
+    k = p = 1;
+    while (jp + k < l) {
+      if (n[ip + k] == n[jp + k]) {
+        if (k == p) {
+          jp += p;
+          k = 1;
+        } else {
+          ++k;
+        }
+      } else if (n[ip + k] > n[jp + k]) {
+        jp += k;
+        k = 1;
+        p = jp - ip;
+      } else {
+        ip = jp++;
+        k = p = 1;
+      }
+    }
+    ms = ip;
+    p0 = p;
+    ip = size_t(-1);
+    jp = 0;
+    k = p = 1;
+    while (jp + k < l) {
+      if (n[ip + k] == n[jp + k]) {
+        if (k == p) {
+          jp += p;
+          k = 1;
+        } else {
+          ++k;
+        }
+      } else if (n[ip + k] < n[jp + k]) {
+        jp += k;
+        k = 1;
+        p = jp - ip;
+      } else {
+        ip = jp++;
+        k = p = 1;
+      }
+    }
+    if (ip + 1 > ms + 1)
+      ms = ip;
+    else
+      p = p0;
+
+    // A periodic needle remembers how much of it already matched.
+    size_t mem0 = l - p;
+    for (size_t i = 0; i < ms + 1; ++i)
+      if (n[i] != n[i + p]) {
+        mem0 = 0;
+        p = (ms > l - ms - 1 ? ms : l - ms - 1) + 1;
+        break;
+      }
+
+    size_t mem = 0;
+    for (;;) {
+      if (h.n - pos < l) return size_t(-1);
+      k = skip[h[pos + l - 1]];
+      if (k) {
+        if (k < mem) k = mem;
+        pos += k;
+        mem = 0;
+        continue;
+      }
+      for (k = ms + 1 > mem ? ms + 1 : mem; k < l && n[k] == h[pos + k]; ++k) {
+      }
+      if (k < l) {
+        pos += k - ms;
+        mem = 0;
+        continue;
+      }
+      for (k = ms + 1; k > mem && n[k - 1] == h[pos + k - 1]; --k) {
+      }
+      if (k <= mem) return pos;
+      pos += p;
+      mem = mem0;
+    }
+  }
+
+  // Index of the lowest marked byte (both host and device are little-endian).
+  AICUDA_HD static inline size_t _S_first_marked_byte(unsigned long long m) {
+#if AICUDA_DEVICE_CODE
+    return size_t(__ffsll((long long)m) - 1) >> 3;
+#else
+    return size_t(__builtin_ctzll(m)) >> 3;
+#endif
+  }
+
+  // Widest word in which both pointers can be aligned at once.
+  AICUDA_HD static inline size_t _S_common_align(const void *d, const void *s) {
+    const size_t x = (size_t)d ^ (size_t)s;
+    return (x & 15) == 0 ? 16 : (x & 7) == 0 ? 8 : (x & 3) == 0 ? 4 : 1;
+  }
+
+  // Copies bytes until d is aligned, then whole words, then the tail.  Short
+  // copies and pointers that cannot share an alignment stay bytewise, since
+  // the device faults on misaligned wide accesses.
+  AICUDA_HD static inline void _S_copy_forward(unsigned char *d,
+                                               const unsigned char *s,
+                                               size_t n) {
+    const size_t w = n < 16 ? 1 : _S_common_align(d, s);
+    if (w > 1) {
+      for (; (size_t)d & (w - 1); --n) *d++ = *s++;
+      if (w == 16)
+        for (; n >= 16; n -= 16, d += 16, s += 16) {
+          const _Word16 t = *(const _Word16 *)s;
+          *(_Word16 *)d = t;
+        }
+      else if (w == 8)
+        for (; n >= 8; n -= 8, d += 8, s += 8) *(_Word8 *)d = *(const _Word8 *)s;
+      else
+        for (; n >= 4; n -= 4, d += 4, s += 4) *(_Word4 *)d = *(const _Word4 *)s;
+    }
+    for (; n; --n) *d++ = *s++;
+  }
+
+  // Same as _S_copy_forward, walking down from the ends d and s.
+  AICUDA_HD static inline void _S_copy_backward(unsigned char *d,
+                                                const unsigned char *s,
+                                                size_t n) {
+    const size_t w = n < 16 ? 1 : _S_common_align(d, s);
+    if (w > 1) {
+      for (; (size_t)d & (w - 1); --n) *--d = *--s;
+      if (w == 16)
+        for (; n >= 16; n -= 16) {
+          d -= 16;
+          s -= 16;
+          const _Word16 t = *(const _Word16 *)s;
+          *(_Word16 *)d = t;
+        }
+      else if (w == 8)
+        for (; n >= 8; n -= 8) {
+          d -= 8;
+          s -= 8;
+          *(_Word8 *)d = *(const _Word8 *)s;
+        }
+      else
+        for (; n >= 4; n -= 4) {
+          d -= 4;
+          s -= 4;
+          *(_Word4 *)d = *(const _Word4 *)s;
+        }
+    }
+    for (; n; --n) *--d = *--s;
+  }
 };
 
 }  // namespace stl
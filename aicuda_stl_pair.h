@@ -25,6 +25,8 @@
 #ifndef _AICUDA_STL_PAIR_H_
 #define _AICUDA_STL_PAIR_H_ 1
 
+#include <aicuda_stl_config.h>
+
 namespace aicuda
 {
 namespace stl
@@ -39,59 +41,59 @@ struct pair
   _T1 first;
   _T2 second;
 
-  __device__ pair() : first(), second() {}
+  AICUDA_HD pair() : first(), second() {}
 
-  __device__ pair(const _T1 &__a, const _T2 &__b) : first(__a), second(__b) {}
+  AICUDA_HD pair(const _T1 &__a, const _T2 &__b) : first(__a), second(__b) {}
 
   template <class _U1, class _U2>
-  __device__ pair(const pair<_U1, _U2> &__p)
+  AICUDA_HD pair(const pair<_U1, _U2> &__p)
       : first(__p.first), second(__p.second) {}
 };
 
 template <class _T1, class _T2>
-__device__ inline bool operator==(const pair<_T1, _T2> &__x,
-                                  const pair<_T1, _T2> &__y)
+AICUDA_HD inline bool operator==(const pair<_T1, _T2> &__x,
+                                 const pair<_T1, _T2> &__y)
 {
   return __x.first == __y.first && __x.second == __y.second;
 }
 
 template <class _T1, class _T2>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<(const pair<_T1, _T2> &__x, const pair<_T1, _T2> &__y)
 {
   return __x.first < __y.first || (!(__y.first < __x.first) && __x.second < __y.second);
 }
 
 template <class _T1, class _T2>
-__device__ inline bool
+AICUDA_HD inline bool
 operator!=(const pair<_T1, _T2> &__x, const pair<_T1, _T2> &__y)
 {
   return !(__x == __y);
 }
 
 template <class _T1, class _T2>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>(const pair<_T1, _T2> &__x, const pair<_T1, _T2> &__y)
 {
   return __y < __x;
 }
 
 template <class _T1, class _T2>
-__device__ inline bool
+AICUDA_HD inline bool
 operator<=(const pair<_T1, _T2> &__x, const pair<_T1, _T2> &__y)
 {
   return !(__y < __x);
 }
 
 template <class _T1, class _T2>
-__device__ inline bool
+AICUDA_HD inline bool
 operator>=(const pair<_T1, _T2> &__x, const pair<_T1, _T2> &__y)
 {
   return !(__x < __y);
 }
 
 template <class _T1, class _T2>
-__device__ inline pair<_T1, _T2> make_pair(_T1 __x, _T2 __y)
+AICUDA_HD inline pair<_T1, _T2> make_pair(_T1 __x, _T2 __y)
 {
   return pair<_T1, _T2>(__x, __y);
 }
@@ -0,0 +1,199 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_POOL_ALLOCATOR_H_
+#define _AICUDA_STL_POOL_ALLOCATOR_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <stddef.h>
+
+namespace aicuda {
+namespace stl {
+
+// Pool of equally sized nodes.  Nodes are carved out of chunks taken from the
+// global heap, and freed nodes go onto an intrusive free list that the next
+// allocation pops, so insert/erase churn does not touch the heap once the
+// pool has warmed up.  The node size is either given up front or fixed by the
+// first single-object allocation.  A node_pool is meant to be owned by a
+// single thread and must outlive every container using it.
+class node_pool {
+ public:
+  enum { _S_max_chunk_nodes = 4096 };
+
+  AICUDA_HD explicit node_pool(size_t __node_size = 0,
+                               size_t __nodes_per_chunk = 64)
+      : _M_node_size(0),
+        _M_nodes_per_chunk(__nodes_per_chunk ? __nodes_per_chunk : 1),
+        _M_free(0),
+        _M_chunks(0) {
+    if (__node_size) _M_bind(__node_size);
+  }
+
+  AICUDA_HD ~node_pool() {
+    while (_M_chunks) {
+      _Link *__next = _M_chunks->_M_next;
+      ::operator delete(_M_chunks);
+      _M_chunks = __next;
+    }
+  }
+
+  // Whether objects of this size and alignment are served from the pool.
+  AICUDA_HD bool _M_accepts(size_t __size, size_t __align) {
+    if (__align > sizeof(void *)) return false;
+    if (!_M_node_size) _M_bind(__size);
+    return __size <= _M_node_size;
+  }
+
+  AICUDA_HD void *allocate() {
+    if (!_M_free) _M_refill();
+    _Link *__p = _M_free;
+    _M_free = __p->_M_next;
+    return __p;
+  }
+
+  AICUDA_HD void deallocate(void *__p) {
+    _Link *__l = static_cast<_Link *>(__p);
+    __l->_M_next = _M_free;
+    _M_free = __l;
+  }
+
+  AICUDA_HD size_t node_size() const { return _M_node_size; }
+
+ private:
+  struct _Link {
+    _Link *_M_next;
+  };
+
+  // Chunks start with the link to the previous chunk; the header is padded
+  // so that the nodes keep the alignment operator new gives the chunk.
+  enum { _S_header_size = 2 * sizeof(void *) };
+
+  AICUDA_HD node_pool(const node_pool &);
+  AICUDA_HD node_pool &operator=(const node_pool &);
+
+  AICUDA_HD void _M_bind(size_t __size) {
+    if (__size < sizeof(_Link)) __size = sizeof(_Link);
+    _M_node_size = (__size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+  }
+
+  AICUDA_HD void _M_refill() {
+    char *__chunk = static_cast<char *>(
+        ::operator new(_S_header_size + _M_node_size * _M_nodes_per_chunk));
+    reinterpret_cast<_Link *>(__chunk)->_M_next = _M_chunks;
+    _M_chunks = reinterpret_cast<_Link *>(__chunk);
+
+    char *__nodes = __chunk + _S_header_size;
+    for (size_t __i = _M_nodes_per_chunk; __i-- > 0;)
+      deallocate(__nodes + __i * _M_node_size);
+
+    if (_M_nodes_per_chunk < _S_max_chunk_nodes) _M_nodes_per_chunk *= 2;
+  }
+
+  size_t _M_node_size;
+  size_t _M_nodes_per_chunk;
+  _Link *_M_free;
+  _Link *_M_chunks;
+};
+
+// Allocator serving single-object allocations (the _Rb_tree_node and
+// _List_node requests of map, set, multimap, multiset and list) from a
+// node_pool.  Array allocations, and objects larger than the pool's node,
+// go to the global heap, as does everything when no pool is attached.
+template <typename _Tp>
+class pool_allocator {
+ public:
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Tp *pointer;
+  typedef const _Tp *const_pointer;
+  typedef _Tp &reference;
+  typedef const _Tp &const_reference;
+  typedef _Tp value_type;
+
+  template <typename _Tp1>
+  struct rebind {
+    typedef pool_allocator<_Tp1> other;
+  };
+
+  AICUDA_HD pool_allocator() : _M_pool(0) {}
+
+  AICUDA_HD pool_allocator(node_pool &__p) : _M_pool(&__p) {}
+
+  AICUDA_HD pool_allocator(const pool_allocator &__a) : _M_pool(__a._M_pool) {}
+
+  template <typename _Tp1>
+  AICUDA_HD pool_allocator(const pool_allocator<_Tp1> &__a)
+      : _M_pool(__a._M_get_pool()) {}
+
+  AICUDA_HD ~pool_allocator() {}
+
+  AICUDA_HD pointer address(reference __x) const { return &__x; }
+
+  AICUDA_HD const_pointer address(const_reference __x) const { return &__x; }
+
+  AICUDA_HD pointer allocate(size_type __n, const void * = 0) {
+    if (__n == 1 && _M_pool && _M_pool->_M_accepts(sizeof(_Tp), alignof(_Tp)))
+      return static_cast<_Tp *>(_M_pool->allocate());
+    return static_cast<_Tp *>(::operator new(__n * sizeof(_Tp)));
+  }
+
+  AICUDA_HD void deallocate(pointer __p, size_type __n) {
+    if (__n == 1 && _M_pool && _M_pool->_M_accepts(sizeof(_Tp), alignof(_Tp)))
+      _M_pool->deallocate(__p);
+    else
+      ::operator delete(__p);
+  }
+
+  AICUDA_HD void construct(pointer __p, const _Tp &__val) {
+    ::new ((void *)__p) _Tp(__val);
+  }
+
+  AICUDA_HD void destroy(pointer __p) { __p->~_Tp(); }
+
+  AICUDA_HD constexpr size_type max_size() const {
+    return size_t(-1) / sizeof(_Tp);
+  }
+
+  AICUDA_HD node_pool *_M_get_pool() const { return _M_pool; }
+
+ private:
+  node_pool *_M_pool;
+};
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator==(const pool_allocator<_T1> &__x,
+                                 const pool_allocator<_T2> &__y) {
+  return __x._M_get_pool() == __y._M_get_pool();
+}
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator!=(const pool_allocator<_T1> &__x,
+                                 const pool_allocator<_T2> &__y) {
+  return __x._M_get_pool() != __y._M_get_pool();
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_POOL_ALLOCATOR_H_ */
@@ -0,0 +1,257 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_REGION_ALLOCATOR_H_
+#define _AICUDA_STL_REGION_ALLOCATOR_H_ 1
+
+#include <aicuda_stl_atomic.h>
+#include <aicuda_stl_config.h>
+#include <stddef.h>
+
+namespace aicuda {
+namespace stl {
+
+// Thread-safe heap over one caller-supplied region, e.g. a device buffer
+// handed to a persistent kernel at startup.  Blocks come in power-of-two size
+// classes from 32 bytes up; each class keeps a lock-free free list (a tagged
+// Treiber stack), fresh blocks are bump-carved from the untouched tail of the
+// region, and once the tail is used up a request may split a larger free
+// block, pushing the unused halves onto the smaller lists.  Freed blocks are
+// not coalesced.  Every block starts with a 16-byte header, so payloads are
+// 16-byte aligned.  Regions up to 64 GiB are supported.
+class region {
+ public:
+  enum { _S_align = 16, _S_min_block_shift = 5, _S_classes = 32 };
+
+  AICUDA_HD region(void *__buf, size_t __size) : _M_top(0), _M_used(0) {
+    const size_t __pad =
+        (0 - reinterpret_cast<size_t>(__buf)) & (size_t(_S_align) - 1);
+    _M_base = static_cast<char *>(__buf) + __pad;
+    _M_size = __size > __pad ? (__size - __pad) & ~(size_t(_S_align) - 1) : 0;
+    for (int __c = 0; __c < _S_classes; ++__c) _M_free[__c] = 0;
+  }
+
+  AICUDA_HD void *allocate(size_t __bytes) {
+    const int __c = _S_class_of(__bytes);
+    char *__blk = __c < _S_classes ? _M_pop(__c) : 0;
+    if (!__blk && __c < _S_classes) __blk = _M_carve(__c);
+    for (int __k = __c + 1; !__blk && __k < _S_classes; ++__k) {
+      __blk = _M_pop(__k);
+      if (__blk)
+        while (__k > __c) {
+          --__k;
+          _M_push(__k, __blk + _S_block_size(__k));
+        }
+    }
+    if (!__blk) {
+      printf("region::allocate exhausted : %lu bytes requested, %lu in use\n",
+             (unsigned long)__bytes, (unsigned long)used());
+      assert(1 < 0);
+      return 0;
+    }
+    reinterpret_cast<_Header *>(__blk)->_M_class = unsigned(__c);
+    __fetch_add(&_M_used, _S_block_size(__c));
+    return __blk + _S_align;
+  }
+
+  AICUDA_HD void deallocate(void *__p) {
+    if (!__p) return;
+    char *__blk = static_cast<char *>(__p) - _S_align;
+    const int __c = int(reinterpret_cast<_Header *>(__blk)->_M_class);
+    __fetch_add(&_M_used, 0 - _S_block_size(__c));
+    _M_push(__c, __blk);
+  }
+
+  // Bytes in blocks currently handed out, headers included.
+  AICUDA_HD size_t used() const { return size_t(__load_acquire(&_M_used)); }
+
+  // High-water mark of the carved part of the region.
+  AICUDA_HD size_t reserved() const { return size_t(__load_acquire(&_M_top)); }
+
+  AICUDA_HD size_t capacity() const { return _M_size; }
+
+ private:
+  AICUDA_HD region(const region &);
+  AICUDA_HD region &operator=(const region &);
+
+  struct _Header {
+    unsigned _M_class;
+    unsigned _M_pad;
+    unsigned long long _M_next;
+  };
+
+  AICUDA_HD static unsigned long long _S_block_size(int __c) {
+    return 1ULL << (__c + _S_min_block_shift);
+  }
+
+  AICUDA_HD static int _S_class_of(size_t __bytes) {
+    if (__bytes > (size_t(1) << (_S_classes + _S_min_block_shift - 1)) - _S_align)
+      return _S_classes;
+    int __c = 0;
+    while (_S_block_size(__c) < __bytes + _S_align) ++__c;
+    return __c;
+  }
+
+  // Free-list heads pack a modification tag in the high word and the block
+  // index (offset / _S_align, plus one so that zero means empty) in the low
+  // word; the tag keeps a pop from succeeding against a recycled head.
+  AICUDA_HD char *_M_block(unsigned long long __head) const {
+    return _M_base + (size_t(__head & 0xffffffffULL) - 1) * _S_align;
+  }
+
+  AICUDA_HD char *_M_pop(int __c) {
+    unsigned long long __head = __load_acquire(&_M_free[__c]);
+    while (__head & 0xffffffffULL) {
+      char *__blk = _M_block(__head);
+      // __blk may be popped and reused concurrently; the tag then fails the
+      // swap below, so a stale __next is never installed.
+      const unsigned long long __next =
+          __load_acquire(&reinterpret_cast<_Header *>(__blk)->_M_next);
+      const unsigned long long __new =
+          (((__head >> 32) + 1) << 32) | (__next & 0xffffffffULL);
+      const unsigned long long __prev =
+          __compare_and_swap(&_M_free[__c], __head, __new);
+      if (__prev == __head) return __blk;
+      __head = __prev;
+    }
+    return 0;
+  }
+
+  AICUDA_HD void _M_push(int __c, char *__blk) {
+    _Header *__h = reinterpret_cast<_Header *>(__blk);
+    __h->_M_class = unsigned(__c);
+    const unsigned long long __index =
+        (unsigned long long)((__blk - _M_base) / _S_align) + 1;
+    unsigned long long __head = __load_acquire(&_M_free[__c]);
+    for (;;) {
+      __store_release(&__h->_M_next, __head & 0xffffffffULL);
+      const unsigned long long __new = (((__head >> 32) + 1) << 32) | __index;
+      const unsigned long long __prev =
+          __compare_and_swap(&_M_free[__c], __head, __new);
+      if (__prev == __head) return;
+      __head = __prev;
+    }
+  }
+
+  AICUDA_HD char *_M_carve(int __c) {
+    const unsigned long long __size = _S_block_size(__c);
+    unsigned long long __top = __load_acquire(&_M_top);
+    while (__size <= _M_size - __top) {
+      const unsigned long long __prev =
+          __compare_and_swap(&_M_top, __top, __top + __size);
+      if (__prev == __top) return _M_base + __top;
+      __top = __prev;
+    }
+    return 0;
+  }
+
+  char *_M_base;
+  unsigned long long _M_size;
+  unsigned long long _M_top;
+  unsigned long long _M_used;
+  unsigned long long _M_free[_S_classes];
+};
+
+// Allocator handing out memory from a region.  All rebinds and copies share
+// the region, which may be used by many threads at once.  Types aligned
+// beyond region::_S_align, and default-constructed allocators, use the
+// global heap.
+template <typename _Tp>
+class region_allocator {
+ public:
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Tp *pointer;
+  typedef const _Tp *const_pointer;
+  typedef _Tp &reference;
+  typedef const _Tp &const_reference;
+  typedef _Tp value_type;
+
+  template <typename _Tp1>
+  struct rebind {
+    typedef region_allocator<_Tp1> other;
+  };
+
+  AICUDA_HD region_allocator() : _M_region(0) {}
+
+  AICUDA_HD region_allocator(region &__r) : _M_region(&__r) {}
+
+  AICUDA_HD region_allocator(const region_allocator &__a)
+      : _M_region(__a._M_region) {}
+
+  template <typename _Tp1>
+  AICUDA_HD region_allocator(const region_allocator<_Tp1> &__a)
+      : _M_region(__a._M_get_region()) {}
+
+  AICUDA_HD ~region_allocator() {}
+
+  AICUDA_HD pointer address(reference __x) const { return &__x; }
+
+  AICUDA_HD const_pointer address(const_reference __x) const { return &__x; }
+
+  AICUDA_HD pointer allocate(size_type __n, const void * = 0) {
+    if (_M_region && alignof(_Tp) <= region::_S_align)
+      return static_cast<_Tp *>(_M_region->allocate(__n * sizeof(_Tp)));
+    return static_cast<_Tp *>(::operator new(__n * sizeof(_Tp)));
+  }
+
+  AICUDA_HD void deallocate(pointer __p, size_type) {
+    if (_M_region && alignof(_Tp) <= region::_S_align)
+      _M_region->deallocate(__p);
+    else
+      ::operator delete(__p);
+  }
+
+  AICUDA_HD void construct(pointer __p, const _Tp &__val) {
+    ::new ((void *)__p) _Tp(__val);
+  }
+
+  AICUDA_HD void destroy(pointer __p) { __p->~_Tp(); }
+
+  AICUDA_HD constexpr size_type max_size() const {
+    return size_t(-1) / sizeof(_Tp);
+  }
+
+  AICUDA_HD region *_M_get_region() const { return _M_region; }
+
+ private:
+  region *_M_region;
+};
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator==(const region_allocator<_T1> &__x,
+                                 const region_allocator<_T2> &__y) {
+  return __x._M_get_region() == __y._M_get_region();
+}
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator!=(const region_allocator<_T1> &__x,
+                                 const region_allocator<_T2> &__y) {
+  return __x._M_get_region() != __y._M_get_region();
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_REGION_ALLOCATOR_H_ */
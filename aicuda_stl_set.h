@@ -25,6 +25,7 @@
 #ifndef _AICUDA_STL_SET_H_
 #define _AICUDA_STL_SET_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <aicuda_stl_tree.h>
 #include <assert.h>
 
@@ -63,121 +64,165 @@ class set {
   typedef typename _Rep_type::size_type size_type;
   typedef typename _Rep_type::difference_type difference_type;
 
-  __device__ set() : _M_t() {}
+  AICUDA_HD set() : _M_t() {}
 
-  __device__ explicit set(const _Compare &__comp,
-                          const allocator_type &__a = allocator_type())
+  AICUDA_HD explicit set(const _Compare &__comp,
+                         const allocator_type &__a = allocator_type())
       : _M_t(__comp, __a) {}
 
   template <typename _InputIterator>
-  __device__ set(_InputIterator __first, _InputIterator __last) : _M_t() {
+  AICUDA_HD set(_InputIterator __first, _InputIterator __last) : _M_t() {
     _M_t._M_insert_unique(__first, __last);
   }
 
   template <typename _InputIterator>
-  __device__ set(_InputIterator __first, _InputIterator __last,
-                 const _Compare &__comp,
-                 const allocator_type &__a = allocator_type())
+  AICUDA_HD set(_InputIterator __first, _InputIterator __last,
+                const _Compare &__comp,
+                const allocator_type &__a = allocator_type())
       : _M_t(__comp, __a) {
     _M_t._M_insert_unique(__first, __last);
   }
 
-  __device__ set(const set &__x) : _M_t(__x._M_t) {}
+  AICUDA_HD set(const set &__x) : _M_t(__x._M_t) {}
 
-  __device__ set &operator=(const set &__x) {
+  AICUDA_HD set &operator=(const set &__x) {
     _M_t = __x._M_t;
     return *this;
   }
 
-  __device__ key_compare key_comp() const { return _M_t.key_comp(); }
+  AICUDA_HD key_compare key_comp() const { return _M_t.key_comp(); }
 
-  __device__ value_compare value_comp() const { return _M_t.key_comp(); }
+  AICUDA_HD value_compare value_comp() const { return _M_t.key_comp(); }
 
-  __device__ allocator_type get_allocator() const {
+  AICUDA_HD allocator_type get_allocator() const {
     return _M_t.get_allocator();
   }
 
-  __device__ iterator begin() const { return _M_t.begin(); }
+  AICUDA_HD iterator begin() const { return _M_t.begin(); }
 
-  __device__ iterator end() const { return _M_t.end(); }
+  AICUDA_HD iterator end() const { return _M_t.end(); }
 
-  __device__ reverse_iterator rbegin() const { return _M_t.rbegin(); }
+  AICUDA_HD reverse_iterator rbegin() const { return _M_t.rbegin(); }
 
-  __device__ reverse_iterator rend() const { return _M_t.rend(); }
+  AICUDA_HD reverse_iterator rend() const { return _M_t.rend(); }
 
-  __device__ bool empty() const { return _M_t.empty(); }
+  AICUDA_HD bool empty() const { return _M_t.empty(); }
 
-  __device__ size_type size() const { return _M_t.size(); }
+  AICUDA_HD size_type size() const { return _M_t.size(); }
 
-  __device__ size_type max_size() const { return _M_t.max_size(); }
+  AICUDA_HD size_type max_size() const { return _M_t.max_size(); }
 
-  __device__ void swap(set &__x) { _M_t.swap(__x._M_t); }
+  AICUDA_HD void swap(set &__x) { _M_t.swap(__x._M_t); }
 
-  __device__ aicuda::stl::pair<iterator, bool> insert(const value_type &__x) {
+  AICUDA_HD aicuda::stl::pair<iterator, bool> insert(const value_type &__x) {
     aicuda::stl::pair<typename _Rep_type::iterator, bool> __p =
         _M_t._M_insert_unique(__x);
     return aicuda::stl::pair<iterator, bool>(__p.first, __p.second);
   }
 
-  __device__ iterator insert(iterator __position, const value_type &__x) {
+  AICUDA_HD iterator insert(iterator __position, const value_type &__x) {
     return _M_t._M_insert_unique_(__position, __x);
   }
 
   template <typename _InputIterator>
-  __device__ void insert(_InputIterator __first, _InputIterator __last) {
+  AICUDA_HD void insert(_InputIterator __first, _InputIterator __last) {
     _M_t._M_insert_unique(__first, __last);
   }
 
-  __device__ void erase(iterator __position) { _M_t.erase(__position); }
+  AICUDA_HD void erase(iterator __position) { _M_t.erase(__position); }
 
-  __device__ size_type erase(const key_type &__x) { return _M_t.erase(__x); }
+  AICUDA_HD size_type erase(const key_type &__x) { return _M_t.erase(__x); }
 
-  __device__ void erase(iterator __first, iterator __last) {
+  AICUDA_HD void erase(iterator __first, iterator __last) {
     _M_t.erase(__first, __last);
   }
 
-  __device__ void clear() { _M_t.clear(); }
+  AICUDA_HD void clear() { _M_t.clear(); }
 
-  __device__ size_type count(const key_type &__x) const {
+  AICUDA_HD size_type count(const key_type &__x) const {
     return _M_t.find(__x) == _M_t.end() ? 0 : 1;
   }
 
-  __device__ iterator find(const key_type &__x) { return _M_t.find(__x); }
+  AICUDA_HD iterator find(const key_type &__x) { return _M_t.find(__x); }
 
-  __device__ const_iterator find(const key_type &__x) const {
+  AICUDA_HD const_iterator find(const key_type &__x) const {
     return _M_t.find(__x);
   }
 
-  __device__ iterator lower_bound(const key_type &__x) {
+  AICUDA_HD iterator lower_bound(const key_type &__x) {
     return _M_t.lower_bound(__x);
   }
 
-  __device__ const_iterator lower_bound(const key_type &__x) const {
+  AICUDA_HD const_iterator lower_bound(const key_type &__x) const {
     return _M_t.lower_bound(__x);
   }
 
-  __device__ iterator upper_bound(const key_type &__x) {
+  AICUDA_HD iterator upper_bound(const key_type &__x) {
     return _M_t.upper_bound(__x);
   }
 
-  __device__ const_iterator upper_bound(const key_type &__x) const {
+  AICUDA_HD const_iterator upper_bound(const key_type &__x) const {
     return _M_t.upper_bound(__x);
   }
 
-  __device__ aicuda::stl::pair<iterator, iterator> equal_range(
-      const key_type &__x) {
+  AICUDA_HD aicuda::stl::pair<iterator, iterator> equal_range(
+     const key_type &__x) {
     return _M_t.equal_range(__x);
   }
 
-  __device__ aicuda::stl::pair<const_iterator, const_iterator> equal_range(
-      const key_type &__x) const {
+  AICUDA_HD aicuda::stl::pair<const_iterator, const_iterator> equal_range(
+     const key_type &__x) const {
     return _M_t.equal_range(__x);
   }
+
+  // Lookup by any key type the comparator can order against key_type, e.g.
+  // a string_view into a map<string, _Tp, less<> >.  Only available when
+  // _Compare is transparent.
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  find(const _Kt &__x) { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  find(const _Kt &__x) const { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, size_type>::__type
+  count(const _Kt &__x) const {
+    return _M_t._M_find_tr(__x) == _M_t.end() ? 0 : 1;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  lower_bound(const _Kt &__x) { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  lower_bound(const _Kt &__x) const { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  upper_bound(const _Kt &__x) { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  upper_bound(const _Kt &__x) const { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt, aicuda::stl::pair<iterator, iterator>>::__type
+  equal_range(const _Kt &__x) { return _M_t._M_equal_range_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt,
+      aicuda::stl::pair<const_iterator, const_iterator>>::__type
+  equal_range(const _Kt &__x) const { return _M_t._M_equal_range_tr(__x); }
 };
 
 template <typename _Key, typename _Compare, typename _Alloc>
-__device__ inline void swap(set<_Key, _Compare, _Alloc> &__x,
-                            set<_Key, _Compare, _Alloc> &__y) {
+AICUDA_HD inline void swap(set<_Key, _Compare, _Alloc> &__x,
+                           set<_Key, _Compare, _Alloc> &__y) {
   __x.swap(__y);
 }
 
@@ -215,119 +260,160 @@ class multiset {
   typedef typename _Rep_type::size_type size_type;
   typedef typename _Rep_type::difference_type difference_type;
 
-  __device__ multiset() : _M_t() {}
+  AICUDA_HD multiset() : _M_t() {}
 
-  __device__ explicit multiset(const _Compare &__comp,
-                               const allocator_type &__a = allocator_type())
+  AICUDA_HD explicit multiset(const _Compare &__comp,
+                              const allocator_type &__a = allocator_type())
       : _M_t(__comp, __a) {}
 
   template <typename _InputIterator>
-  __device__ multiset(_InputIterator __first, _InputIterator __last) : _M_t() {
+  AICUDA_HD multiset(_InputIterator __first, _InputIterator __last) : _M_t() {
     _M_t._M_insert_equal(__first, __last);
   }
 
   template <typename _InputIterator>
-  __device__ multiset(_InputIterator __first, _InputIterator __last,
-                      const _Compare &__comp,
-                      const allocator_type &__a = allocator_type())
+  AICUDA_HD multiset(_InputIterator __first, _InputIterator __last,
+                     const _Compare &__comp,
+                     const allocator_type &__a = allocator_type())
       : _M_t(__comp, __a) {
     _M_t._M_insert_equal(__first, __last);
   }
 
-  __device__ multiset(const multiset &__x) : _M_t(__x._M_t) {}
+  AICUDA_HD multiset(const multiset &__x) : _M_t(__x._M_t) {}
 
-  __device__ multiset &operator=(const multiset &__x) {
+  AICUDA_HD multiset &operator=(const multiset &__x) {
     _M_t = __x._M_t;
     return *this;
   }
 
-  __device__ key_compare key_comp() const { return _M_t.key_comp(); }
+  AICUDA_HD key_compare key_comp() const { return _M_t.key_comp(); }
 
-  __device__ value_compare value_comp() const { return _M_t.key_comp(); }
+  AICUDA_HD value_compare value_comp() const { return _M_t.key_comp(); }
 
-  __device__ allocator_type get_allocator() const {
+  AICUDA_HD allocator_type get_allocator() const {
     return _M_t.get_allocator();
   }
 
-  __device__ iterator begin() const { return _M_t.begin(); }
+  AICUDA_HD iterator begin() const { return _M_t.begin(); }
 
-  __device__ iterator end() const { return _M_t.end(); }
+  AICUDA_HD iterator end() const { return _M_t.end(); }
 
-  __device__ reverse_iterator rbegin() const { return _M_t.rbegin(); }
+  AICUDA_HD reverse_iterator rbegin() const { return _M_t.rbegin(); }
 
-  __device__ reverse_iterator rend() const { return _M_t.rend(); }
+  AICUDA_HD reverse_iterator rend() const { return _M_t.rend(); }
 
-  __device__ bool empty() const { return _M_t.empty(); }
+  AICUDA_HD bool empty() const { return _M_t.empty(); }
 
-  __device__ size_type size() const { return _M_t.size(); }
+  AICUDA_HD size_type size() const { return _M_t.size(); }
 
-  __device__ size_type max_size() const { return _M_t.max_size(); }
+  AICUDA_HD size_type max_size() const { return _M_t.max_size(); }
 
-  __device__ void swap(multiset &__x) { _M_t.swap(__x._M_t); }
+  AICUDA_HD void swap(multiset &__x) { _M_t.swap(__x._M_t); }
 
-  __device__ iterator insert(const value_type &__x) {
+  AICUDA_HD iterator insert(const value_type &__x) {
     return _M_t._M_insert_equal(__x);
   }
 
-  __device__ iterator insert(iterator __position, const value_type &__x) {
+  AICUDA_HD iterator insert(iterator __position, const value_type &__x) {
     return _M_t._M_insert_equal_(__position, __x);
   }
 
   template <typename _InputIterator>
-  __device__ void insert(_InputIterator __first, _InputIterator __last) {
+  AICUDA_HD void insert(_InputIterator __first, _InputIterator __last) {
     _M_t._M_insert_equal(__first, __last);
   }
 
-  __device__ void erase(iterator __position) { _M_t.erase(__position); }
+  AICUDA_HD void erase(iterator __position) { _M_t.erase(__position); }
 
-  __device__ size_type erase(const key_type &__x) { return _M_t.erase(__x); }
+  AICUDA_HD size_type erase(const key_type &__x) { return _M_t.erase(__x); }
 
-  __device__ void erase(iterator __first, iterator __last) {
+  AICUDA_HD void erase(iterator __first, iterator __last) {
     _M_t.erase(__first, __last);
   }
 
-  __device__ void clear() { _M_t.clear(); }
+  AICUDA_HD void clear() { _M_t.clear(); }
 
-  __device__ size_type count(const key_type &__x) const {
+  AICUDA_HD size_type count(const key_type &__x) const {
     return _M_t.count(__x);
   }
 
-  __device__ iterator find(const key_type &__x) { return _M_t.find(__x); }
+  AICUDA_HD iterator find(const key_type &__x) { return _M_t.find(__x); }
 
-  __device__ const_iterator find(const key_type &__x) const {
+  AICUDA_HD const_iterator find(const key_type &__x) const {
     return _M_t.find(__x);
   }
 
-  __device__ iterator lower_bound(const key_type &__x) {
+  AICUDA_HD iterator lower_bound(const key_type &__x) {
     return _M_t.lower_bound(__x);
   }
 
-  __device__ const_iterator lower_bound(const key_type &__x) const {
+  AICUDA_HD const_iterator lower_bound(const key_type &__x) const {
     return _M_t.lower_bound(__x);
   }
 
-  __device__ iterator upper_bound(const key_type &__x) {
+  AICUDA_HD iterator upper_bound(const key_type &__x) {
     return _M_t.upper_bound(__x);
   }
 
-  __device__ const_iterator upper_bound(const key_type &__x) const {
+  AICUDA_HD const_iterator upper_bound(const key_type &__x) const {
     return _M_t.upper_bound(__x);
   }
 
-  __device__ aicuda::stl::pair<iterator, iterator> equal_range(
-      const key_type &__x) {
+  AICUDA_HD aicuda::stl::pair<iterator, iterator> equal_range(
+     const key_type &__x) {
     return _M_t.equal_range(__x);
   }
 
-  __device__ aicuda::stl::pair<const_iterator, const_iterator> equal_range(
-      const key_type &__x) const {
+  AICUDA_HD aicuda::stl::pair<const_iterator, const_iterator> equal_range(
+     const key_type &__x) const {
     return _M_t.equal_range(__x);
   }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  find(const _Kt &__x) { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  find(const _Kt &__x) const { return _M_t._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, size_type>::__type
+  count(const _Kt &__x) const {
+    return _M_t._M_count_tr(__x);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  lower_bound(const _Kt &__x) { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  lower_bound(const _Kt &__x) const { return _M_t._M_lower_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, iterator>::__type
+  upper_bound(const _Kt &__x) { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<_Compare, _Kt, const_iterator>::__type
+  upper_bound(const _Kt &__x) const { return _M_t._M_upper_bound_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt, aicuda::stl::pair<iterator, iterator>>::__type
+  equal_range(const _Kt &__x) { return _M_t._M_equal_range_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_transparent<
+      _Compare, _Kt,
+      aicuda::stl::pair<const_iterator, const_iterator>>::__type
+  equal_range(const _Kt &__x) const { return _M_t._M_equal_range_tr(__x); }
 };
 
 template <typename _Key, typename _Compare, typename _Alloc>
-__device__ inline void swap(multiset<_Key, _Compare, _Alloc> &__x,
-                            multiset<_Key, _Compare, _Alloc> &__y) {
+AICUDA_HD inline void swap(multiset<_Key, _Compare, _Alloc> &__x,
+                           multiset<_Key, _Compare, _Alloc> &__y) {
   __x.swap(__y);
 }
 
@@ -0,0 +1,195 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_SHARED_ALLOCATOR_H_
+#define _AICUDA_STL_SHARED_ALLOCATOR_H_ 1
+
+#include <aicuda_stl_atomic.h>
+#include <aicuda_stl_config.h>
+#include <stddef.h>
+
+namespace aicuda {
+namespace stl {
+
+// Bump allocator over a block's __shared__ byte array.  Requests that do not
+// fit spill to the global heap, so a container outgrowing shared memory keeps
+// working at global-memory speed.  The bump is atomic, so every thread of the
+// block may allocate; deallocation only returns spilled blocks, shared memory
+// is reclaimed when the block exits.  The default constructor is trivial so
+// the arena itself can be declared __shared__:
+//
+//   __shared__ unsigned char __buf[4096];
+//   __shared__ aicuda::stl::shared_arena __sa;
+//   if (threadIdx.x == 0) __sa.init(__buf, sizeof(__buf));
+//   __syncthreads();
+//
+// On the host the buffer is ordinary memory.
+class shared_arena {
+ public:
+  enum { _S_min_align = sizeof(void *) };
+
+  shared_arena() = default;
+
+  AICUDA_HD shared_arena(void *__buf, size_t __size) { init(__buf, __size); }
+
+  AICUDA_HD void init(void *__buf, size_t __size) {
+    _M_begin = static_cast<char *>(__buf);
+    _M_size = __size;
+    _M_top = 0;
+    _M_spilled = 0;
+  }
+
+  AICUDA_HD void *allocate(size_t __bytes, size_t __align) {
+    if (__align < _S_min_align) __align = _S_min_align;
+    unsigned long long __top = __load_acquire_block(&_M_top);
+    for (;;) {
+      const unsigned long long __pad =
+          (0 - reinterpret_cast<size_t>(_M_begin + __top)) & (__align - 1);
+      if (__bytes > _M_size - __top || __pad > _M_size - __top - __bytes)
+        break;
+      const unsigned long long __prev =
+          __compare_and_swap_block(&_M_top, __top, __top + __pad + __bytes);
+      if (__prev == __top) return _M_begin + __top + __pad;
+      __top = __prev;
+    }
+    __fetch_add(&_M_spilled, __bytes);
+    return ::operator new(__bytes);
+  }
+
+  AICUDA_HD void deallocate(void *__p, size_t __bytes) {
+    if (!owns(__p)) {
+      if (__p) __fetch_add(&_M_spilled, 0 - (unsigned long long)__bytes);
+      ::operator delete(__p);
+    }
+  }
+
+  AICUDA_HD bool owns(const void *__p) const {
+    return static_cast<const char *>(__p) >= _M_begin &&
+           static_cast<const char *>(__p) < _M_begin + _M_size;
+  }
+
+  // Bytes of the shared buffer handed out so far.
+  AICUDA_HD size_t used() const {
+    return size_t(__load_acquire_block(&_M_top));
+  }
+
+  // Bytes currently held in global memory because the buffer was full.
+  AICUDA_HD size_t spilled() const {
+    return size_t(__load_acquire_block(&_M_spilled));
+  }
+
+  AICUDA_HD size_t capacity() const { return size_t(_M_size); }
+
+ private:
+  AICUDA_HD shared_arena(const shared_arena &);
+  AICUDA_HD shared_arena &operator=(const shared_arena &);
+
+  char *_M_begin;
+  unsigned long long _M_size;
+  unsigned long long _M_top;
+  unsigned long long _M_spilled;
+};
+
+// Allocator placing container storage in a shared_arena.  All rebinds of one
+// shared_allocator share the arena.  A default-constructed shared_allocator
+// uses the global heap.
+template <typename _Tp>
+class shared_allocator {
+ public:
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Tp *pointer;
+  typedef const _Tp *const_pointer;
+  typedef _Tp &reference;
+  typedef const _Tp &const_reference;
+  typedef _Tp value_type;
+
+  template <typename _Tp1>
+  struct rebind {
+    typedef shared_allocator<_Tp1> other;
+  };
+
+  AICUDA_HD shared_allocator() : _M_arena(0) {}
+
+  AICUDA_HD shared_allocator(shared_arena &__a) : _M_arena(&__a) {}
+
+  AICUDA_HD shared_allocator(const shared_allocator &__a)
+      : _M_arena(__a._M_arena) {}
+
+  template <typename _Tp1>
+  AICUDA_HD shared_allocator(const shared_allocator<_Tp1> &__a)
+      : _M_arena(__a._M_get_arena()) {}
+
+  AICUDA_HD ~shared_allocator() {}
+
+  AICUDA_HD pointer address(reference __x) const { return &__x; }
+
+  AICUDA_HD const_pointer address(const_reference __x) const { return &__x; }
+
+  AICUDA_HD pointer allocate(size_type __n, const void * = 0) {
+    if (_M_arena)
+      return static_cast<_Tp *>(
+          _M_arena->allocate(__n * sizeof(_Tp), alignof(_Tp)));
+    return static_cast<_Tp *>(::operator new(__n * sizeof(_Tp)));
+  }
+
+  AICUDA_HD void deallocate(pointer __p, size_type __n) {
+    if (_M_arena)
+      _M_arena->deallocate(__p, __n * sizeof(_Tp));
+    else
+      ::operator delete(__p);
+  }
+
+  AICUDA_HD void construct(pointer __p, const _Tp &__val) {
+    ::new ((void *)__p) _Tp(__val);
+  }
+
+  AICUDA_HD void destroy(pointer __p) { __p->~_Tp(); }
+
+  AICUDA_HD constexpr size_type max_size() const {
+    return size_t(-1) / sizeof(_Tp);
+  }
+
+  AICUDA_HD shared_arena *_M_get_arena() const { return _M_arena; }
+
+ private:
+  shared_arena *_M_arena;
+};
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator==(const shared_allocator<_T1> &__x,
+                                 const shared_allocator<_T2> &__y) {
+  return __x._M_get_arena() == __y._M_get_arena();
+}
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator!=(const shared_allocator<_T1> &__x,
+                                 const shared_allocator<_T2> &__y) {
+  return __x._M_get_arena() != __y._M_get_arena();
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_SHARED_ALLOCATOR_H_ */
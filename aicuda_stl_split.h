@@ -0,0 +1,289 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_SPLIT_H_
+#define _AICUDA_STL_SPLIT_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_char_traits.h>
+#include <aicuda_stl_iterator.h>
+#include <aicuda_stl_string.h>
+#include <aicuda_stl_string_view.h>
+
+namespace aicuda
+{
+namespace stl
+{
+
+// The fields of a character sequence, as basic_string_views into it, split
+// on a single character, on a delimiter string, or on any character of a
+// set.  Iterating neither allocates nor writes to the text, unlike
+// string_op::strtok_r:
+//
+//   for (string_view __f : split(__line, ','))
+//     ...
+//
+// Adjacent delimiters, and delimiters at either end, produce empty fields
+// unless __skip_empty is set; empty text is one empty field.  An empty
+// delimiter never matches.  The text, and a delimiter string or set passed
+// by pointer, must outlive the range and its iterators, and the range must
+// outlive its iterators (a range-for keeps it alive for the loop).
+template <typename _CharT, typename _Traits = aicuda::stl::char_traits<_CharT>>
+class basic_split_view
+{
+public:
+  typedef basic_string_view<_CharT, _Traits> value_type;
+  typedef size_t size_type;
+
+  enum _Mode
+  {
+    _S_char,
+    _S_string,
+    _S_any
+  };
+
+  class iterator
+  {
+  public:
+    typedef forward_iterator_tag iterator_category;
+    typedef basic_string_view<_CharT, _Traits> value_type;
+    typedef ptrdiff_t difference_type;
+    typedef const value_type *pointer;
+    typedef const value_type &reference;
+
+    AICUDA_HD iterator() : _M_owner(0), _M_rest(0), _M_last(true), _M_done(true) {}
+
+    AICUDA_HD reference operator*() const { return _M_field; }
+    AICUDA_HD pointer operator->() const { return &_M_field; }
+
+    AICUDA_HD iterator &operator++()
+    {
+      _M_next();
+      return *this;
+    }
+
+    AICUDA_HD iterator operator++(int)
+    {
+      iterator __tmp = *this;
+      _M_next();
+      return __tmp;
+    }
+
+    AICUDA_HD bool operator==(const iterator &__x) const
+    {
+      return _M_done == __x._M_done &&
+             (_M_done || _M_field.data() == __x._M_field.data());
+    }
+
+    AICUDA_HD bool operator!=(const iterator &__x) const
+    {
+      return !(*this == __x);
+    }
+
+  private:
+    friend class basic_split_view;
+
+    AICUDA_HD explicit iterator(const basic_split_view *__owner)
+        : _M_owner(__owner), _M_rest(__owner->_M_text.data()), _M_last(false),
+          _M_done(false)
+    {
+      _M_next();
+    }
+
+    // Moves to the next field, skipping empty ones if asked; past the last
+    // field the iterator compares equal to end().
+    AICUDA_HD void _M_next()
+    {
+      do
+      {
+        if (_M_last)
+        {
+          _M_done = true;
+          return;
+        }
+        const _CharT *const __end =
+            _M_owner->_M_text.data() + _M_owner->_M_text.size();
+        const size_type __len = size_type(__end - _M_rest);
+        size_type __dlen = 0;
+        const size_type __i = _M_owner->_M_find(_M_rest, __len, __dlen);
+        if (__i == size_type(-1))
+        {
+          _M_field = value_type(_M_rest, __len);
+          _M_last = true;
+        }
+        else
+        {
+          _M_field = value_type(_M_rest, __i);
+          _M_rest += __i + __dlen;
+        }
+      } while (_M_owner->_M_skip_empty && _M_field.empty());
+    }
+
+    const basic_split_view *_M_owner;
+    value_type _M_field;
+    const _CharT *_M_rest;
+    bool _M_last;
+    bool _M_done;
+  };
+
+  typedef iterator const_iterator;
+
+  AICUDA_HD basic_split_view(value_type __text, _CharT __delim,
+                             bool __skip_empty = false)
+      : _M_text(__text), _M_delim(), _M_ch(__delim), _M_mode(_S_char),
+        _M_skip_empty(__skip_empty) {}
+
+  AICUDA_HD basic_split_view(value_type __text, value_type __delim,
+                             _Mode __mode, bool __skip_empty = false)
+      : _M_text(__text), _M_delim(__delim), _M_ch(), _M_mode(__mode),
+        _M_skip_empty(__skip_empty) {}
+
+  AICUDA_HD iterator begin() const { return iterator(this); }
+  AICUDA_HD iterator end() const { return iterator(); }
+
+  AICUDA_HD value_type text() const { return _M_text; }
+
+private:
+  // Offset of the first delimiter among the __len characters at __p, or
+  // size_type(-1); its length is stored in __dlen.
+  AICUDA_HD size_type _M_find(const _CharT *__p, size_type __len,
+                              size_type &__dlen) const
+  {
+    if (_M_mode == _S_char)
+    {
+      __dlen = 1;
+      const _CharT *__r = _Traits::find(__p, __len, _M_ch);
+      return __r ? size_type(__r - __p) : size_type(-1);
+    }
+    if (_M_mode == _S_any)
+    {
+      __dlen = 1;
+      return __str_span<_Traits>::_S_first(__p, __len, _M_delim.data(),
+                                           _M_delim.size(), true);
+    }
+    __dlen = _M_delim.size();
+    if (__dlen == 0)
+      return size_type(-1);
+    const _CharT *__r = __str_search<_Traits>::_S_find(
+        __p, __len, _M_delim.data(), _M_delim.size());
+    return __r ? size_type(__r - __p) : size_type(-1);
+  }
+
+  value_type _M_text;
+  value_type _M_delim;
+  _CharT _M_ch;
+  _Mode _M_mode;
+  bool _M_skip_empty;
+};
+
+typedef basic_split_view<char> split_view;
+
+// split: fields separated by the character or the whole string __delim.
+// split_any: fields separated by any one character of __set.
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline basic_split_view<_CharT, _Traits>
+split(basic_string_view<_CharT, _Traits> __text, _CharT __delim,
+      bool __skip_empty = false)
+{
+  return basic_split_view<_CharT, _Traits>(__text, __delim, __skip_empty);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline basic_split_view<_CharT, _Traits>
+split(basic_string_view<_CharT, _Traits> __text, const _CharT *__delim,
+      bool __skip_empty = false)
+{
+  return basic_split_view<_CharT, _Traits>(
+      __text, basic_string_view<_CharT, _Traits>(__delim),
+      basic_split_view<_CharT, _Traits>::_S_string, __skip_empty);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline basic_split_view<_CharT, _Traits>
+split_any(basic_string_view<_CharT, _Traits> __text, const _CharT *__set,
+          bool __skip_empty = false)
+{
+  return basic_split_view<_CharT, _Traits>(
+      __text, basic_string_view<_CharT, _Traits>(__set),
+      basic_split_view<_CharT, _Traits>::_S_any, __skip_empty);
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline basic_split_view<_CharT, _Traits>
+split(const basic_string<_CharT, _Traits, _Alloc> &__text, _CharT __delim,
+      bool __skip_empty = false)
+{
+  return split(basic_string_view<_CharT, _Traits>(__text.data(), __text.size()),
+               __delim, __skip_empty);
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline basic_split_view<_CharT, _Traits>
+split(const basic_string<_CharT, _Traits, _Alloc> &__text,
+      const _CharT *__delim, bool __skip_empty = false)
+{
+  return split(basic_string_view<_CharT, _Traits>(__text.data(), __text.size()),
+               __delim, __skip_empty);
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline basic_split_view<_CharT, _Traits>
+split_any(const basic_string<_CharT, _Traits, _Alloc> &__text,
+          const _CharT *__set, bool __skip_empty = false)
+{
+  return split_any(
+      basic_string_view<_CharT, _Traits>(__text.data(), __text.size()), __set,
+      __skip_empty);
+}
+
+template <typename _CharT>
+AICUDA_HD inline basic_split_view<_CharT>
+split(const _CharT *__text, size_t __n, _CharT __delim,
+      bool __skip_empty = false)
+{
+  return split(basic_string_view<_CharT>(__text, __n), __delim, __skip_empty);
+}
+
+template <typename _CharT>
+AICUDA_HD inline basic_split_view<_CharT>
+split(const _CharT *__text, size_t __n, const _CharT *__delim,
+      bool __skip_empty = false)
+{
+  return split(basic_string_view<_CharT>(__text, __n), __delim, __skip_empty);
+}
+
+template <typename _CharT>
+AICUDA_HD inline basic_split_view<_CharT>
+split_any(const _CharT *__text, size_t __n, const _CharT *__set,
+          bool __skip_empty = false)
+{
+  return split_any(basic_string_view<_CharT>(__text, __n), __set,
+                   __skip_empty);
+}
+
+} // namespace stl
+} // namespace aicuda
+
+#endif /* _AICUDA_STL_SPLIT_H_ */
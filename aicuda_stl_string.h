@@ -25,12 +25,16 @@
 #ifndef _AICUDA_STL_STRING_H_
 #define _AICUDA_STL_STRING_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <aicuda_stl_allocator.h>
+#include <aicuda_stl_atomic.h>
+#include <aicuda_stl_char_traits.h>
+#include <aicuda_stl_charconv.h>
 #include <aicuda_stl_function.h>
 #include <aicuda_stl_iterator.h>
 #include <aicuda_stl_memory.h>
+#include <aicuda_stl_string_view.h>
 #include <aicuda_stl_type_traits.h>
-#include <wchar.h> // for mbstate_t
 #include <stdio.h>
 
 namespace aicuda
@@ -38,287 +42,6 @@ namespace aicuda
 namespace stl
 {
 
-typedef long streamoff;
-typedef ptrdiff_t streamsize;
-template <typename _StateT>
-class fpos
-{
-private:
-  streamoff _M_off;
-  _StateT _M_state;
-
-public:
-  __device__ fpos() : _M_off(0), _M_state() {}
-  __device__ fpos(streamoff __off) : _M_off(__off), _M_state() {}
-
-  __device__ operator streamoff() const { return _M_off; }
-
-  __device__ void state(_StateT __st) { _M_state = __st; }
-
-  __device__ _StateT state() const { return _M_state; }
-
-  __device__ fpos &operator+=(streamoff __off)
-  {
-    _M_off += __off;
-    return *this;
-  }
-
-  __device__ fpos &operator-=(streamoff __off)
-  {
-    _M_off -= __off;
-    return *this;
-  }
-
-  __device__ fpos operator+(streamoff __off) const
-  {
-    fpos __pos(*this);
-    __pos += __off;
-    return __pos;
-  }
-
-  __device__ fpos operator-(streamoff __off) const
-  {
-    fpos __pos(*this);
-    __pos -= __off;
-    return __pos;
-  }
-
-  __device__ streamoff operator-(const fpos &__other) const
-  {
-    return _M_off - __other._M_off;
-  }
-};
-
-template <typename _StateT>
-__device__ inline bool operator==(const fpos<_StateT> &__lhs,
-                                  const fpos<_StateT> &__rhs)
-{
-  return streamoff(__lhs) == streamoff(__rhs);
-}
-
-template <typename _StateT>
-__device__ inline bool operator!=(const fpos<_StateT> &__lhs,
-                                  const fpos<_StateT> &__rhs)
-{
-  return streamoff(__lhs) != streamoff(__rhs);
-}
-
-typedef fpos<mbstate_t> streampos;
-typedef fpos<mbstate_t> wstreampos;
-
-template <typename _CharT>
-struct _Char_types
-{
-  typedef unsigned long int_type;
-  typedef streampos pos_type;
-  typedef streamoff off_type;
-  typedef mbstate_t state_type;
-};
-
-template <typename _CharT>
-struct char_traits
-{
-  typedef _CharT char_type;
-  typedef typename _Char_types<_CharT>::int_type int_type;
-  typedef typename _Char_types<_CharT>::pos_type pos_type;
-  typedef typename _Char_types<_CharT>::off_type off_type;
-  typedef typename _Char_types<_CharT>::state_type state_type;
-
-  __device__ static void assign(char_type &__c1, const char_type &__c2)
-  {
-    __c1 = __c2;
-  }
-
-  __device__ static bool eq(const char_type &__c1, const char_type &__c2)
-  {
-    return __c1 == __c2;
-  }
-
-  __device__ static bool lt(const char_type &__c1, const char_type &__c2)
-  {
-    return __c1 < __c2;
-  }
-
-  __device__ static int compare(const char_type *__s1, const char_type *__s2,
-                                size_t __n);
-
-  __device__ static size_t length(const char_type *__s);
-
-  __device__ static const char_type *find(const char_type *__s, size_t __n,
-                                          const char_type &__a);
-
-  __device__ static char_type *move(char_type *__s1, const char_type *__s2,
-                                    size_t __n);
-
-  __device__ static char_type *copy(char_type *__s1, const char_type *__s2,
-                                    size_t __n);
-
-  __device__ static char_type *assign(char_type *__s, size_t __n,
-                                      char_type __a);
-
-  __device__ static char_type to_char_type(const int_type &__c)
-  {
-    return static_cast<char_type>(__c);
-  }
-
-  __device__ static int_type to_int_type(const char_type &__c)
-  {
-    return static_cast<int_type>(__c);
-  }
-
-  __device__ static bool eq_int_type(const int_type &__c1,
-                                     const int_type &__c2)
-  {
-    return __c1 == __c2;
-  }
-
-  __device__ static int_type eof() { return static_cast<int_type>((-1)); }
-
-  __device__ static int_type not_eof(const int_type &__c)
-  {
-    return !eq_int_type(__c, eof()) ? __c : to_int_type(char_type());
-  }
-};
-
-template <typename _CharT>
-__device__ int char_traits<_CharT>::compare(const char_type *__s1,
-                                            const char_type *__s2, size_t __n)
-{
-  for (size_t __i = 0; __i < __n; ++__i)
-    if (lt(__s1[__i], __s2[__i]))
-      return -1;
-    else if (lt(__s2[__i], __s1[__i]))
-      return 1;
-  return 0;
-}
-
-template <typename _CharT>
-__device__ size_t char_traits<_CharT>::length(const char_type *__p)
-{
-  size_t __i = 0;
-  while (!eq(__p[__i], char_type()))
-    ++__i;
-  return __i;
-}
-
-template <typename _CharT>
-__device__ const typename char_traits<_CharT>::char_type *
-char_traits<_CharT>::find(const char_type *__s, size_t __n,
-                          const char_type &__a)
-{
-  for (size_t __i = 0; __i < __n; ++__i)
-    if (eq(__s[__i], __a))
-      return __s + __i;
-  return 0;
-}
-
-template <typename _CharT>
-__device__ typename char_traits<_CharT>::char_type *char_traits<_CharT>::move(
-    char_type *__s1, const char_type *__s2, size_t __n)
-{
-  return static_cast<_CharT *>(
-      string_op::memmove(__s1, __s2, __n * sizeof(char_type)));
-}
-
-template <typename _CharT>
-__device__ typename char_traits<_CharT>::char_type *char_traits<_CharT>::copy(
-    char_type *__s1, const char_type *__s2, size_t __n)
-{
-  aicuda::stl::copy(__s2, __s2 + __n, __s1);
-  return __s1;
-}
-
-template <typename _CharT>
-__device__ typename char_traits<_CharT>::char_type *char_traits<_CharT>::assign(
-    char_type *__s, size_t __n, char_type __a)
-{
-  aicuda::stl::fill_n(__s, __n, __a);
-  return __s;
-}
-
-template <>
-struct char_traits<char>
-{
-  typedef char char_type;
-  typedef int int_type;
-  typedef streampos pos_type;
-  typedef streamoff off_type;
-  typedef mbstate_t state_type;
-
-  __device__ static void assign(char_type &__c1, const char_type &__c2)
-  {
-    __c1 = __c2;
-  }
-
-  __device__ static bool eq(const char_type &__c1, const char_type &__c2)
-  {
-    return __c1 == __c2;
-  }
-
-  __device__ static bool lt(const char_type &__c1, const char_type &__c2)
-  {
-    return __c1 < __c2;
-  }
-
-  __device__ static int compare(const char_type *__s1, const char_type *__s2,
-                                size_t __n)
-  {
-    return string_op::memcmp(__s1, __s2, __n);
-  }
-
-  __device__ static size_t length(const char_type *__s)
-  {
-    return string_op::strlen(__s);
-  }
-
-  __device__ static const char_type *find(const char_type *__s, size_t __n,
-                                          const char_type &__a)
-  {
-    return static_cast<const char_type *>(string_op::memchr(__s, __a, __n));
-  }
-
-  __device__ static char_type *move(char_type *__s1, const char_type *__s2,
-                                    size_t __n)
-  {
-    return static_cast<char_type *>(string_op::memmove(__s1, __s2, __n));
-  }
-
-  __device__ static char_type *copy(char_type *__s1, const char_type *__s2,
-                                    size_t __n)
-  {
-    return static_cast<char_type *>(string_op::memcpy(__s1, __s2, __n));
-  }
-
-  __device__ static char_type *assign(char_type *__s, size_t __n,
-                                      char_type __a)
-  {
-    return static_cast<char_type *>(string_op::memset(__s, __a, __n));
-  }
-
-  __device__ static char_type to_char_type(const int_type &__c)
-  {
-    return static_cast<char_type>(__c);
-  }
-
-  __device__ static int_type to_int_type(const char_type &__c)
-  {
-    return static_cast<int_type>(static_cast<unsigned char>(__c));
-  }
-
-  __device__ static bool eq_int_type(const int_type &__c1,
-                                     const int_type &__c2)
-  {
-    return __c1 == __c2;
-  }
-
-  __device__ static int_type eof() { return static_cast<int_type>((-1)); }
-
-  __device__ static int_type not_eof(const int_type &__c)
-  {
-    return (__c == eof()) ? 0 : __c;
-  }
-};
-
 template <typename _CharT, typename _Traits = aicuda::stl::char_traits<_CharT>,
           typename _Alloc = aicuda::stl::allocator<_CharT>>
 class basic_string;
@@ -347,6 +70,8 @@ public:
   typedef aicuda::stl::reverse_iterator<iterator> reverse_iterator;
 
 private:
+  typedef basic_string_view<_CharT, _Traits> __sv_type;
+
   struct _Rep_base
   {
     size_type _M_length;
@@ -358,63 +83,63 @@ private:
   {
     typedef typename _Alloc::template rebind<char>::other _Raw_bytes_alloc;
 
-    __device__ bool _M_is_leaked() const { return this->_M_refcount < 0; }
+    AICUDA_HD bool _M_is_leaked() const
+    {
+      return aicuda::stl::__load_relaxed(&this->_M_refcount) < 0;
+    }
 
-    __device__ bool _M_is_shared() const { return this->_M_refcount > 0; }
+    AICUDA_HD bool _M_is_shared() const
+    {
+      return aicuda::stl::__load_relaxed(&this->_M_refcount) > 0;
+    }
 
-    __device__ void _M_set_leaked() { this->_M_refcount = -1; }
+    AICUDA_HD void _M_set_leaked() { this->_M_refcount = -1; }
 
-    __device__ void _M_set_sharable() { this->_M_refcount = 0; }
+    AICUDA_HD void _M_set_sharable() { this->_M_refcount = 0; }
 
-    __device__ void _M_set_length_and_sharable(size_type __n)
+    AICUDA_HD void _M_set_length_and_sharable(size_type __n)
     {
       this->_M_set_sharable();
       this->_M_length = __n;
       traits_type::assign(this->_M_refdata()[__n], _CharT());
     }
 
-    __device__ _CharT *_M_refdata()
+    AICUDA_HD _CharT *_M_refdata()
     {
       return reinterpret_cast<_CharT *>(this + 1);
     }
 
-    __device__ _CharT *_M_grab(const _Alloc &__alloc1, const _Alloc &__alloc2)
+    AICUDA_HD _CharT *_M_grab(const _Alloc &__alloc1, const _Alloc &__alloc2)
     {
       return (!_M_is_leaked() && __alloc1 == __alloc2) ? _M_refcopy()
                                                        : _M_clone(__alloc1);
     }
 
-    __device__ static _Rep *_S_create(size_type, size_type, const _Alloc &);
+    AICUDA_HD static _Rep *_S_create(size_type, size_type, const _Alloc &,
+                                     void *__local = 0);
 
-    __device__ void _M_dispose(const _Alloc &__a)
+    // The reference count is updated atomically, so copies of one string
+    // may be made and destroyed concurrently from any threads.
+    AICUDA_HD void _M_dispose(const _Alloc &__a)
     {
-      if (__inner_exchange_and_add_dispatch(&this->_M_refcount, -1) <= 0)
+      if (aicuda::stl::__exchange_and_add(&this->_M_refcount, -1) <= 0)
         _M_destroy(__a);
     }
 
-    __device__ void _M_destroy(const _Alloc &);
+    AICUDA_HD void _M_destroy(const _Alloc &);
 
-    __device__ _CharT *_M_refcopy()
+    AICUDA_HD _CharT *_M_refcopy()
     {
-      this->_M_refcount += 1;
+      aicuda::stl::__atomic_add(&this->_M_refcount, 1);
       return _M_refdata();
     }
 
-    __device__ _CharT *_M_clone(const _Alloc &, size_type __res = 0);
-
-  private:
-    __device__ inline int __inner_exchange_and_add_dispatch(int *__mem,
-                                                            int __val)
-    {
-      int __result = *__mem;
-      *__mem += __val;
-      return __result;
-    }
+    AICUDA_HD _CharT *_M_clone(const _Alloc &, size_type __res = 0);
   };
 
   struct _Alloc_hider : _Alloc
   {
-    __device__ _Alloc_hider(_CharT *__dat, const _Alloc &__a)
+    AICUDA_HD _Alloc_hider(_CharT *__dat, const _Alloc &__a)
         : _Alloc(__a), _M_p(__dat) {}
 
     _CharT *_M_p;
@@ -427,31 +152,63 @@ public:
   };
 
 private:
+  // Short strings live in a _Rep embedded in the string object itself, so
+  // they never touch the allocator.  The local rep is never shared: copies of
+  // a short string get their own local copy, longer strings keep the
+  // reference-counted heap _Rep.
+  enum
+  {
+    _S_local_capacity = 16 / sizeof(_CharT) - 1
+  };
+
+  union _Local_buf
+  {
+    _Rep_base _M_header;
+    char _M_bytes[sizeof(_Rep_base) + (_S_local_capacity + 1) * sizeof(_CharT)];
+  };
+
   mutable _Alloc_hider _M_dataplus;
+  mutable _Local_buf _M_local;
 
-  __device__ _CharT *_M_data() const { return _M_dataplus._M_p; }
+  AICUDA_HD _CharT *_M_data() const { return _M_dataplus._M_p; }
 
-  __device__ _CharT *_M_data(_CharT *__p) { return (_M_dataplus._M_p = __p); }
+  AICUDA_HD _CharT *_M_data(_CharT *__p) { return (_M_dataplus._M_p = __p); }
 
-  __device__ _Rep *_M_rep() const
+  AICUDA_HD _Rep *_M_rep() const
   {
     return &((reinterpret_cast<_Rep *>(_M_data()))[-1]);
   }
 
-  __device__ iterator _M_ibegin() const { return iterator(_M_data()); }
+  AICUDA_HD void *_M_local_storage() const { return &_M_local; }
 
-  __device__ iterator _M_iend() const
+  AICUDA_HD bool _M_is_local() const
+  {
+    return static_cast<void *>(_M_rep()) == _M_local_storage();
+  }
+
+  AICUDA_HD void _M_dispose_rep(const _Alloc &__a)
+  {
+    if (!_M_is_local())
+      _M_rep()->_M_dispose(__a);
+  }
+
+  AICUDA_HD static _CharT *_S_grab(const basic_string &__str, const _Alloc &__a,
+                                   void *__local);
+
+  AICUDA_HD iterator _M_ibegin() const { return iterator(_M_data()); }
+
+  AICUDA_HD iterator _M_iend() const
   {
     return iterator(_M_data() + this->size());
   }
 
-  __device__ void _M_leak()
+  AICUDA_HD void _M_leak()
   {
     if (!_M_rep()->_M_is_leaked())
       _M_leak_hard();
   }
 
-  __device__ size_type _M_check(size_type __pos, const char *__s) const
+  AICUDA_HD size_type _M_check(size_type __pos, const char *__s) const
   {
     if (__pos > this->size())
     {
@@ -461,8 +218,8 @@ private:
     return __pos;
   }
 
-  __device__ void _M_check_length(size_type __n1, size_type __n2,
-                                  const char *__s) const
+  AICUDA_HD void _M_check_length(size_type __n1, size_type __n2,
+                                 const char *__s) const
   {
     if (this->max_size() - (this->size() - __n1) < __n2)
     {
@@ -471,20 +228,20 @@ private:
     }
   }
 
-  __device__ size_type _M_limit(size_type __pos, size_type __off) const
+  AICUDA_HD size_type _M_limit(size_type __pos, size_type __off) const
   {
     const bool __testoff = __off < this->size() - __pos;
     return __testoff ? __off : this->size() - __pos;
   }
 
-  __device__ bool _M_disjunct(const _CharT *__s) const
+  AICUDA_HD bool _M_disjunct(const _CharT *__s) const
   {
     return (less<const _CharT *>()(__s, _M_data()) ||
             less<const _CharT *>()(_M_data() + this->size(), __s));
   }
 
-  __device__ static void _M_copy(_CharT *__d, const _CharT *__s,
-                                 size_type __n)
+  AICUDA_HD static void _M_copy(_CharT *__d, const _CharT *__s,
+                                size_type __n)
   {
     if (__n == 1)
       traits_type::assign(*__d, *__s);
@@ -492,8 +249,8 @@ private:
       traits_type::copy(__d, __s, __n);
   }
 
-  __device__ static void _M_move(_CharT *__d, const _CharT *__s,
-                                 size_type __n)
+  AICUDA_HD static void _M_move(_CharT *__d, const _CharT *__s,
+                                size_type __n)
   {
     if (__n == 1)
       traits_type::assign(*__d, *__s);
@@ -501,7 +258,7 @@ private:
       traits_type::move(__d, __s, __n);
   }
 
-  __device__ static void _M_assign(_CharT *__d, size_type __n, _CharT __c)
+  AICUDA_HD static void _M_assign(_CharT *__d, size_type __n, _CharT __c)
   {
     if (__n == 1)
       traits_type::assign(*__d, __c);
@@ -510,38 +267,38 @@ private:
   }
 
   template <class _Iterator>
-  __device__ static void _S_copy_chars(_CharT *__p, _Iterator __k1,
-                                       _Iterator __k2)
+  AICUDA_HD static void _S_copy_chars(_CharT *__p, _Iterator __k1,
+                                      _Iterator __k2)
   {
     for (; __k1 != __k2; ++__k1, ++__p)
       traits_type::assign(*__p, *__k1);
   }
 
-  __device__ static void _S_copy_chars(_CharT *__p, iterator __k1,
-                                       iterator __k2)
+  AICUDA_HD static void _S_copy_chars(_CharT *__p, iterator __k1,
+                                      iterator __k2)
   {
     _S_copy_chars(__p, __k1.base(), __k2.base());
   }
 
-  __device__ static void _S_copy_chars(_CharT *__p, const_iterator __k1,
-                                       const_iterator __k2)
+  AICUDA_HD static void _S_copy_chars(_CharT *__p, const_iterator __k1,
+                                      const_iterator __k2)
   {
     _S_copy_chars(__p, __k1.base(), __k2.base());
   }
 
-  __device__ static void _S_copy_chars(_CharT *__p, _CharT *__k1,
-                                       _CharT *__k2)
+  AICUDA_HD static void _S_copy_chars(_CharT *__p, _CharT *__k1,
+                                      _CharT *__k2)
   {
     _M_copy(__p, __k1, __k2 - __k1);
   }
 
-  __device__ static void _S_copy_chars(_CharT *__p, const _CharT *__k1,
-                                       const _CharT *__k2)
+  AICUDA_HD static void _S_copy_chars(_CharT *__p, const _CharT *__k1,
+                                      const _CharT *__k2)
   {
     _M_copy(__p, __k1, __k2 - __k1);
   }
 
-  __device__ static int _S_compare(size_type __n1, size_type __n2)
+  AICUDA_HD static int _S_compare(size_type __n1, size_type __n2)
   {
     const difference_type __d = difference_type(__n1 - __n2);
 
@@ -553,115 +310,128 @@ private:
       return int(__d);
   }
 
-  __device__ void _M_mutate(size_type __pos, size_type __len1,
-                            size_type __len2);
+  AICUDA_HD void _M_mutate(size_type __pos, size_type __len1,
+                           size_type __len2);
 
-  __device__ void _M_leak_hard();
+  AICUDA_HD void _M_leak_hard();
 
 public:
-  __device__ inline basic_string();
+  AICUDA_HD inline basic_string();
+
+  AICUDA_HD explicit basic_string(const _Alloc &__a);
 
-  __device__ explicit basic_string(const _Alloc &__a);
+  AICUDA_HD basic_string(const basic_string &__str);
 
-  __device__ basic_string(const basic_string &__str);
+  AICUDA_HD basic_string(const basic_string &__str, size_type __pos,
+                         size_type __n = npos);
 
-  __device__ basic_string(const basic_string &__str, size_type __pos,
-                          size_type __n = npos);
+  AICUDA_HD basic_string(const basic_string &__str, size_type __pos,
+                         size_type __n, const _Alloc &__a);
+  AICUDA_HD basic_string(const _CharT *__s, size_type __n,
+                         const _Alloc &__a = _Alloc());
 
-  __device__ basic_string(const basic_string &__str, size_type __pos,
-                          size_type __n, const _Alloc &__a);
-  __device__ basic_string(const _CharT *__s, size_type __n,
-                          const _Alloc &__a = _Alloc());
+  AICUDA_HD basic_string(const _CharT *__s, const _Alloc &__a = _Alloc());
 
-  __device__ basic_string(const _CharT *__s, const _Alloc &__a = _Alloc());
+  AICUDA_HD explicit basic_string(__sv_type __sv,
+                                  const _Alloc &__a = _Alloc());
 
-  __device__ basic_string(size_type __n, _CharT __c,
-                          const _Alloc &__a = _Alloc());
+  AICUDA_HD basic_string(size_type __n, _CharT __c,
+                         const _Alloc &__a = _Alloc());
   template <class _InputIterator>
-  __device__ basic_string(_InputIterator __beg, _InputIterator __end,
-                          const _Alloc &__a = _Alloc());
+  AICUDA_HD basic_string(_InputIterator __beg, _InputIterator __end,
+                         const _Alloc &__a = _Alloc());
 
-  __device__ ~basic_string() { _M_rep()->_M_dispose(this->get_allocator()); }
+  AICUDA_HD ~basic_string() { _M_dispose_rep(this->get_allocator()); }
 
-  __device__ basic_string &operator=(const basic_string &__str)
+  AICUDA_HD basic_string &operator=(const basic_string &__str)
   {
     return this->assign(__str);
   }
 
-  __device__ basic_string &operator=(const _CharT *__s)
+  AICUDA_HD basic_string &operator=(const _CharT *__s)
   {
     return this->assign(__s);
   }
 
-  __device__ basic_string &operator=(_CharT __c)
+  AICUDA_HD basic_string &operator=(_CharT __c)
   {
     this->assign(1, __c);
     return *this;
   }
 
-  __device__ iterator begin()
+  AICUDA_HD basic_string &operator=(__sv_type __sv)
+  {
+    return this->assign(__sv);
+  }
+
+  AICUDA_HD operator __sv_type() const
+  {
+    return __sv_type(_M_data(), this->size());
+  }
+
+  AICUDA_HD iterator begin()
   {
     _M_leak();
     return iterator(_M_data());
   }
 
-  __device__ const_iterator begin() const { return const_iterator(_M_data()); }
+  AICUDA_HD const_iterator begin() const { return const_iterator(_M_data()); }
 
-  __device__ iterator end()
+  AICUDA_HD iterator end()
   {
     _M_leak();
     return iterator(_M_data() + this->size());
   }
 
-  __device__ const_iterator end() const
+  AICUDA_HD const_iterator end() const
   {
     return const_iterator(_M_data() + this->size());
   }
 
-  __device__ reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+  AICUDA_HD reverse_iterator rbegin() { return reverse_iterator(this->end()); }
 
-  __device__ const_reverse_iterator rbegin() const
+  AICUDA_HD const_reverse_iterator rbegin() const
   {
     return const_reverse_iterator(this->end());
   }
 
-  __device__ reverse_iterator rend() { return reverse_iterator(this->begin()); }
+  AICUDA_HD reverse_iterator rend() { return reverse_iterator(this->begin()); }
 
-  __device__ const_reverse_iterator rend() const
+  AICUDA_HD const_reverse_iterator rend() const
   {
     return const_reverse_iterator(this->begin());
   }
 
 public:
-  __device__ size_type size() const { return _M_rep()->_M_length; }
+  AICUDA_HD size_type size() const { return _M_rep()->_M_length; }
 
-  __device__ size_type length() const { return _M_rep()->_M_length; }
+  AICUDA_HD size_type length() const { return _M_rep()->_M_length; }
 
-  __device__ constexpr size_type max_size() const
+  AICUDA_HD constexpr size_type max_size() const
   {
     return ((((size_type)(-1) - sizeof(_Rep_base)) / sizeof(_CharT)) - 1) / 4;
   }
 
-  __device__ void resize(size_type __n, _CharT __c);
+  AICUDA_HD void resize(size_type __n, _CharT __c);
 
-  __device__ void resize(size_type __n) { this->resize(__n, _CharT()); }
+  AICUDA_HD void resize(size_type __n) { this->resize(__n, _CharT()); }
 
-  __device__ size_type capacity() const { return _M_rep()->_M_capacity; }
-  __device__ void reserve(size_type __res_arg = 0);
+  AICUDA_HD size_type capacity() const { return _M_rep()->_M_capacity; }
+  AICUDA_HD void reserve(size_type __res_arg = 0);
 
-  __device__ void clear() { _M_mutate(0, this->size(), 0); }
+  AICUDA_HD void clear() { _M_mutate(0, this->size(), 0); }
 
-  __device__ bool empty() const { return this->size() == 0; }
-  __device__ const_reference operator[](size_type __pos) const
+  AICUDA_HD bool empty() const { return this->size() == 0; }
+  AICUDA_HD const_reference operator[](size_type __pos) const
   {
     return _M_data()[__pos];
   }
-  __device__ reference operator[](size_type __pos)
+  AICUDA_HD reference operator[](size_type __pos)
   {
     _M_leak();
     return _M_data()[__pos];
   }
-  __device__ const_reference at(size_type __n) const
+  AICUDA_HD const_reference at(size_type __n) const
   {
     if (__n >= this->size())
     {
@@ -670,7 +440,7 @@ public:
     }
     return _M_data()[__n];
   }
-  __device__ reference at(size_type __n)
+  AICUDA_HD reference at(size_type __n)
   {
     if (__n >= size())
     {
@@ -681,41 +451,50 @@ public:
     return _M_data()[__n];
   }
 
-  __device__ basic_string &operator+=(const basic_string &__str)
+  AICUDA_HD basic_string &operator+=(const basic_string &__str)
   {
     return this->append(__str);
   }
 
-  __device__ basic_string &operator+=(const _CharT *__s)
+  AICUDA_HD basic_string &operator+=(const _CharT *__s)
   {
     return this->append(__s);
   }
 
-  __device__ basic_string &operator+=(_CharT __c)
+  AICUDA_HD basic_string &operator+=(_CharT __c)
   {
     this->push_back(__c);
     return *this;
   }
-  __device__ basic_string &append(const basic_string &__str);
-  __device__ basic_string &append(const basic_string &__str, size_type __pos,
-                                  size_type __n);
 
-  __device__ basic_string &append(const _CharT *__s, size_type __n);
+  AICUDA_HD basic_string &operator+=(__sv_type __sv)
+  {
+    return this->append(__sv);
+  }
+  AICUDA_HD basic_string &append(const basic_string &__str);
+  AICUDA_HD basic_string &append(const basic_string &__str, size_type __pos,
+                                 size_type __n);
 
-  __device__ basic_string &append(const _CharT *__s)
+  AICUDA_HD basic_string &append(const _CharT *__s, size_type __n);
+
+  AICUDA_HD basic_string &append(const _CharT *__s)
   {
     ;
     return this->append(__s, traits_type::length(__s));
   }
-  __device__ basic_string &append(size_type __n, _CharT __c);
+  AICUDA_HD basic_string &append(size_type __n, _CharT __c);
+  AICUDA_HD basic_string &append(__sv_type __sv)
+  {
+    return this->append(__sv.data(), __sv.size());
+  }
   template <class _InputIterator>
-  __device__ basic_string &append(_InputIterator __first,
-                                  _InputIterator __last)
+  AICUDA_HD basic_string &append(_InputIterator __first,
+                                 _InputIterator __last)
   {
     return this->replace(_M_iend(), _M_iend(), __first, __last);
   }
 
-  __device__ void push_back(_CharT __c)
+  AICUDA_HD void push_back(_CharT __c)
   {
     const size_type __len = 1 + this->size();
     if (__len > this->capacity() || _M_rep()->_M_is_shared())
@@ -724,161 +503,165 @@ public:
     _M_rep()->_M_set_length_and_sharable(__len);
   }
 
-  __device__ basic_string &assign(const basic_string &__str);
-  __device__ basic_string &assign(const basic_string &__str, size_type __pos,
-                                  size_type __n)
+  AICUDA_HD basic_string &assign(const basic_string &__str);
+  AICUDA_HD basic_string &assign(const basic_string &__str, size_type __pos,
+                                 size_type __n)
   {
     return this->assign(
         __str._M_data() + __str._M_check(__pos, "basic_string::assign"),
         __str._M_limit(__pos, __n));
   }
-  __device__ basic_string &assign(const _CharT *__s, size_type __n);
-  __device__ basic_string &assign(const _CharT *__s)
+  AICUDA_HD basic_string &assign(const _CharT *__s, size_type __n);
+  AICUDA_HD basic_string &assign(const _CharT *__s)
   {
     return this->assign(__s, traits_type::length(__s));
   }
-  __device__ basic_string &assign(size_type __n, _CharT __c)
+  AICUDA_HD basic_string &assign(size_type __n, _CharT __c)
   {
     return _M_replace_aux(size_type(0), this->size(), __n, __c);
   }
+  AICUDA_HD basic_string &assign(__sv_type __sv)
+  {
+    return this->assign(__sv.data(), __sv.size());
+  }
   template <class _InputIterator>
-  __device__ basic_string &assign(_InputIterator __first,
-                                  _InputIterator __last)
+  AICUDA_HD basic_string &assign(_InputIterator __first,
+                                 _InputIterator __last)
   {
     return this->replace(_M_ibegin(), _M_iend(), __first, __last);
   }
-  __device__ void insert(iterator __p, size_type __n, _CharT __c)
+  AICUDA_HD void insert(iterator __p, size_type __n, _CharT __c)
   {
     this->replace(__p, __p, __n, __c);
   }
   template <class _InputIterator>
-  __device__ void insert(iterator __p, _InputIterator __beg,
-                         _InputIterator __end)
+  AICUDA_HD void insert(iterator __p, _InputIterator __beg,
+                        _InputIterator __end)
   {
     this->replace(__p, __p, __beg, __end);
   }
-  __device__ basic_string &insert(size_type __pos1, const basic_string &__str)
+  AICUDA_HD basic_string &insert(size_type __pos1, const basic_string &__str)
   {
     return this->insert(__pos1, __str, size_type(0), __str.size());
   }
-  __device__ basic_string &insert(size_type __pos1, const basic_string &__str,
-                                  size_type __pos2, size_type __n)
+  AICUDA_HD basic_string &insert(size_type __pos1, const basic_string &__str,
+                                 size_type __pos2, size_type __n)
   {
     return this->insert(
         __pos1,
         __str._M_data() + __str._M_check(__pos2, "basic_string::insert"),
         __str._M_limit(__pos2, __n));
   }
-  __device__ basic_string &insert(size_type __pos, const _CharT *__s,
-                                  size_type __n);
-  __device__ basic_string &insert(size_type __pos, const _CharT *__s)
+  AICUDA_HD basic_string &insert(size_type __pos, const _CharT *__s,
+                                 size_type __n);
+  AICUDA_HD basic_string &insert(size_type __pos, const _CharT *__s)
   {
     return this->insert(__pos, __s, traits_type::length(__s));
   }
-  __device__ basic_string &insert(size_type __pos, size_type __n, _CharT __c)
+  AICUDA_HD basic_string &insert(size_type __pos, size_type __n, _CharT __c)
   {
     return _M_replace_aux(_M_check(__pos, "basic_string::insert"), size_type(0),
                           __n, __c);
   }
-  __device__ iterator insert(iterator __p, _CharT __c)
+  AICUDA_HD iterator insert(iterator __p, _CharT __c)
   {
     const size_type __pos = __p - _M_ibegin();
     _M_replace_aux(__pos, size_type(0), size_type(1), __c);
     _M_rep()->_M_set_leaked();
     return iterator(_M_data() + __pos);
   }
-  __device__ basic_string &erase(size_type __pos = 0, size_type __n = npos)
+  AICUDA_HD basic_string &erase(size_type __pos = 0, size_type __n = npos)
   {
     _M_mutate(_M_check(__pos, "basic_string::erase"), _M_limit(__pos, __n),
               size_type(0));
     return *this;
   }
-  __device__ iterator erase(iterator __position)
+  AICUDA_HD iterator erase(iterator __position)
   {
     const size_type __pos = __position - _M_ibegin();
     _M_mutate(__pos, size_type(1), size_type(0));
     _M_rep()->_M_set_leaked();
     return iterator(_M_data() + __pos);
   }
-  __device__ iterator erase(iterator __first, iterator __last);
-  __device__ basic_string &replace(size_type __pos, size_type __n,
-                                   const basic_string &__str)
+  AICUDA_HD iterator erase(iterator __first, iterator __last);
+  AICUDA_HD basic_string &replace(size_type __pos, size_type __n,
+                                  const basic_string &__str)
   {
     return this->replace(__pos, __n, __str._M_data(), __str.size());
   }
-  __device__ basic_string &replace(size_type __pos1, size_type __n1,
-                                   const basic_string &__str, size_type __pos2,
-                                   size_type __n2)
+  AICUDA_HD basic_string &replace(size_type __pos1, size_type __n1,
+                                  const basic_string &__str, size_type __pos2,
+                                  size_type __n2)
   {
     return this->replace(
         __pos1, __n1,
         __str._M_data() + __str._M_check(__pos2, "basic_string::replace"),
         __str._M_limit(__pos2, __n2));
   }
-  __device__ basic_string &replace(size_type __pos, size_type __n1,
-                                   const _CharT *__s, size_type __n2);
-  __device__ basic_string &replace(size_type __pos, size_type __n1,
-                                   const _CharT *__s)
+  AICUDA_HD basic_string &replace(size_type __pos, size_type __n1,
+                                  const _CharT *__s, size_type __n2);
+  AICUDA_HD basic_string &replace(size_type __pos, size_type __n1,
+                                  const _CharT *__s)
   {
     ;
     return this->replace(__pos, __n1, __s, traits_type::length(__s));
   }
-  __device__ basic_string &replace(size_type __pos, size_type __n1,
-                                   size_type __n2, _CharT __c)
+  AICUDA_HD basic_string &replace(size_type __pos, size_type __n1,
+                                  size_type __n2, _CharT __c)
   {
     return _M_replace_aux(_M_check(__pos, "basic_string::replace"),
                           _M_limit(__pos, __n1), __n2, __c);
   }
-  __device__ basic_string &replace(iterator __i1, iterator __i2,
-                                   const basic_string &__str)
+  AICUDA_HD basic_string &replace(iterator __i1, iterator __i2,
+                                  const basic_string &__str)
   {
     return this->replace(__i1, __i2, __str._M_data(), __str.size());
   }
-  __device__ basic_string &replace(iterator __i1, iterator __i2,
-                                   const _CharT *__s, size_type __n)
+  AICUDA_HD basic_string &replace(iterator __i1, iterator __i2,
+                                  const _CharT *__s, size_type __n)
   {
     return this->replace(__i1 - _M_ibegin(), __i2 - __i1, __s, __n);
   }
-  __device__ basic_string &replace(iterator __i1, iterator __i2,
-                                   const _CharT *__s)
+  AICUDA_HD basic_string &replace(iterator __i1, iterator __i2,
+                                  const _CharT *__s)
   {
     return this->replace(__i1, __i2, __s, traits_type::length(__s));
   }
-  __device__ basic_string &replace(iterator __i1, iterator __i2, size_type __n,
-                                   _CharT __c)
+  AICUDA_HD basic_string &replace(iterator __i1, iterator __i2, size_type __n,
+                                  _CharT __c)
   {
     return _M_replace_aux(__i1 - _M_ibegin(), __i2 - __i1, __n, __c);
   }
   template <class _InputIterator>
-  __device__ basic_string &replace(iterator __i1, iterator __i2,
-                                   _InputIterator __k1, _InputIterator __k2)
+  AICUDA_HD basic_string &replace(iterator __i1, iterator __i2,
+                                  _InputIterator __k1, _InputIterator __k2)
   {
     typedef
         typename aicuda::stl::__is_integer<_InputIterator>::__type _Integral;
     return _M_replace_dispatch(__i1, __i2, __k1, __k2, _Integral());
   }
 
-  __device__ basic_string &replace(iterator __i1, iterator __i2, _CharT *__k1,
-                                   _CharT *__k2)
+  AICUDA_HD basic_string &replace(iterator __i1, iterator __i2, _CharT *__k1,
+                                  _CharT *__k2)
   {
     return this->replace(__i1 - _M_ibegin(), __i2 - __i1, __k1, __k2 - __k1);
   }
 
-  __device__ basic_string &replace(iterator __i1, iterator __i2,
-                                   const _CharT *__k1, const _CharT *__k2)
+  AICUDA_HD basic_string &replace(iterator __i1, iterator __i2,
+                                  const _CharT *__k1, const _CharT *__k2)
   {
     return this->replace(__i1 - _M_ibegin(), __i2 - __i1, __k1, __k2 - __k1);
   }
 
-  __device__ basic_string &replace(iterator __i1, iterator __i2, iterator __k1,
-                                   iterator __k2)
+  AICUDA_HD basic_string &replace(iterator __i1, iterator __i2, iterator __k1,
+                                  iterator __k2)
   {
     return this->replace(__i1 - _M_ibegin(), __i2 - __i1, __k1.base(),
                          __k2 - __k1);
   }
 
-  __device__ basic_string &replace(iterator __i1, iterator __i2,
-                                   const_iterator __k1, const_iterator __k2)
+  AICUDA_HD basic_string &replace(iterator __i1, iterator __i2,
+                                  const_iterator __k1, const_iterator __k2)
   {
     return this->replace(__i1 - _M_ibegin(), __i2 - __i1, __k1.base(),
                          __k2 - __k1);
@@ -886,164 +669,199 @@ public:
 
 private:
   template <class _Integer>
-  __device__ basic_string &_M_replace_dispatch(iterator __i1, iterator __i2,
-                                               _Integer __n, _Integer __val,
-                                               __true_type)
+  AICUDA_HD basic_string &_M_replace_dispatch(iterator __i1, iterator __i2,
+                                              _Integer __n, _Integer __val,
+                                              __true_type)
   {
     return _M_replace_aux(__i1 - _M_ibegin(), __i2 - __i1, __n, __val);
   }
 
   template <class _InputIterator>
-  __device__ basic_string &_M_replace_dispatch(iterator __i1, iterator __i2,
-                                               _InputIterator __k1,
-                                               _InputIterator __k2,
-                                               __false_type);
+  AICUDA_HD basic_string &_M_replace_dispatch(iterator __i1, iterator __i2,
+                                              _InputIterator __k1,
+                                              _InputIterator __k2,
+                                              __false_type);
 
-  __device__ basic_string &_M_replace_aux(size_type __pos1, size_type __n1,
-                                          size_type __n2, _CharT __c);
+  AICUDA_HD basic_string &_M_replace_aux(size_type __pos1, size_type __n1,
+                                         size_type __n2, _CharT __c);
 
-  __device__ basic_string &_M_replace_safe(size_type __pos1, size_type __n1,
-                                           const _CharT *__s, size_type __n2);
+  AICUDA_HD basic_string &_M_replace_safe(size_type __pos1, size_type __n1,
+                                          const _CharT *__s, size_type __n2);
 
+  // The _S_construct family builds the rep in __local (the new string's
+  // inline buffer) when the result fits there.
   template <class _InIterator>
-  __device__ static _CharT *_S_construct_aux(_InIterator __beg,
-                                             _InIterator __end,
-                                             const _Alloc &__a, __false_type)
+  AICUDA_HD static _CharT *_S_construct_aux(_InIterator __beg,
+                                            _InIterator __end,
+                                            const _Alloc &__a, void *__local,
+                                            __false_type)
   {
     typedef typename iterator_traits<_InIterator>::iterator_category _Tag;
-    return _S_construct(__beg, __end, __a, _Tag());
+    return _S_construct(__beg, __end, __a, __local, _Tag());
   }
 
   template <class _Integer>
-  __device__ static _CharT *_S_construct_aux(_Integer __beg, _Integer __end,
-                                             const _Alloc &__a, __true_type)
+  AICUDA_HD static _CharT *_S_construct_aux(_Integer __beg, _Integer __end,
+                                            const _Alloc &__a, void *__local,
+                                            __true_type)
   {
-    return _S_construct(static_cast<size_type>(__beg), __end, __a);
+    return _S_construct(static_cast<size_type>(__beg), __end, __a, __local);
   }
 
   template <class _InIterator>
-  __device__ static _CharT *_S_construct(_InIterator __beg, _InIterator __end,
-                                         const _Alloc &__a)
+  AICUDA_HD static _CharT *_S_construct(_InIterator __beg, _InIterator __end,
+                                        const _Alloc &__a, void *__local)
   {
     typedef typename aicuda::stl::__is_integer<_InIterator>::__type _Integral;
-    return _S_construct_aux(__beg, __end, __a, _Integral());
+    return _S_construct_aux(__beg, __end, __a, __local, _Integral());
   }
 
   template <class _InIterator>
-  __device__ static _CharT *_S_construct(_InIterator __beg, _InIterator __end,
-                                         const _Alloc &__a, input_iterator_tag);
+  AICUDA_HD static _CharT *_S_construct(_InIterator __beg, _InIterator __end,
+                                        const _Alloc &__a, void *__local,
+                                        input_iterator_tag);
 
   template <class _FwdIterator>
-  __device__ static _CharT *_S_construct(_FwdIterator __beg, _FwdIterator __end,
-                                         const _Alloc &__a,
-                                         forward_iterator_tag);
+  AICUDA_HD static _CharT *_S_construct(_FwdIterator __beg, _FwdIterator __end,
+                                        const _Alloc &__a, void *__local,
+                                        forward_iterator_tag);
 
-  __device__ static _CharT *_S_construct(size_type __req, _CharT __c,
-                                         const _Alloc &__a);
+  AICUDA_HD static _CharT *_S_construct(size_type __req, _CharT __c,
+                                        const _Alloc &__a, void *__local);
 
 public:
-  __device__ size_type copy(_CharT *__s, size_type __n,
-                            size_type __pos = 0) const;
-  __device__ void swap(basic_string &__s);
-  __device__ const _CharT *c_str() const { return _M_data(); }
+  AICUDA_HD size_type copy(_CharT *__s, size_type __n,
+                           size_type __pos = 0) const;
+  AICUDA_HD void swap(basic_string &__s);
+  AICUDA_HD const _CharT *c_str() const { return _M_data(); }
 
-  __device__ const _CharT *data() const { return _M_data(); }
+  AICUDA_HD const _CharT *data() const { return _M_data(); }
 
-  __device__ allocator_type get_allocator() const { return _M_dataplus; }
-  __device__ size_type find(const _CharT *__s, size_type __pos,
-                            size_type __n) const;
-  __device__ size_type find(const basic_string &__str,
-                            size_type __pos = 0) const
+  AICUDA_HD allocator_type get_allocator() const { return _M_dataplus; }
+  AICUDA_HD size_type find(const _CharT *__s, size_type __pos,
+                           size_type __n) const;
+  AICUDA_HD size_type find(const basic_string &__str,
+                           size_type __pos = 0) const
   {
     return this->find(__str.data(), __pos, __str.size());
   }
-  __device__ size_type find(const _CharT *__s, size_type __pos = 0) const
+  AICUDA_HD size_type find(__sv_type __sv,
+                           size_type __pos = 0) const
+  {
+    return this->find(__sv.data(), __pos, __sv.size());
+  }
+  AICUDA_HD size_type find(const _CharT *__s, size_type __pos = 0) const
   {
     return this->find(__s, __pos, traits_type::length(__s));
   }
-  __device__ size_type find(_CharT __c, size_type __pos = 0) const;
-  __device__ size_type rfind(const basic_string &__str,
-                             size_type __pos = npos) const
+  AICUDA_HD size_type find(_CharT __c, size_type __pos = 0) const;
+  AICUDA_HD size_type rfind(const basic_string &__str,
+                            size_type __pos = npos) const
   {
     return this->rfind(__str.data(), __pos, __str.size());
   }
-  __device__ size_type rfind(const _CharT *__s, size_type __pos,
-                             size_type __n) const;
-  __device__ size_type rfind(const _CharT *__s, size_type __pos = npos) const
+  AICUDA_HD size_type rfind(__sv_type __sv,
+                            size_type __pos = npos) const
+  {
+    return this->rfind(__sv.data(), __pos, __sv.size());
+  }
+  AICUDA_HD size_type rfind(const _CharT *__s, size_type __pos,
+                            size_type __n) const;
+  AICUDA_HD size_type rfind(const _CharT *__s, size_type __pos = npos) const
   {
     ;
     return this->rfind(__s, __pos, traits_type::length(__s));
   }
-  __device__ size_type rfind(_CharT __c, size_type __pos = npos) const;
-  __device__ size_type find_first_of(const basic_string &__str,
-                                     size_type __pos = 0) const
+  AICUDA_HD size_type rfind(_CharT __c, size_type __pos = npos) const;
+  AICUDA_HD size_type find_first_of(const basic_string &__str,
+                                    size_type __pos = 0) const
   {
     return this->find_first_of(__str.data(), __pos, __str.size());
   }
-  __device__ size_type find_first_of(const _CharT *__s, size_type __pos,
-                                     size_type __n) const;
-  __device__ size_type find_first_of(const _CharT *__s,
-                                     size_type __pos = 0) const
+  AICUDA_HD size_type find_first_of(__sv_type __sv,
+                                    size_type __pos = 0) const
+  {
+    return this->find_first_of(__sv.data(), __pos, __sv.size());
+  }
+  AICUDA_HD size_type find_first_of(const _CharT *__s, size_type __pos,
+                                    size_type __n) const;
+  AICUDA_HD size_type find_first_of(const _CharT *__s,
+                                    size_type __pos = 0) const
   {
     ;
     return this->find_first_of(__s, __pos, traits_type::length(__s));
   }
-  __device__ size_type find_first_of(_CharT __c, size_type __pos = 0) const
+  AICUDA_HD size_type find_first_of(_CharT __c, size_type __pos = 0) const
   {
     return this->find(__c, __pos);
   }
-  __device__ size_type find_last_of(const basic_string &__str,
-                                    size_type __pos = npos) const
+  AICUDA_HD size_type find_last_of(const basic_string &__str,
+                                   size_type __pos = npos) const
   {
     return this->find_last_of(__str.data(), __pos, __str.size());
   }
-  __device__ size_type find_last_of(const _CharT *__s, size_type __pos,
-                                    size_type __n) const;
-  __device__ size_type find_last_of(const _CharT *__s,
-                                    size_type __pos = npos) const
+  AICUDA_HD size_type find_last_of(__sv_type __sv,
+                                   size_type __pos = npos) const
+  {
+    return this->find_last_of(__sv.data(), __pos, __sv.size());
+  }
+  AICUDA_HD size_type find_last_of(const _CharT *__s, size_type __pos,
+                                   size_type __n) const;
+  AICUDA_HD size_type find_last_of(const _CharT *__s,
+                                   size_type __pos = npos) const
   {
     ;
     return this->find_last_of(__s, __pos, traits_type::length(__s));
   }
-  __device__ size_type find_last_of(_CharT __c, size_type __pos = npos) const
+  AICUDA_HD size_type find_last_of(_CharT __c, size_type __pos = npos) const
   {
     return this->rfind(__c, __pos);
   }
-  __device__ size_type find_first_not_of(const basic_string &__str,
-                                         size_type __pos = 0) const
+  AICUDA_HD size_type find_first_not_of(const basic_string &__str,
+                                        size_type __pos = 0) const
   {
     return this->find_first_not_of(__str.data(), __pos, __str.size());
   }
-  __device__ size_type find_first_not_of(const _CharT *__s, size_type __pos,
-                                         size_type __n) const;
-  __device__ size_type find_first_not_of(const _CharT *__s,
-                                         size_type __pos = 0) const
+  AICUDA_HD size_type find_first_not_of(__sv_type __sv,
+                                        size_type __pos = 0) const
+  {
+    return this->find_first_not_of(__sv.data(), __pos, __sv.size());
+  }
+  AICUDA_HD size_type find_first_not_of(const _CharT *__s, size_type __pos,
+                                        size_type __n) const;
+  AICUDA_HD size_type find_first_not_of(const _CharT *__s,
+                                        size_type __pos = 0) const
   {
     ;
     return this->find_first_not_of(__s, __pos, traits_type::length(__s));
   }
-  __device__ size_type find_first_not_of(_CharT __c, size_type __pos = 0) const;
-  __device__ size_type find_last_not_of(const basic_string &__str,
-                                        size_type __pos = npos) const
+  AICUDA_HD size_type find_first_not_of(_CharT __c, size_type __pos = 0) const;
+  AICUDA_HD size_type find_last_not_of(const basic_string &__str,
+                                       size_type __pos = npos) const
   {
     return this->find_last_not_of(__str.data(), __pos, __str.size());
   }
-  __device__ size_type find_last_not_of(const _CharT *__s, size_type __pos,
-                                        size_type __n) const;
-  __device__ size_type find_last_not_of(const _CharT *__s,
-                                        size_type __pos = npos) const
+  AICUDA_HD size_type find_last_not_of(__sv_type __sv,
+                                       size_type __pos = npos) const
+  {
+    return this->find_last_not_of(__sv.data(), __pos, __sv.size());
+  }
+  AICUDA_HD size_type find_last_not_of(const _CharT *__s, size_type __pos,
+                                       size_type __n) const;
+  AICUDA_HD size_type find_last_not_of(const _CharT *__s,
+                                       size_type __pos = npos) const
   {
     ;
     return this->find_last_not_of(__s, __pos, traits_type::length(__s));
   }
-  __device__ size_type find_last_not_of(_CharT __c,
-                                        size_type __pos = npos) const;
-  __device__ basic_string substr(size_type __pos = 0,
-                                 size_type __n = npos) const
+  AICUDA_HD size_type find_last_not_of(_CharT __c,
+                                       size_type __pos = npos) const;
+  AICUDA_HD basic_string substr(size_type __pos = 0,
+                                size_type __n = npos) const
   {
     return basic_string(*this, _M_check(__pos, "basic_string::substr"), __n);
   }
-  __device__ int compare(const basic_string &__str) const
+  AICUDA_HD int compare(const basic_string &__str) const
   {
     const size_type __size = this->size();
     const size_type __osize = __str.size();
@@ -1054,92 +872,154 @@ public:
       __r = _S_compare(__size, __osize);
     return __r;
   }
-  __device__ int compare(size_type __pos, size_type __n,
-                         const basic_string &__str) const;
-  __device__ int compare(size_type __pos1, size_type __n1,
-                         const basic_string &__str, size_type __pos2,
-                         size_type __n2) const;
-  __device__ int compare(const _CharT *__s) const;
-  __device__ int compare(size_type __pos, size_type __n1,
-                         const _CharT *__s) const;
-  __device__ int compare(size_type __pos, size_type __n1, const _CharT *__s,
-                         size_type __n2) const;
+  AICUDA_HD int compare(size_type __pos, size_type __n,
+                        const basic_string &__str) const;
+  AICUDA_HD int compare(size_type __pos1, size_type __n1,
+                        const basic_string &__str, size_type __pos2,
+                        size_type __n2) const;
+  AICUDA_HD int compare(__sv_type __sv) const
+  {
+    const size_type __size = this->size();
+    const size_type __osize = __sv.size();
+    const size_type __len = aicuda::stl::min(__size, __osize);
+
+    int __r = traits_type::compare(_M_data(), __sv.data(), __len);
+    if (!__r)
+      __r = _S_compare(__size, __osize);
+    return __r;
+  }
+  AICUDA_HD int compare(size_type __pos, size_type __n,
+                        __sv_type __sv) const
+  {
+    return this->compare(__pos, __n, __sv.data(), __sv.size());
+  }
+  AICUDA_HD int compare(const _CharT *__s) const;
+  AICUDA_HD int compare(size_type __pos, size_type __n1,
+                        const _CharT *__s) const;
+  AICUDA_HD int compare(size_type __pos, size_type __n1, const _CharT *__s,
+                        size_type __n2) const;
 
   template <typename Real>
-  __device__ static basic_string to_string(Real __n, int __prec = 5,
-                                           int __base = 10)
+  AICUDA_HD static basic_string to_string(Real __n, int __prec = 5,
+                                          int __base = 10)
   {
     typedef typename aicuda::stl::__conditional_type<aicuda::stl::__is_boolean<Real>::__value,      bool,
+            typename aicuda::stl::__conditional_type<aicuda::stl::__is_unsigned_integer<Real>::__value, unsigned long long int,
             typename aicuda::stl::__conditional_type<aicuda::stl::__is_integer<Real>::__value,      long long int,
             typename aicuda::stl::__conditional_type<aicuda::stl::__is_floating<Real>::__value,     double,
             typename aicuda::stl::__conditional_type<aicuda::stl::__is_char_pointer<Real>::__value, const char *,
-            void>::__type>::__type>::__type>::__type __Ty;
+            void>::__type>::__type>::__type>::__type>::__type __Ty;
     return to_string((__Ty)__n, __prec, __base);
   }
 
-  __device__ static basic_string to_string(const char *__input, int __prec,
-                                           int __base)
+  AICUDA_HD static basic_string to_string(const char *__input, int __prec,
+                                          int __base)
   {
     return basic_string(__input);
   }
 
-  __device__ static basic_string to_string(bool __input, int __prec,
-                                           int __base)
+  AICUDA_HD static basic_string to_string(bool __input, int __prec,
+                                          int __base)
   {
     return __input ? "true" : "false";
   }
 
-  __device__ static basic_string to_string(long long int __input, int __prec,
-                                           int __base)
+  // Integers are formatted by to_chars into a stack buffer (65 bytes holds
+  // a 64-bit value in base 2 plus its sign); the result usually fits the
+  // inline buffer, so no heap allocation is made.
+  AICUDA_HD static basic_string to_string(long long int __input,
+                                          int /*__prec*/, int __base)
   {
-    char buf[36];
-    char *p = &buf[34];
-    buf[35] = 0;
-    int minus = 0;
-    if (__input < 0)
-    {
-      minus = 1;
-      __input = -__input;
-    }
-    if (__input == 0)
-      *--p = '0';
-    else
-      while (__input > 0)
-      {
-        *--p = "0123456789abcdef"[__input % __base];
-        __input /= __base;
-      }
-    if (minus)
-      *--p = '-';
-    return p;
+    char __buf[65];
+    const to_chars_result __r =
+        aicuda::stl::to_chars(__buf, __buf + sizeof(__buf), __input, __base);
+    return basic_string(__buf, size_type(__r.ptr - __buf));
   }
 
-  __device__ static basic_string to_string(double __input, int __prec,
-                                           int __base)
+  AICUDA_HD static basic_string to_string(unsigned long long int __input,
+                                          int /*__prec*/, int __base)
   {
-    long long int __Integer = (long long int)__input;
-    basic_string __ret = to_string(__Integer, __prec, __base);
-    __ret.append(1, '.');
-    __input -= __Integer;
-    for (int i = 0; i < __prec; ++i)
-      __input *= 10;
-    basic_string postfix = to_string((long long int)__input, __prec, __base);
-    int c = __prec - postfix.size();
-    if (c > 0)
-      __ret.append(c, '0');
+    char __buf[65];
+    const to_chars_result __r =
+        aicuda::stl::to_chars(__buf, __buf + sizeof(__buf), __input, __base);
+    return basic_string(__buf, size_type(__r.ptr - __buf));
+  }
 
-    return __ret + postfix;
+  // Doubles: a negative precision gives the shortest digits that read back
+  // as the same value; otherwise exactly __prec digits after the point,
+  // correctly rounded.  The digits are formatted on the stack by to_chars
+  // (352 bytes holds any double with up to 40 fraction digits); longer
+  // requests format straight into the result.  In other bases (2 to 36) a
+  // finite value is written as its sign, the integer part and, for a
+  // positive __prec, __prec truncated fraction digits, all in __base; a
+  // negative __prec gives the integer part alone.  Magnitudes of 2^64 and
+  // above are clamped to the largest double below it.  Infinities and NaN
+  // are spelled as in base 10.
+  AICUDA_HD static basic_string to_string(double __input, int __prec,
+                                          int __base)
+  {
+    if (__base != 10 && __input - __input == 0)
+    {
+      basic_string __ret;
+      if (__input < 0)
+      {
+        __ret.append(size_type(1), _CharT('-'));
+        __input = -__input;
+      }
+      if (__input > 18446744073709549568.0)
+        __input = 18446744073709549568.0;
+      const unsigned long long int __integer =
+          (unsigned long long int)__input;
+      __ret.append(to_string(__integer, 0, __base));
+      __input -= double(__integer);
+      if (__prec > 0)
+      {
+        __ret.append(size_type(1), _CharT('.'));
+        for (int __i = 0; __i < __prec; ++__i)
+        {
+          __input *= __base;
+          const int __d = int(__input);
+          __ret.append(size_type(1),
+                       _CharT("0123456789abcdefghijklmnopqrstuvwxyz"[__d]));
+          __input -= __d;
+        }
+      }
+      return __ret;
+    }
+    if (__prec < 0)
+    {
+      char __buf[32];
+      const to_chars_result __r =
+          aicuda::stl::to_chars(__buf, __buf + sizeof(__buf), __input);
+      return basic_string(__buf, size_type(__r.ptr - __buf));
+    }
+    if (__prec <= 40)
+    {
+      char __buf[352];
+      const to_chars_result __r = aicuda::stl::to_chars(
+          __buf, __buf + sizeof(__buf), __input, chars_format::fixed, __prec);
+      return basic_string(__buf, size_type(__r.ptr - __buf));
+    }
+    // Sign, 309 integer digits, the point and the fraction.
+    basic_string __ret(size_type(311 + __prec), _CharT());
+    char *__p = __ret._M_data();
+    const to_chars_result __r = aicuda::stl::to_chars(
+        __p, __p + __ret.size(), __input, chars_format::fixed, __prec);
+    __ret.resize(size_type(__r.ptr - __p));
+    return __ret;
   }
 };
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline basic_string<_CharT, _Traits, _Alloc>::basic_string()
-    : _M_dataplus(_S_construct(size_type(), _CharT(), _Alloc()), _Alloc()){}
+AICUDA_HD inline basic_string<_CharT, _Traits, _Alloc>::basic_string()
+    : _M_dataplus(_S_construct(size_type(), _CharT(), _Alloc(),
+                               _M_local_storage()),
+                  _Alloc()) {}
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc> operator+(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs,
-    const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc> operator+(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   basic_string<_CharT, _Traits, _Alloc> __str(__lhs);
   __str.append(__rhs);
@@ -1147,16 +1027,16 @@ __device__ basic_string<_CharT, _Traits, _Alloc> operator+(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc> operator+(
-    const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs);
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc> operator+(
+   const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs);
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc> operator+(
-    _CharT __lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs);
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc> operator+(
+   _CharT __lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs);
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline basic_string<_CharT, _Traits, _Alloc> operator+(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
+AICUDA_HD inline basic_string<_CharT, _Traits, _Alloc> operator+(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
 {
   basic_string<_CharT, _Traits, _Alloc> __str(__lhs);
   __str.append(__rhs);
@@ -1164,8 +1044,8 @@ __device__ inline basic_string<_CharT, _Traits, _Alloc> operator+(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline basic_string<_CharT, _Traits, _Alloc> operator+(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs, _CharT __rhs)
+AICUDA_HD inline basic_string<_CharT, _Traits, _Alloc> operator+(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs, _CharT __rhs)
 {
   typedef basic_string<_CharT, _Traits, _Alloc> __string_type;
   typedef typename __string_type::size_type __size_type;
@@ -1174,15 +1054,15 @@ __device__ inline basic_string<_CharT, _Traits, _Alloc> operator+(
   return __str;
 }
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator==(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs,
-    const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator==(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   return __lhs.compare(__rhs) == 0;
 }
 
 template <typename _CharT>
-__device__ inline
+AICUDA_HD inline
     typename aicuda::stl::__enable_if<__is_char<_CharT>::__value, bool>::__type
     operator==(const basic_string<_CharT> &__lhs,
                const basic_string<_CharT> &__rhs)
@@ -1193,135 +1073,199 @@ __device__ inline
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator==(
-    const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator==(
+   const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   return __rhs.compare(__lhs) == 0;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator==(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
+AICUDA_HD inline bool operator==(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
 {
   return __lhs.compare(__rhs) == 0;
 }
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline bool operator==(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   basic_string_view<_CharT, _Traits> __rhs)
+{
+  return __lhs.size() == __rhs.size() && __lhs.compare(__rhs) == 0;
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline bool operator==(
+   basic_string_view<_CharT, _Traits> __lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+{
+  return __lhs.size() == __rhs.size() && __rhs.compare(__lhs) == 0;
+}
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline bool operator!=(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+{
+  return !(__lhs == __rhs);
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline bool operator!=(
+   const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+{
+  return !(__lhs == __rhs);
+}
+
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator!=(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs,
-    const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator!=(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
 {
   return !(__lhs == __rhs);
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator!=(
-    const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator!=(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   basic_string_view<_CharT, _Traits> __rhs)
 {
   return !(__lhs == __rhs);
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator!=(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
+AICUDA_HD inline bool operator!=(
+   basic_string_view<_CharT, _Traits> __lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   return !(__lhs == __rhs);
 }
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator<(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs,
-    const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator<(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+{
+  return __lhs.compare(__rhs) < 0;
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline bool operator<(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
 {
   return __lhs.compare(__rhs) < 0;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator<(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
+AICUDA_HD inline bool operator<(
+   const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+{
+  return __rhs.compare(__lhs) > 0;
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline bool operator<(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   basic_string_view<_CharT, _Traits> __rhs)
 {
   return __lhs.compare(__rhs) < 0;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator<(
-    const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator<(
+   basic_string_view<_CharT, _Traits> __lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   return __rhs.compare(__lhs) > 0;
 }
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator>(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs,
-    const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator>(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+{
+  return __lhs.compare(__rhs) > 0;
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline bool operator>(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
 {
   return __lhs.compare(__rhs) > 0;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator>(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
+AICUDA_HD inline bool operator>(
+   const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+{
+  return __rhs.compare(__lhs) < 0;
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD inline bool operator>(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   basic_string_view<_CharT, _Traits> __rhs)
 {
   return __lhs.compare(__rhs) > 0;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator>(
-    const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator>(
+   basic_string_view<_CharT, _Traits> __lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   return __rhs.compare(__lhs) < 0;
 }
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator<=(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs,
-    const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator<=(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   return __lhs.compare(__rhs) <= 0;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator<=(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
+AICUDA_HD inline bool operator<=(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
 {
   return __lhs.compare(__rhs) <= 0;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator<=(
-    const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator<=(
+   const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   return __rhs.compare(__lhs) >= 0;
 }
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator>=(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs,
-    const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator>=(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs,
+   const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   return __lhs.compare(__rhs) >= 0;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator>=(
-    const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
+AICUDA_HD inline bool operator>=(
+   const basic_string<_CharT, _Traits, _Alloc> &__lhs, const _CharT *__rhs)
 {
   return __lhs.compare(__rhs) >= 0;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline bool operator>=(
-    const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline bool operator>=(
+   const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   return __rhs.compare(__lhs) <= 0;
 }
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ inline void swap(basic_string<_CharT, _Traits, _Alloc> &__lhs,
-                            basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD inline void swap(basic_string<_CharT, _Traits, _Alloc> &__lhs,
+                           basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   __lhs.swap(__rhs);
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
 template <typename _InIterator>
-__device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
-    _InIterator __beg, _InIterator __end, const _Alloc &__a,
-    input_iterator_tag)
+AICUDA_HD _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
+   _InIterator __beg, _InIterator __end, const _Alloc &__a, void *__local,
+   input_iterator_tag)
 {
   _CharT __buf[128];
   size_type __len = 0;
@@ -1330,7 +1274,7 @@ __device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
     __buf[__len++] = *__beg;
     ++__beg;
   }
-  _Rep *__r = _Rep::_S_create(__len, size_type(0), __a);
+  _Rep *__r = _Rep::_S_create(__len, size_type(0), __a, __local);
   _M_copy(__r->_M_refdata(), __buf, __len);
 
   while (__beg != __end)
@@ -1339,7 +1283,8 @@ __device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
     {
       _Rep *__another = _Rep::_S_create(__len + 1, __len, __a);
       _M_copy(__another->_M_refdata(), __r->_M_refdata(), __len);
-      __r->_M_destroy(__a);
+      if (__r != __local)
+        __r->_M_destroy(__a);
       __r = __another;
     }
     __r->_M_refdata()[__len++] = *__beg;
@@ -1352,9 +1297,9 @@ __device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
 
 template <typename _CharT, typename _Traits, typename _Alloc>
 template <typename _InIterator>
-__device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
-    _InIterator __beg, _InIterator __end, const _Alloc &__a,
-    forward_iterator_tag)
+AICUDA_HD _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
+   _InIterator __beg, _InIterator __end, const _Alloc &__a, void *__local,
+   forward_iterator_tag)
 {
   if (aicuda::stl::__is_null_pointer(__beg) && __beg != __end)
   {
@@ -1365,7 +1310,7 @@ __device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
   const size_type __dnew =
       static_cast<size_type>(aicuda::stl::distance(__beg, __end));
 
-  _Rep *__r = _Rep::_S_create(__dnew, size_type(0), __a);
+  _Rep *__r = _Rep::_S_create(__dnew, size_type(0), __a, __local);
 
   _S_copy_chars(__r->_M_refdata(), __beg, __end);
 
@@ -1374,10 +1319,10 @@ __device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
-    size_type __n, _CharT __c, const _Alloc &__a)
+AICUDA_HD _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
+   size_type __n, _CharT __c, const _Alloc &__a, void *__local)
 {
-  _Rep *__r = _Rep::_S_create(__n, size_type(0), __a);
+  _Rep *__r = _Rep::_S_create(__n, size_type(0), __a, __local);
   if (__n)
     _M_assign(__r->_M_refdata(), __n, __c);
 
@@ -1386,77 +1331,87 @@ __device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_construct(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>::basic_string(
-    const basic_string &__str)
-    : _M_dataplus(__str._M_rep()->_M_grab(_Alloc(__str.get_allocator()),
-                                          __str.get_allocator()),
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>::basic_string(
+   const basic_string &__str)
+    : _M_dataplus(_S_grab(__str, _Alloc(__str.get_allocator()),
+                          _M_local_storage()),
                   __str.get_allocator()) {}
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>::basic_string(
-    const _Alloc &__a)
-    : _M_dataplus(_S_construct(size_type(), _CharT(), __a), __a) {}
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>::basic_string(
+   const _Alloc &__a)
+    : _M_dataplus(_S_construct(size_type(), _CharT(), __a, _M_local_storage()),
+                  __a) {}
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>::basic_string(
-    const basic_string &__str, size_type __pos, size_type __n)
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>::basic_string(
+   const basic_string &__str, size_type __pos, size_type __n)
     : _M_dataplus(
           _S_construct(__str._M_data() +
                            __str._M_check(__pos, "basic_string::basic_string"),
                        __str._M_data() + __str._M_limit(__pos, __n) + __pos,
-                       _Alloc()),
+                       _Alloc(), _M_local_storage()),
           _Alloc()) {}
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>::basic_string(
-    const basic_string &__str, size_type __pos, size_type __n,
-    const _Alloc &__a)
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>::basic_string(
+   const basic_string &__str, size_type __pos, size_type __n,
+   const _Alloc &__a)
     : _M_dataplus(
           _S_construct(__str._M_data() +
                            __str._M_check(__pos, "basic_string::basic_string"),
                        __str._M_data() + __str._M_limit(__pos, __n) + __pos,
-                       __a),
+                       __a, _M_local_storage()),
           __a) {}
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>::basic_string(
-    const _CharT *__s, size_type __n, const _Alloc &__a)
-    : _M_dataplus(_S_construct(__s, __s + __n, __a), __a) {}
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>::basic_string(
+   const _CharT *__s, size_type __n, const _Alloc &__a)
+    : _M_dataplus(_S_construct(__s, __s + __n, __a, _M_local_storage()), __a) {}
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>::basic_string(
-    const _CharT *__s, const _Alloc &__a)
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>::basic_string(
+   const _CharT *__s, const _Alloc &__a)
     : _M_dataplus(
           _S_construct(__s, __s ? __s + traits_type::length(__s) : __s + npos,
-                       __a),
+                       __a, _M_local_storage()),
           __a) {}
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>::basic_string(
-    size_type __n, _CharT __c, const _Alloc &__a)
-    : _M_dataplus(_S_construct(__n, __c, __a), __a) {}
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>::basic_string(
+   __sv_type __sv, const _Alloc &__a)
+    : _M_dataplus(_S_construct(__sv.data(), __sv.data() + __sv.size(), __a,
+                               _M_local_storage()),
+                  __a) {}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>::basic_string(
+   size_type __n, _CharT __c, const _Alloc &__a)
+    : _M_dataplus(_S_construct(__n, __c, __a, _M_local_storage()), __a) {}
 
 template <typename _CharT, typename _Traits, typename _Alloc>
 template <typename _InputIterator>
-__device__ basic_string<_CharT, _Traits, _Alloc>::basic_string(
-    _InputIterator __beg, _InputIterator __end, const _Alloc &__a)
-    : _M_dataplus(_S_construct(__beg, __end, __a), __a) {}
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>::basic_string(
+   _InputIterator __beg, _InputIterator __end, const _Alloc &__a)
+    : _M_dataplus(_S_construct(__beg, __end, __a, _M_local_storage()), __a) {}
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>
     &basic_string<_CharT, _Traits, _Alloc>::assign(const basic_string &__str)
 {
+  if (__str._M_is_local())
+    return this->assign(__str._M_data(), __str.size());
   if (_M_rep() != __str._M_rep())
   {
     const allocator_type __a = this->get_allocator();
     _CharT *__tmp = __str._M_rep()->_M_grab(__a, __str.get_allocator());
-    _M_rep()->_M_dispose(__a);
+    _M_dispose_rep(__a);
     _M_data(__tmp);
   }
   return *this;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>
     &basic_string<_CharT, _Traits, _Alloc>::assign(const _CharT *__s,
                                                    size_type __n)
 {
@@ -1477,7 +1432,7 @@ __device__ basic_string<_CharT, _Traits, _Alloc>
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>
     &basic_string<_CharT, _Traits, _Alloc>::append(size_type __n, _CharT __c)
 {
   if (__n)
@@ -1493,7 +1448,7 @@ __device__ basic_string<_CharT, _Traits, _Alloc>
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>
     &basic_string<_CharT, _Traits, _Alloc>::append(const _CharT *__s,
                                                    size_type __n)
 {
@@ -1520,7 +1475,7 @@ __device__ basic_string<_CharT, _Traits, _Alloc>
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>
     &basic_string<_CharT, _Traits, _Alloc>::append(const basic_string &__str)
 {
   const size_type __size = __str.size();
@@ -1536,7 +1491,7 @@ __device__ basic_string<_CharT, _Traits, _Alloc>
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc> &
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc> &
 basic_string<_CharT, _Traits, _Alloc>::append(const basic_string &__str,
                                               size_type __pos, size_type __n)
 {
@@ -1554,7 +1509,7 @@ basic_string<_CharT, _Traits, _Alloc>::append(const basic_string &__str,
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>
     &basic_string<_CharT, _Traits, _Alloc>::insert(size_type __pos,
                                                    const _CharT *__s,
                                                    size_type __n)
@@ -1585,7 +1540,7 @@ __device__ basic_string<_CharT, _Traits, _Alloc>
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::iterator
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::iterator
 basic_string<_CharT, _Traits, _Alloc>::erase(iterator __first,
                                              iterator __last)
 {
@@ -1602,7 +1557,7 @@ basic_string<_CharT, _Traits, _Alloc>::erase(iterator __first,
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc> &
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc> &
 basic_string<_CharT, _Traits, _Alloc>::replace(size_type __pos, size_type __n1,
                                                const _CharT *__s,
                                                size_type __n2)
@@ -1631,8 +1586,8 @@ basic_string<_CharT, _Traits, _Alloc>::replace(size_type __pos, size_type __n1,
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ void basic_string<_CharT, _Traits, _Alloc>::_Rep::_M_destroy(
-    const _Alloc &__a)
+AICUDA_HD void basic_string<_CharT, _Traits, _Alloc>::_Rep::_M_destroy(
+   const _Alloc &__a)
 {
   const size_type __size =
       sizeof(_Rep_base) + (this->_M_capacity + 1) * sizeof(_CharT);
@@ -1640,7 +1595,7 @@ __device__ void basic_string<_CharT, _Traits, _Alloc>::_Rep::_M_destroy(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ void basic_string<_CharT, _Traits, _Alloc>::_M_leak_hard()
+AICUDA_HD void basic_string<_CharT, _Traits, _Alloc>::_M_leak_hard()
 {
   if (_M_rep()->_M_is_shared())
     _M_mutate(0, 0, 0);
@@ -1648,8 +1603,8 @@ __device__ void basic_string<_CharT, _Traits, _Alloc>::_M_leak_hard()
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ void basic_string<_CharT, _Traits, _Alloc>::_M_mutate(
-    size_type __pos, size_type __len1, size_type __len2)
+AICUDA_HD void basic_string<_CharT, _Traits, _Alloc>::_M_mutate(
+   size_type __pos, size_type __len1, size_type __len2)
 {
   const size_type __old_size = this->size();
   const size_type __new_size = __old_size + __len2 - __len1;
@@ -1658,7 +1613,8 @@ __device__ void basic_string<_CharT, _Traits, _Alloc>::_M_mutate(
   if (__new_size > this->capacity() || _M_rep()->_M_is_shared())
   {
     const allocator_type __a = get_allocator();
-    _Rep *__r = _Rep::_S_create(__new_size, this->capacity(), __a);
+    _Rep *__r =
+        _Rep::_S_create(__new_size, this->capacity(), __a, _M_local_storage());
 
     if (__pos)
       _M_copy(__r->_M_refdata(), _M_data(), __pos);
@@ -1666,7 +1622,7 @@ __device__ void basic_string<_CharT, _Traits, _Alloc>::_M_mutate(
       _M_copy(__r->_M_refdata() + __pos + __len2, _M_data() + __pos + __len1,
               __how_much);
 
-    _M_rep()->_M_dispose(__a);
+    _M_dispose_rep(__a);
     _M_data(__r->_M_refdata());
   }
   else if (__how_much && __len1 != __len2)
@@ -1677,28 +1633,38 @@ __device__ void basic_string<_CharT, _Traits, _Alloc>::_M_mutate(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ void basic_string<_CharT, _Traits, _Alloc>::reserve(
-    size_type __res)
+AICUDA_HD void basic_string<_CharT, _Traits, _Alloc>::reserve(
+   size_type __res)
 {
   if (__res != this->capacity() || _M_rep()->_M_is_shared())
   {
     if (__res < this->size())
       __res = this->size();
+    if (__res <= size_type(_S_local_capacity) && _M_is_local())
+      return;
     const allocator_type __a = get_allocator();
-    _CharT *__tmp = _M_rep()->_M_clone(__a, __res - this->size());
-    _M_rep()->_M_dispose(__a);
+    _CharT *__tmp = __res <= size_type(_S_local_capacity)
+                        ? _S_grab(*this, __a, _M_local_storage())
+                        : _M_rep()->_M_clone(__a, __res - this->size());
+    _M_dispose_rep(__a);
     _M_data(__tmp);
   }
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ void basic_string<_CharT, _Traits, _Alloc>::swap(basic_string &__s)
+AICUDA_HD void basic_string<_CharT, _Traits, _Alloc>::swap(basic_string &__s)
 {
   if (_M_rep()->_M_is_leaked())
     _M_rep()->_M_set_sharable();
   if (__s._M_rep()->_M_is_leaked())
     __s._M_rep()->_M_set_sharable();
-  if (this->get_allocator() == __s.get_allocator())
+  if (_M_is_local() || __s._M_is_local())
+  {
+    const basic_string __tmp(*this);
+    *this = __s;
+    __s = __tmp;
+  }
+  else if (this->get_allocator() == __s.get_allocator())
   {
     _CharT *__tmp = _M_data();
     _M_data(__s._M_data());
@@ -1716,11 +1682,20 @@ __device__ void basic_string<_CharT, _Traits, _Alloc>::swap(basic_string &__s)
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::_Rep *
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::_Rep *
 basic_string<_CharT, _Traits, _Alloc>::_Rep::_S_create(size_type __capacity,
                                                        size_type __old_capacity,
-                                                       const _Alloc &__alloc)
+                                                       const _Alloc &__alloc,
+                                                       void *__local)
 {
+  if (__local && __capacity <= size_type(_S_local_capacity))
+  {
+    _Rep *__p = new (__local) _Rep;
+    __p->_M_capacity = _S_local_capacity;
+    __p->_M_set_sharable();
+    return __p;
+  }
+
   constexpr size_type __max_size =
       ((((size_type)(-1) - sizeof(_Rep_base)) / sizeof(_CharT)) - 1) / 4;
   if (__capacity > __max_size)
@@ -1757,8 +1732,8 @@ basic_string<_CharT, _Traits, _Alloc>::_Rep::_S_create(size_type __capacity,
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_Rep::_M_clone(
-    const _Alloc &__alloc, size_type __res)
+AICUDA_HD _CharT *basic_string<_CharT, _Traits, _Alloc>::_Rep::_M_clone(
+   const _Alloc &__alloc, size_type __res)
 {
   const size_type __requested_cap = this->_M_length + __res;
   _Rep *__r = _Rep::_S_create(__requested_cap, this->_M_capacity, __alloc);
@@ -1770,8 +1745,21 @@ __device__ _CharT *basic_string<_CharT, _Traits, _Alloc>::_Rep::_M_clone(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ void basic_string<_CharT, _Traits, _Alloc>::resize(size_type __n,
-                                                              _CharT __c)
+AICUDA_HD _CharT *basic_string<_CharT, _Traits, _Alloc>::_S_grab(
+   const basic_string &__str, const _Alloc &__a, void *__local)
+{
+  if (!__str._M_is_local() && __str.size() > size_type(_S_local_capacity))
+    return __str._M_rep()->_M_grab(__a, __str.get_allocator());
+
+  _Rep *__r = _Rep::_S_create(__str.size(), size_type(0), __a, __local);
+  _M_copy(__r->_M_refdata(), __str._M_data(), __str.size());
+  __r->_M_set_length_and_sharable(__str.size());
+  return __r->_M_refdata();
+}
+
+template <typename _CharT, typename _Traits, typename _Alloc>
+AICUDA_HD void basic_string<_CharT, _Traits, _Alloc>::resize(size_type __n,
+                                                             _CharT __c)
 {
   const size_type __size = this->size();
   _M_check_length(__size, __n, "basic_string::resize");
@@ -1783,7 +1771,7 @@ __device__ void basic_string<_CharT, _Traits, _Alloc>::resize(size_type __n,
 
 template <typename _CharT, typename _Traits, typename _Alloc>
 template <typename _InputIterator>
-__device__ basic_string<_CharT, _Traits, _Alloc> &
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc> &
 basic_string<_CharT, _Traits, _Alloc>::_M_replace_dispatch(iterator __i1,
                                                            iterator __i2,
                                                            _InputIterator __k1,
@@ -1797,7 +1785,7 @@ basic_string<_CharT, _Traits, _Alloc>::_M_replace_dispatch(iterator __i1,
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>
     &basic_string<_CharT, _Traits, _Alloc>::_M_replace_aux(size_type __pos1,
                                                            size_type __n1,
                                                            size_type __n2,
@@ -1811,7 +1799,7 @@ __device__ basic_string<_CharT, _Traits, _Alloc>
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc>
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc>
     &basic_string<_CharT, _Traits, _Alloc>::_M_replace_safe(size_type __pos1,
                                                             size_type __n1,
                                                             const _CharT *__s,
@@ -1824,8 +1812,8 @@ __device__ basic_string<_CharT, _Traits, _Alloc>
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc> operator+(
-    const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc> operator+(
+   const _CharT *__lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   ;
   typedef basic_string<_CharT, _Traits, _Alloc> __string_type;
@@ -1839,8 +1827,8 @@ __device__ basic_string<_CharT, _Traits, _Alloc> operator+(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ basic_string<_CharT, _Traits, _Alloc> operator+(
-    _CharT __lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
+AICUDA_HD basic_string<_CharT, _Traits, _Alloc> operator+(
+   _CharT __lhs, const basic_string<_CharT, _Traits, _Alloc> &__rhs)
 {
   typedef basic_string<_CharT, _Traits, _Alloc> __string_type;
   typedef typename __string_type::size_type __size_type;
@@ -1853,7 +1841,7 @@ __device__ basic_string<_CharT, _Traits, _Alloc> operator+(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::copy(_CharT *__s, size_type __n,
                                             size_type __pos) const
 {
@@ -1867,28 +1855,21 @@ basic_string<_CharT, _Traits, _Alloc>::copy(_CharT *__s, size_type __n,
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::find(const _CharT *__s, size_type __pos,
                                             size_type __n) const
 {
   const size_type __size = this->size();
+  if (__pos > __size)
+    return npos;
   const _CharT *__data = _M_data();
-
-  if (__n == 0)
-    return __pos <= __size ? __pos : npos;
-
-  if (__n <= __size)
-  {
-    for (; __pos <= __size - __n; ++__pos)
-      if (traits_type::eq(__data[__pos], __s[0]) &&
-          traits_type::compare(__data + __pos + 1, __s + 1, __n - 1) == 0)
-        return __pos;
-  }
-  return npos;
+  const _CharT *__p =
+      __str_search<_Traits>::_S_find(__data + __pos, __size - __pos, __s, __n);
+  return __p ? size_type(__p - __data) : npos;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::find(_CharT __c, size_type __pos) const
 {
   size_type __ret = npos;
@@ -1905,26 +1886,23 @@ basic_string<_CharT, _Traits, _Alloc>::find(_CharT __c, size_type __pos) const
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::rfind(const _CharT *__s, size_type __pos,
                                              size_type __n) const
 {
   const size_type __size = this->size();
-  if (__n <= __size)
-  {
-    __pos = aicuda::stl::min(size_type(__size - __n), __pos);
-    const _CharT *__data = _M_data();
-    do
-    {
-      if (traits_type::compare(__data + __pos, __s, __n) == 0)
-        return __pos;
-    } while (__pos-- > 0);
-  }
-  return npos;
+  if (__n > __size)
+    return npos;
+  // Occurrences starting at or before __pos end by __pos + __n.
+  const _CharT *__data = _M_data();
+  const size_type __len =
+      aicuda::stl::min(size_type(__size - __n), __pos) + __n;
+  const _CharT *__p = __str_search<_Traits>::_S_rfind(__data, __len, __s, __n);
+  return __p ? size_type(__p - __data) : npos;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::rfind(_CharT __c,
                                              size_type __pos) const
 {
@@ -1941,105 +1919,78 @@ basic_string<_CharT, _Traits, _Alloc>::rfind(_CharT __c,
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::find_first_of(const _CharT *__s,
                                                      size_type __pos,
                                                      size_type __n) const
 {
-  for (; __n && __pos < this->size(); ++__pos)
-  {
-    const _CharT *__p = traits_type::find(__s, __n, _M_data()[__pos]);
-    if (__p)
-      return __pos;
-  }
-  return npos;
+  if (__pos >= this->size())
+    return npos;
+  const size_t __i = __str_span<_Traits>::_S_first(
+      _M_data() + __pos, this->size() - __pos, __s, __n, true);
+  return __i == size_t(-1) ? size_type(npos) : __pos + __i;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::find_last_of(const _CharT *__s,
                                                     size_type __pos,
                                                     size_type __n) const
 {
-  size_type __size = this->size();
-  if (__size && __n)
-  {
-    if (--__size > __pos)
-      __size = __pos;
-    do
-    {
-      if (traits_type::find(__s, __n, _M_data()[__size]))
-        return __size;
-    } while (__size-- != 0);
-  }
-  return npos;
+  if (this->empty())
+    return npos;
+  const size_type __len = aicuda::stl::min(size_type(this->size() - 1), __pos) + 1;
+  const size_t __i =
+      __str_span<_Traits>::_S_last(_M_data(), __len, __s, __n, true);
+  return __i == size_t(-1) ? size_type(npos) : size_type(__i);
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::find_first_not_of(const _CharT *__s,
                                                          size_type __pos,
                                                          size_type __n) const
 {
-  for (; __pos < this->size(); ++__pos)
-    if (!traits_type::find(__s, __n, _M_data()[__pos]))
-      return __pos;
-  return npos;
+  if (__pos >= this->size())
+    return npos;
+  const size_t __i = __str_span<_Traits>::_S_first(
+      _M_data() + __pos, this->size() - __pos, __s, __n, false);
+  return __i == size_t(-1) ? size_type(npos) : __pos + __i;
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::find_first_not_of(
     _CharT __c, size_type __pos) const
 {
-  for (; __pos < this->size(); ++__pos)
-    if (!traits_type::eq(_M_data()[__pos], __c))
-      return __pos;
-  return npos;
+  return this->find_first_not_of(&__c, __pos, 1);
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::find_last_not_of(const _CharT *__s,
                                                         size_type __pos,
                                                         size_type __n) const
 {
-  size_type __size = this->size();
-  if (__size)
-  {
-    if (--__size > __pos)
-      __size = __pos;
-    do
-    {
-      if (!traits_type::find(__s, __n, _M_data()[__size]))
-        return __size;
-    } while (__size--);
-  }
-  return npos;
+  if (this->empty())
+    return npos;
+  const size_type __len = aicuda::stl::min(size_type(this->size() - 1), __pos) + 1;
+  const size_t __i =
+      __str_span<_Traits>::_S_last(_M_data(), __len, __s, __n, false);
+  return __i == size_t(-1) ? size_type(npos) : size_type(__i);
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ typename basic_string<_CharT, _Traits, _Alloc>::size_type
+AICUDA_HD typename basic_string<_CharT, _Traits, _Alloc>::size_type
 basic_string<_CharT, _Traits, _Alloc>::find_last_not_of(_CharT __c,
                                                         size_type __pos) const
 {
-  size_type __size = this->size();
-  if (__size)
-  {
-    if (--__size > __pos)
-      __size = __pos;
-    do
-    {
-      if (!traits_type::eq(_M_data()[__size], __c))
-        return __size;
-    } while (__size--);
-  }
-  return npos;
+  return this->find_last_not_of(&__c, __pos, 1);
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ int basic_string<_CharT, _Traits, _Alloc>::compare(
-    size_type __pos, size_type __n, const basic_string &__str) const
+AICUDA_HD int basic_string<_CharT, _Traits, _Alloc>::compare(
+   size_type __pos, size_type __n, const basic_string &__str) const
 {
   _M_check(__pos, "basic_string::compare");
   __n = _M_limit(__pos, __n);
@@ -2052,9 +2003,9 @@ __device__ int basic_string<_CharT, _Traits, _Alloc>::compare(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ int basic_string<_CharT, _Traits, _Alloc>::compare(
-    size_type __pos1, size_type __n1, const basic_string &__str,
-    size_type __pos2, size_type __n2) const
+AICUDA_HD int basic_string<_CharT, _Traits, _Alloc>::compare(
+   size_type __pos1, size_type __n1, const basic_string &__str,
+   size_type __pos2, size_type __n2) const
 {
   _M_check(__pos1, "basic_string::compare");
   __str._M_check(__pos2, "basic_string::compare");
@@ -2069,8 +2020,8 @@ __device__ int basic_string<_CharT, _Traits, _Alloc>::compare(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ int basic_string<_CharT, _Traits, _Alloc>::compare(
-    const _CharT *__s) const
+AICUDA_HD int basic_string<_CharT, _Traits, _Alloc>::compare(
+   const _CharT *__s) const
 {
   const size_type __size = this->size();
   const size_type __osize = traits_type::length(__s);
@@ -2082,8 +2033,8 @@ __device__ int basic_string<_CharT, _Traits, _Alloc>::compare(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ int basic_string<_CharT, _Traits, _Alloc>::compare(
-    size_type __pos, size_type __n1, const _CharT *__s) const
+AICUDA_HD int basic_string<_CharT, _Traits, _Alloc>::compare(
+   size_type __pos, size_type __n1, const _CharT *__s) const
 {
   _M_check(__pos, "basic_string::compare");
   __n1 = _M_limit(__pos, __n1);
@@ -2096,8 +2047,8 @@ __device__ int basic_string<_CharT, _Traits, _Alloc>::compare(
 }
 
 template <typename _CharT, typename _Traits, typename _Alloc>
-__device__ int basic_string<_CharT, _Traits, _Alloc>::compare(
-    size_type __pos, size_type __n1, const _CharT *__s, size_type __n2) const
+AICUDA_HD int basic_string<_CharT, _Traits, _Alloc>::compare(
+   size_type __pos, size_type __n1, const _CharT *__s, size_type __n2) const
 {
   _M_check(__pos, "basic_string::compare");
   __n1 = _M_limit(__pos, __n1);
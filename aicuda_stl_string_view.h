@@ -0,0 +1,497 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_STRING_VIEW_H_
+#define _AICUDA_STL_STRING_VIEW_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_char_traits.h>
+#include <aicuda_stl_function.h>
+#include <aicuda_stl_iterator.h>
+#include <assert.h>
+#include <stdio.h>
+
+namespace aicuda
+{
+namespace stl
+{
+
+// A non-owning, read-only window onto a character sequence.  Copying a view
+// never allocates, and substr/remove_prefix/remove_suffix only move the
+// window, so a buffer can be tokenized without creating a _Rep per token.
+// The viewed characters must outlive the view.
+template <typename _CharT, typename _Traits = aicuda::stl::char_traits<_CharT>>
+class basic_string_view
+{
+public:
+  typedef _Traits traits_type;
+  typedef _CharT value_type;
+  typedef const _CharT *pointer;
+  typedef const _CharT *const_pointer;
+  typedef const _CharT &reference;
+  typedef const _CharT &const_reference;
+  typedef const _CharT *const_iterator;
+  typedef const_iterator iterator;
+  typedef aicuda::stl::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef const_reverse_iterator reverse_iterator;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+  enum
+  {
+    npos = static_cast<size_type>(-1)
+  };
+
+  AICUDA_HD basic_string_view() : _M_str(0), _M_len(0) {}
+
+  AICUDA_HD basic_string_view(const _CharT *__s)
+      : _M_str(__s), _M_len(traits_type::length(__s)) {}
+
+  AICUDA_HD basic_string_view(const _CharT *__s, size_type __n)
+      : _M_str(__s), _M_len(__n) {}
+
+  AICUDA_HD const_iterator begin() const { return _M_str; }
+  AICUDA_HD const_iterator end() const { return _M_str + _M_len; }
+  AICUDA_HD const_iterator cbegin() const { return _M_str; }
+  AICUDA_HD const_iterator cend() const { return _M_str + _M_len; }
+
+  AICUDA_HD const_reverse_iterator rbegin() const
+  {
+    return const_reverse_iterator(this->end());
+  }
+  AICUDA_HD const_reverse_iterator rend() const
+  {
+    return const_reverse_iterator(this->begin());
+  }
+
+  AICUDA_HD size_type size() const { return _M_len; }
+  AICUDA_HD size_type length() const { return _M_len; }
+  AICUDA_HD size_type max_size() const
+  {
+    return (size_type(-1) - 1) / sizeof(_CharT);
+  }
+  AICUDA_HD bool empty() const { return _M_len == 0; }
+
+  AICUDA_HD const_reference operator[](size_type __pos) const
+  {
+    return _M_str[__pos];
+  }
+  AICUDA_HD const_reference at(size_type __pos) const
+  {
+    if (__pos >= _M_len)
+    {
+      printf("basic_string_view:: out_of_range at %ld\n", __pos);
+      assert(1 < 0);
+    }
+    return _M_str[__pos];
+  }
+  AICUDA_HD const_reference front() const { return _M_str[0]; }
+  AICUDA_HD const_reference back() const { return _M_str[_M_len - 1]; }
+  AICUDA_HD const_pointer data() const { return _M_str; }
+
+  AICUDA_HD void remove_prefix(size_type __n)
+  {
+    _M_str += __n;
+    _M_len -= __n;
+  }
+  AICUDA_HD void remove_suffix(size_type __n) { _M_len -= __n; }
+
+  AICUDA_HD void swap(basic_string_view &__sv)
+  {
+    aicuda::stl::swap(_M_str, __sv._M_str);
+    aicuda::stl::swap(_M_len, __sv._M_len);
+  }
+
+  AICUDA_HD size_type copy(_CharT *__s, size_type __n,
+                           size_type __pos = 0) const
+  {
+    _M_check(__pos, "basic_string_view::copy");
+    __n = _M_limit(__pos, __n);
+    if (__n)
+      traits_type::copy(__s, _M_str + __pos, __n);
+    return __n;
+  }
+
+  AICUDA_HD basic_string_view substr(size_type __pos = 0,
+                                     size_type __n = npos) const
+  {
+    _M_check(__pos, "basic_string_view::substr");
+    return basic_string_view(_M_str + __pos, _M_limit(__pos, __n));
+  }
+
+  AICUDA_HD int compare(basic_string_view __sv) const
+  {
+    const size_type __len = aicuda::stl::min(_M_len, __sv._M_len);
+    int __r = __len ? traits_type::compare(_M_str, __sv._M_str, __len) : 0;
+    if (!__r)
+      __r = _S_compare(_M_len, __sv._M_len);
+    return __r;
+  }
+  AICUDA_HD int compare(size_type __pos1, size_type __n1,
+                        basic_string_view __sv) const
+  {
+    return this->substr(__pos1, __n1).compare(__sv);
+  }
+  AICUDA_HD int compare(size_type __pos1, size_type __n1,
+                        basic_string_view __sv, size_type __pos2,
+                        size_type __n2) const
+  {
+    return this->substr(__pos1, __n1).compare(__sv.substr(__pos2, __n2));
+  }
+  AICUDA_HD int compare(const _CharT *__s) const
+  {
+    return this->compare(basic_string_view(__s));
+  }
+  AICUDA_HD int compare(size_type __pos1, size_type __n1,
+                        const _CharT *__s) const
+  {
+    return this->substr(__pos1, __n1).compare(basic_string_view(__s));
+  }
+  AICUDA_HD int compare(size_type __pos1, size_type __n1, const _CharT *__s,
+                        size_type __n2) const
+  {
+    return this->substr(__pos1, __n1).compare(basic_string_view(__s, __n2));
+  }
+
+  AICUDA_HD bool starts_with(basic_string_view __sv) const
+  {
+    return _M_len >= __sv._M_len &&
+           (!__sv._M_len ||
+            traits_type::compare(_M_str, __sv._M_str, __sv._M_len) == 0);
+  }
+  AICUDA_HD bool starts_with(_CharT __c) const
+  {
+    return _M_len && traits_type::eq(_M_str[0], __c);
+  }
+  AICUDA_HD bool ends_with(basic_string_view __sv) const
+  {
+    return _M_len >= __sv._M_len &&
+           (!__sv._M_len ||
+            traits_type::compare(_M_str + _M_len - __sv._M_len, __sv._M_str,
+                                 __sv._M_len) == 0);
+  }
+  AICUDA_HD bool ends_with(_CharT __c) const
+  {
+    return _M_len && traits_type::eq(_M_str[_M_len - 1], __c);
+  }
+
+  AICUDA_HD size_type find(basic_string_view __sv, size_type __pos = 0) const
+  {
+    return this->find(__sv._M_str, __pos, __sv._M_len);
+  }
+  AICUDA_HD size_type find(const _CharT *__s, size_type __pos,
+                           size_type __n) const;
+  AICUDA_HD size_type find(const _CharT *__s, size_type __pos = 0) const
+  {
+    return this->find(__s, __pos, traits_type::length(__s));
+  }
+  AICUDA_HD size_type find(_CharT __c, size_type __pos = 0) const
+  {
+    if (__pos >= _M_len)
+      return npos;
+    const _CharT *__p = traits_type::find(_M_str + __pos, _M_len - __pos, __c);
+    return __p ? size_type(__p - _M_str) : size_type(npos);
+  }
+
+  AICUDA_HD size_type rfind(basic_string_view __sv,
+                            size_type __pos = npos) const
+  {
+    return this->rfind(__sv._M_str, __pos, __sv._M_len);
+  }
+  AICUDA_HD size_type rfind(const _CharT *__s, size_type __pos,
+                            size_type __n) const;
+  AICUDA_HD size_type rfind(const _CharT *__s, size_type __pos = npos) const
+  {
+    return this->rfind(__s, __pos, traits_type::length(__s));
+  }
+  AICUDA_HD size_type rfind(_CharT __c, size_type __pos = npos) const
+  {
+    return this->find_last_of(&__c, __pos, 1);
+  }
+
+  AICUDA_HD size_type find_first_of(basic_string_view __sv,
+                                    size_type __pos = 0) const
+  {
+    return this->find_first_of(__sv._M_str, __pos, __sv._M_len);
+  }
+  AICUDA_HD size_type find_first_of(const _CharT *__s, size_type __pos,
+                                    size_type __n) const;
+  AICUDA_HD size_type find_first_of(const _CharT *__s,
+                                    size_type __pos = 0) const
+  {
+    return this->find_first_of(__s, __pos, traits_type::length(__s));
+  }
+  AICUDA_HD size_type find_first_of(_CharT __c, size_type __pos = 0) const
+  {
+    return this->find(__c, __pos);
+  }
+
+  AICUDA_HD size_type find_last_of(basic_string_view __sv,
+                                   size_type __pos = npos) const
+  {
+    return this->find_last_of(__sv._M_str, __pos, __sv._M_len);
+  }
+  AICUDA_HD size_type find_last_of(const _CharT *__s, size_type __pos,
+                                   size_type __n) const;
+  AICUDA_HD size_type find_last_of(const _CharT *__s,
+                                   size_type __pos = npos) const
+  {
+    return this->find_last_of(__s, __pos, traits_type::length(__s));
+  }
+  AICUDA_HD size_type find_last_of(_CharT __c, size_type __pos = npos) const
+  {
+    return this->rfind(__c, __pos);
+  }
+
+  AICUDA_HD size_type find_first_not_of(basic_string_view __sv,
+                                        size_type __pos = 0) const
+  {
+    return this->find_first_not_of(__sv._M_str, __pos, __sv._M_len);
+  }
+  AICUDA_HD size_type find_first_not_of(const _CharT *__s, size_type __pos,
+                                        size_type __n) const;
+  AICUDA_HD size_type find_first_not_of(const _CharT *__s,
+                                        size_type __pos = 0) const
+  {
+    return this->find_first_not_of(__s, __pos, traits_type::length(__s));
+  }
+  AICUDA_HD size_type find_first_not_of(_CharT __c, size_type __pos = 0) const
+  {
+    return this->find_first_not_of(&__c, __pos, 1);
+  }
+
+  AICUDA_HD size_type find_last_not_of(basic_string_view __sv,
+                                       size_type __pos = npos) const
+  {
+    return this->find_last_not_of(__sv._M_str, __pos, __sv._M_len);
+  }
+  AICUDA_HD size_type find_last_not_of(const _CharT *__s, size_type __pos,
+                                       size_type __n) const;
+  AICUDA_HD size_type find_last_not_of(const _CharT *__s,
+                                       size_type __pos = npos) const
+  {
+    return this->find_last_not_of(__s, __pos, traits_type::length(__s));
+  }
+  AICUDA_HD size_type find_last_not_of(_CharT __c,
+                                       size_type __pos = npos) const
+  {
+    return this->find_last_not_of(&__c, __pos, 1);
+  }
+
+private:
+  AICUDA_HD size_type _M_check(size_type __pos, const char *__s) const
+  {
+    if (__pos > _M_len)
+    {
+      printf("__throw_out_of_range : %s\n", __s);
+      assert(1 < 0);
+    }
+    return __pos;
+  }
+
+  AICUDA_HD size_type _M_limit(size_type __pos, size_type __off) const
+  {
+    const bool __testoff = __off < _M_len - __pos;
+    return __testoff ? __off : _M_len - __pos;
+  }
+
+  AICUDA_HD static int _S_compare(size_type __n1, size_type __n2)
+  {
+    const difference_type __d = difference_type(__n1 - __n2);
+
+    if (__d > 2147483647)
+      return 2147483647;
+    else if (__d < -2147483648)
+      return -2147483648;
+    else
+      return int(__d);
+  }
+
+  const _CharT *_M_str;
+  size_type _M_len;
+};
+
+typedef basic_string_view<char> string_view;
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD typename basic_string_view<_CharT, _Traits>::size_type
+basic_string_view<_CharT, _Traits>::find(const _CharT *__s, size_type __pos,
+                                         size_type __n) const
+{
+  if (__pos > _M_len)
+    return npos;
+  const _CharT *__p =
+      __str_search<_Traits>::_S_find(_M_str + __pos, _M_len - __pos, __s, __n);
+  return __p ? size_type(__p - _M_str) : size_type(npos);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD typename basic_string_view<_CharT, _Traits>::size_type
+basic_string_view<_CharT, _Traits>::rfind(const _CharT *__s, size_type __pos,
+                                          size_type __n) const
+{
+  if (__n > _M_len)
+    return npos;
+  // Occurrences starting at or before __pos end by __pos + __n.
+  const size_type __len = aicuda::stl::min(size_type(_M_len - __n), __pos) + __n;
+  const _CharT *__p = __str_search<_Traits>::_S_rfind(_M_str, __len, __s, __n);
+  return __p ? size_type(__p - _M_str) : size_type(npos);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD typename basic_string_view<_CharT, _Traits>::size_type
+basic_string_view<_CharT, _Traits>::find_first_of(const _CharT *__s,
+                                                  size_type __pos,
+                                                  size_type __n) const
+{
+  if (__pos >= _M_len)
+    return npos;
+  const size_t __i = __str_span<_Traits>::_S_first(_M_str + __pos,
+                                                   _M_len - __pos, __s, __n,
+                                                   true);
+  return __i == size_t(-1) ? size_type(npos) : __pos + __i;
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD typename basic_string_view<_CharT, _Traits>::size_type
+basic_string_view<_CharT, _Traits>::find_last_of(const _CharT *__s,
+                                                 size_type __pos,
+                                                 size_type __n) const
+{
+  if (_M_len == 0)
+    return npos;
+  const size_type __len = aicuda::stl::min(size_type(_M_len - 1), __pos) + 1;
+  const size_t __i = __str_span<_Traits>::_S_last(_M_str, __len, __s, __n, true);
+  return __i == size_t(-1) ? size_type(npos) : size_type(__i);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD typename basic_string_view<_CharT, _Traits>::size_type
+basic_string_view<_CharT, _Traits>::find_first_not_of(const _CharT *__s,
+                                                      size_type __pos,
+                                                      size_type __n) const
+{
+  if (__pos >= _M_len)
+    return npos;
+  const size_t __i = __str_span<_Traits>::_S_first(_M_str + __pos,
+                                                   _M_len - __pos, __s, __n,
+                                                   false);
+  return __i == size_t(-1) ? size_type(npos) : __pos + __i;
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD typename basic_string_view<_CharT, _Traits>::size_type
+basic_string_view<_CharT, _Traits>::find_last_not_of(const _CharT *__s,
+                                                     size_type __pos,
+                                                     size_type __n) const
+{
+  if (_M_len == 0)
+    return npos;
+  const size_type __len = aicuda::stl::min(size_type(_M_len - 1), __pos) + 1;
+  const size_t __i =
+      __str_span<_Traits>::_S_last(_M_str, __len, __s, __n, false);
+  return __i == size_t(-1) ? size_type(npos) : size_type(__i);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator==(basic_string_view<_CharT, _Traits> __lhs,
+                                 basic_string_view<_CharT, _Traits> __rhs)
+{
+  return __lhs.size() == __rhs.size() && __lhs.compare(__rhs) == 0;
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator==(basic_string_view<_CharT, _Traits> __lhs,
+                                 const _CharT *__rhs)
+{
+  return __lhs == basic_string_view<_CharT, _Traits>(__rhs);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator==(const _CharT *__lhs,
+                                 basic_string_view<_CharT, _Traits> __rhs)
+{
+  return basic_string_view<_CharT, _Traits>(__lhs) == __rhs;
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator!=(basic_string_view<_CharT, _Traits> __lhs,
+                                 basic_string_view<_CharT, _Traits> __rhs)
+{
+  return !(__lhs == __rhs);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator!=(basic_string_view<_CharT, _Traits> __lhs,
+                                 const _CharT *__rhs)
+{
+  return !(__lhs == __rhs);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator!=(const _CharT *__lhs,
+                                 basic_string_view<_CharT, _Traits> __rhs)
+{
+  return !(__lhs == __rhs);
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator<(basic_string_view<_CharT, _Traits> __lhs,
+                                basic_string_view<_CharT, _Traits> __rhs)
+{
+  return __lhs.compare(__rhs) < 0;
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator>(basic_string_view<_CharT, _Traits> __lhs,
+                                basic_string_view<_CharT, _Traits> __rhs)
+{
+  return __lhs.compare(__rhs) > 0;
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator<=(basic_string_view<_CharT, _Traits> __lhs,
+                                 basic_string_view<_CharT, _Traits> __rhs)
+{
+  return __lhs.compare(__rhs) <= 0;
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline bool operator>=(basic_string_view<_CharT, _Traits> __lhs,
+                                 basic_string_view<_CharT, _Traits> __rhs)
+{
+  return __lhs.compare(__rhs) >= 0;
+}
+
+template <typename _CharT, typename _Traits>
+AICUDA_HD inline void swap(basic_string_view<_CharT, _Traits> &__x,
+                           basic_string_view<_CharT, _Traits> &__y)
+{
+  __x.swap(__y);
+}
+
+} // namespace stl
+} // namespace aicuda
+
+#endif /* _AICUDA_STL_STRING_VIEW_H_ */
@@ -25,6 +25,7 @@
 #ifndef _AICUDA_STL_TREE_H_
 #define _AICUDA_STL_TREE_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <aicuda_stl_allocator.h>
 #include <aicuda_stl_pair.h>
 #include <aicuda_stl_function.h>
@@ -52,7 +53,7 @@ public:
   _Base_ptr _M_left;
   _Base_ptr _M_right;
 
-  __device__ static _Base_ptr
+  AICUDA_HD static _Base_ptr
   _S_minimum(_Base_ptr __x)
   {
     while (__x->_M_left != 0)
@@ -60,7 +61,7 @@ public:
     return __x;
   }
 
-  __device__ static _Const_Base_ptr
+  AICUDA_HD static _Const_Base_ptr
   _S_minimum(_Const_Base_ptr __x)
   {
     while (__x->_M_left != 0)
@@ -68,7 +69,7 @@ public:
     return __x;
   }
 
-  __device__ static _Base_ptr
+  AICUDA_HD static _Base_ptr
   _S_maximum(_Base_ptr __x)
   {
     while (__x->_M_right != 0)
@@ -76,7 +77,7 @@ public:
     return __x;
   }
 
-  __device__ static _Const_Base_ptr
+  AICUDA_HD static _Const_Base_ptr
   _S_maximum(_Const_Base_ptr __x)
   {
     while (__x->_M_right != 0)
@@ -84,31 +85,31 @@ public:
     return __x;
   }
 
-  __device__ static _Rb_tree_node_base *
+  AICUDA_HD static _Rb_tree_node_base *
   _Rb_tree_increment(_Rb_tree_node_base *__x)
   {
     return local_Rb_tree_increment(__x);
   }
 
-  __device__ static const _Rb_tree_node_base *
+  AICUDA_HD static const _Rb_tree_node_base *
   _Rb_tree_increment(const _Rb_tree_node_base *__x)
   {
     return local_Rb_tree_increment(const_cast<_Rb_tree_node_base *>(__x));
   }
 
-  __device__ static _Rb_tree_node_base *
+  AICUDA_HD static _Rb_tree_node_base *
   _Rb_tree_decrement(_Rb_tree_node_base *__x)
   {
     return local_Rb_tree_decrement(__x);
   }
 
-  __device__ static const _Rb_tree_node_base *
+  AICUDA_HD static const _Rb_tree_node_base *
   _Rb_tree_decrement(const _Rb_tree_node_base *__x)
   {
     return local_Rb_tree_decrement(const_cast<_Rb_tree_node_base *>(__x));
   }
 
-  __device__ static unsigned int
+  AICUDA_HD static unsigned int
   _Rb_tree_black_count(const _Rb_tree_node_base *__node,
                        const _Rb_tree_node_base *__root)
   {
@@ -126,7 +127,7 @@ public:
     return __sum;
   }
 
-  __device__ static void
+  AICUDA_HD static void
   _Rb_tree_insert_and_rebalance(const bool __insert_left,
                                 _Rb_tree_node_base *__x,
                                 _Rb_tree_node_base *__p,
@@ -216,7 +217,7 @@ public:
     __root->_M_color = _S_black;
   }
 
-  __device__ static _Rb_tree_node_base *
+  AICUDA_HD static _Rb_tree_node_base *
   _Rb_tree_rebalance_for_erase(_Rb_tree_node_base *const __z,
                                _Rb_tree_node_base &__header)
   {
@@ -377,7 +378,7 @@ public:
   }
 
 private:
-  __device__ static _Rb_tree_node_base *
+  AICUDA_HD static _Rb_tree_node_base *
   local_Rb_tree_increment(_Rb_tree_node_base *__x)
   {
     if (__x->_M_right != 0)
@@ -400,7 +401,7 @@ private:
     return __x;
   }
 
-  __device__ static _Rb_tree_node_base *
+  AICUDA_HD static _Rb_tree_node_base *
   local_Rb_tree_decrement(_Rb_tree_node_base *__x)
   {
     if (__x->_M_color == _S_red && __x->_M_parent->_M_parent == __x)
@@ -425,7 +426,7 @@ private:
     return __x;
   }
 
-  __device__ static void
+  AICUDA_HD static void
   local_Rb_tree_rotate_right(_Rb_tree_node_base *const __x,
                              _Rb_tree_node_base *&__root)
   {
@@ -446,7 +447,7 @@ private:
     __x->_M_parent = __y;
   }
 
-  __device__ static void
+  AICUDA_HD static void
   local_Rb_tree_rotate_left(_Rb_tree_node_base *const __x,
                             _Rb_tree_node_base *&__root)
   {
@@ -490,32 +491,32 @@ struct _Rb_tree_iterator
   typedef _Rb_tree_node_base::_Base_ptr _Base_ptr;
   typedef _Rb_tree_node<_Tp> *_Link_type;
 
-  __device__ _Rb_tree_iterator()
+  AICUDA_HD _Rb_tree_iterator()
       : _M_node() {}
 
-  __device__ explicit _Rb_tree_iterator(_Link_type __x)
+  AICUDA_HD explicit _Rb_tree_iterator(_Link_type __x)
       : _M_node(__x) {}
 
-  __device__ reference
+  AICUDA_HD reference
   operator*() const
   {
     return static_cast<_Link_type>(_M_node)->_M_value_field;
   }
 
-  __device__ pointer
+  AICUDA_HD pointer
   operator->() const
   {
     return &static_cast<_Link_type>(_M_node)->_M_value_field;
   }
 
-  __device__ _Self &
+  AICUDA_HD _Self &
   operator++()
   {
     _M_node = _Rb_tree_node_base::_Rb_tree_increment(_M_node);
     return *this;
   }
 
-  __device__ _Self
+  AICUDA_HD _Self
   operator++(int)
   {
     _Self __tmp = *this;
@@ -523,14 +524,14 @@ struct _Rb_tree_iterator
     return __tmp;
   }
 
-  __device__ _Self &
+  AICUDA_HD _Self &
   operator--()
   {
     _M_node = _Rb_tree_node_base::_Rb_tree_decrement(_M_node);
     return *this;
   }
 
-  __device__ _Self
+  AICUDA_HD _Self
   operator--(int)
   {
     _Self __tmp = *this;
@@ -538,13 +539,13 @@ struct _Rb_tree_iterator
     return __tmp;
   }
 
-  __device__ bool
+  AICUDA_HD bool
   operator==(const _Self &__x) const
   {
     return _M_node == __x._M_node;
   }
 
-  __device__ bool
+  AICUDA_HD bool
   operator!=(const _Self &__x) const
   {
     return _M_node != __x._M_node;
@@ -569,35 +570,35 @@ struct _Rb_tree_const_iterator
   typedef _Rb_tree_node_base::_Const_Base_ptr _Base_ptr;
   typedef const _Rb_tree_node<_Tp> *_Link_type;
 
-  __device__ _Rb_tree_const_iterator()
+  AICUDA_HD _Rb_tree_const_iterator()
       : _M_node() {}
 
-  __device__ explicit _Rb_tree_const_iterator(_Link_type __x)
+  AICUDA_HD explicit _Rb_tree_const_iterator(_Link_type __x)
       : _M_node(__x) {}
 
-  __device__ _Rb_tree_const_iterator(const iterator &__it)
+  AICUDA_HD _Rb_tree_const_iterator(const iterator &__it)
       : _M_node(__it._M_node) {}
 
-  __device__ reference
+  AICUDA_HD reference
   operator*() const
   {
     return static_cast<_Link_type>(_M_node)->_M_value_field;
   }
 
-  __device__ pointer
+  AICUDA_HD pointer
   operator->() const
   {
     return &static_cast<_Link_type>(_M_node)->_M_value_field;
   }
 
-  __device__ _Self &
+  AICUDA_HD _Self &
   operator++()
   {
     _M_node = _Rb_tree_node_base::_Rb_tree_increment(_M_node);
     return *this;
   }
 
-  __device__ _Self
+  AICUDA_HD _Self
   operator++(int)
   {
     _Self __tmp = *this;
@@ -605,14 +606,14 @@ struct _Rb_tree_const_iterator
     return __tmp;
   }
 
-  __device__ _Self &
+  AICUDA_HD _Self &
   operator--()
   {
     _M_node = _Rb_tree_node_base::_Rb_tree_decrement(_M_node);
     return *this;
   }
 
-  __device__ _Self
+  AICUDA_HD _Self
   operator--(int)
   {
     _Self __tmp = *this;
@@ -620,13 +621,13 @@ struct _Rb_tree_const_iterator
     return __tmp;
   }
 
-  __device__ bool
+  AICUDA_HD bool
   operator==(const _Self &__x) const
   {
     return _M_node == __x._M_node;
   }
 
-  __device__ bool
+  AICUDA_HD bool
   operator!=(const _Self &__x) const
   {
     return _M_node != __x._M_node;
@@ -636,7 +637,7 @@ struct _Rb_tree_const_iterator
 };
 
 template <typename _Val>
-__device__ inline bool
+AICUDA_HD inline bool
 operator==(const _Rb_tree_iterator<_Val> &__x,
            const _Rb_tree_const_iterator<_Val> &__y)
 {
@@ -644,13 +645,29 @@ operator==(const _Rb_tree_iterator<_Val> &__x,
 }
 
 template <typename _Val>
-__device__ inline bool
+AICUDA_HD inline bool
 operator!=(const _Rb_tree_iterator<_Val> &__x,
            const _Rb_tree_const_iterator<_Val> &__y)
 {
   return __x._M_node != __y._M_node;
 }
 
+// Yields _Res only when _Compare declares is_transparent; the lookup key
+// type _Kt keeps the substitution dependent so the overload drops out
+// quietly for ordinary comparators.
+template <typename _Compare, typename _Kt, typename _Res, typename = void>
+struct __if_transparent
+{
+};
+
+template <typename _Compare, typename _Kt, typename _Res>
+struct __if_transparent<
+    _Compare, _Kt, _Res,
+    typename __void_type<typename _Compare::is_transparent>::__type>
+{
+  typedef _Res __type;
+};
+
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc = aicuda::stl::allocator<_Val>>
 class _Rb_tree
@@ -675,38 +692,38 @@ public:
   typedef ptrdiff_t difference_type;
   typedef _Alloc allocator_type;
 
-  __device__ _Node_allocator &
+  AICUDA_HD _Node_allocator &
   _M_get_Node_allocator()
   {
     return *static_cast<_Node_allocator *>(&this->_M_impl);
   }
 
-  __device__ const _Node_allocator &
+  AICUDA_HD const _Node_allocator &
   _M_get_Node_allocator() const
   {
     return *static_cast<const _Node_allocator *>(&this->_M_impl);
   }
 
-  __device__ allocator_type
+  AICUDA_HD allocator_type
   get_allocator() const
   {
     return allocator_type(_M_get_Node_allocator());
   }
 
 protected:
-  __device__ _Link_type
+  AICUDA_HD _Link_type
   _M_get_node()
   {
     return _M_impl._Node_allocator::allocate(1);
   }
 
-  __device__ void
+  AICUDA_HD void
   _M_put_node(_Link_type __p)
   {
     _M_impl._Node_allocator::deallocate(__p, 1);
   }
 
-  __device__ _Link_type
+  AICUDA_HD _Link_type
   _M_create_node(const value_type &__x)
   {
     _Link_type __tmp = _M_get_node();
@@ -714,14 +731,14 @@ protected:
     return __tmp;
   }
 
-  __device__ void
+  AICUDA_HD void
   _M_destroy_node(_Link_type __p)
   {
     get_allocator().destroy(&__p->_M_value_field);
     _M_put_node(__p);
   }
 
-  __device__ _Link_type
+  AICUDA_HD _Link_type
   _M_clone_node(_Const_Link_type __x)
   {
     _Link_type __tmp = _M_create_node(__x->_M_value_field);
@@ -740,14 +757,14 @@ protected:
     _Rb_tree_node_base _M_header;
     size_type _M_node_count;
 
-    __device__ _Rb_tree_impl()
+    AICUDA_HD _Rb_tree_impl()
         : _Node_allocator(), _M_key_compare(), _M_header(),
           _M_node_count(0)
     {
       _M_initialize();
     }
 
-    __device__ _Rb_tree_impl(const _Key_compare &__comp, const _Node_allocator &__a)
+    AICUDA_HD _Rb_tree_impl(const _Key_compare &__comp, const _Node_allocator &__a)
         : _Node_allocator(__a), _M_key_compare(__comp), _M_header(),
           _M_node_count(0)
     {
@@ -755,7 +772,7 @@ protected:
     }
 
   private:
-    __device__ void
+    AICUDA_HD void
     _M_initialize()
     {
       this->_M_header._M_color = _S_red;
@@ -768,133 +785,133 @@ protected:
   _Rb_tree_impl<_Compare> _M_impl;
 
 protected:
-  __device__ _Base_ptr &
+  AICUDA_HD _Base_ptr &
   _M_root()
   {
     return this->_M_impl._M_header._M_parent;
   }
 
-  __device__ _Const_Base_ptr
+  AICUDA_HD _Const_Base_ptr
   _M_root() const
   {
     return this->_M_impl._M_header._M_parent;
   }
 
-  __device__ _Base_ptr &
+  AICUDA_HD _Base_ptr &
   _M_leftmost()
   {
     return this->_M_impl._M_header._M_left;
   }
 
-  __device__ _Const_Base_ptr
+  AICUDA_HD _Const_Base_ptr
   _M_leftmost() const
   {
     return this->_M_impl._M_header._M_left;
   }
 
-  __device__ _Base_ptr &
+  AICUDA_HD _Base_ptr &
   _M_rightmost()
   {
     return this->_M_impl._M_header._M_right;
   }
 
-  __device__ _Const_Base_ptr
+  AICUDA_HD _Const_Base_ptr
   _M_rightmost() const
   {
     return this->_M_impl._M_header._M_right;
   }
 
-  __device__ _Link_type
+  AICUDA_HD _Link_type
   _M_begin()
   {
     return static_cast<_Link_type>(this->_M_impl._M_header._M_parent);
   }
 
-  __device__ _Const_Link_type
+  AICUDA_HD _Const_Link_type
   _M_begin() const
   {
     return static_cast<_Const_Link_type>(this->_M_impl._M_header._M_parent);
   }
 
-  __device__ _Link_type
+  AICUDA_HD _Link_type
   _M_end()
   {
     return static_cast<_Link_type>(&this->_M_impl._M_header);
   }
 
-  __device__ _Const_Link_type
+  AICUDA_HD _Const_Link_type
   _M_end() const
   {
     return static_cast<_Const_Link_type>(&this->_M_impl._M_header);
   }
 
-  __device__ static const_reference
+  AICUDA_HD static const_reference
   _S_value(_Const_Link_type __x)
   {
     return __x->_M_value_field;
   }
 
-  __device__ static const _Key &
+  AICUDA_HD static const _Key &
   _S_key(_Const_Link_type __x)
   {
     return _KeyOfValue()(_S_value(__x));
   }
 
-  __device__ static _Link_type
+  AICUDA_HD static _Link_type
   _S_left(_Base_ptr __x)
   {
     return static_cast<_Link_type>(__x->_M_left);
   }
 
-  __device__ static _Const_Link_type
+  AICUDA_HD static _Const_Link_type
   _S_left(_Const_Base_ptr __x)
   {
     return static_cast<_Const_Link_type>(__x->_M_left);
   }
 
-  __device__ static _Link_type
+  AICUDA_HD static _Link_type
   _S_right(_Base_ptr __x)
   {
     return static_cast<_Link_type>(__x->_M_right);
   }
 
-  __device__ static _Const_Link_type
+  AICUDA_HD static _Const_Link_type
   _S_right(_Const_Base_ptr __x)
   {
     return static_cast<_Const_Link_type>(__x->_M_right);
   }
 
-  __device__ static const_reference
+  AICUDA_HD static const_reference
   _S_value(_Const_Base_ptr __x)
   {
     return static_cast<_Const_Link_type>(__x)->_M_value_field;
   }
 
-  __device__ static const _Key &
+  AICUDA_HD static const _Key &
   _S_key(_Const_Base_ptr __x)
   {
     return _KeyOfValue()(_S_value(__x));
   }
 
-  __device__ static _Base_ptr
+  AICUDA_HD static _Base_ptr
   _S_minimum(_Base_ptr __x)
   {
     return _Rb_tree_node_base::_S_minimum(__x);
   }
 
-  __device__ static _Const_Base_ptr
+  AICUDA_HD static _Const_Base_ptr
   _S_minimum(_Const_Base_ptr __x)
   {
     return _Rb_tree_node_base::_S_minimum(__x);
   }
 
-  __device__ static _Base_ptr
+  AICUDA_HD static _Base_ptr
   _S_maximum(_Base_ptr __x)
   {
     return _Rb_tree_node_base::_S_maximum(__x);
   }
 
-  __device__ static _Const_Base_ptr
+  AICUDA_HD static _Const_Base_ptr
   _S_maximum(_Const_Base_ptr __x)
   {
     return _Rb_tree_node_base::_S_maximum(__x);
@@ -908,46 +925,55 @@ public:
   typedef aicuda::stl::reverse_iterator<const_iterator> const_reverse_iterator;
 
 private:
-  __device__ iterator
+  AICUDA_HD iterator
   _M_insert_(_Const_Base_ptr __x, _Const_Base_ptr __y,
              const value_type &__v);
 
-  __device__ iterator
+  AICUDA_HD iterator
   _M_insert_lower(_Base_ptr __x, _Base_ptr __y, const value_type &__v);
 
-  __device__ iterator
+  AICUDA_HD iterator
   _M_insert_equal_lower(const value_type &__x);
 
-  __device__ _Link_type
+  AICUDA_HD _Link_type
   _M_copy(_Const_Link_type __x, _Link_type __p);
 
-  __device__ void
+  template <typename _InputIterator>
+  AICUDA_HD _InputIterator
+  _M_build_sorted(_InputIterator __first, _InputIterator __last,
+                  bool __unique);
+
+  AICUDA_HD _Link_type
+  _M_build_balanced(_Link_type &__list, size_type __n, int __depth,
+                    int __red_depth);
+
+  AICUDA_HD void
   _M_erase(_Link_type __x);
 
-  __device__ iterator
+  AICUDA_HD iterator
   _M_lower_bound(_Link_type __x, _Link_type __y,
                  const _Key &__k);
 
-  __device__ const_iterator
+  AICUDA_HD const_iterator
   _M_lower_bound(_Const_Link_type __x, _Const_Link_type __y,
                  const _Key &__k) const;
 
-  __device__ iterator
+  AICUDA_HD iterator
   _M_upper_bound(_Link_type __x, _Link_type __y,
                  const _Key &__k);
 
-  __device__ const_iterator
+  AICUDA_HD const_iterator
   _M_upper_bound(_Const_Link_type __x, _Const_Link_type __y,
                  const _Key &__k) const;
 
 public:
-  __device__ _Rb_tree() {}
+  AICUDA_HD _Rb_tree() {}
 
-  __device__ _Rb_tree(const _Compare &__comp,
-                      const allocator_type &__a = allocator_type())
+  AICUDA_HD _Rb_tree(const _Compare &__comp,
+                     const allocator_type &__a = allocator_type())
       : _M_impl(__comp, __a) {}
 
-  __device__ _Rb_tree(const _Rb_tree &__x)
+  AICUDA_HD _Rb_tree(const _Rb_tree &__x)
       : _M_impl(__x._M_impl._M_key_compare, __x._M_get_Node_allocator())
   {
     if (__x._M_root() != 0)
@@ -959,122 +985,122 @@ public:
     }
   }
 
-  __device__ ~_Rb_tree()
+  AICUDA_HD ~_Rb_tree()
   {
     _M_erase(_M_begin());
   }
 
-  __device__ _Rb_tree &
+  AICUDA_HD _Rb_tree &
   operator=(const _Rb_tree &__x);
 
-  __device__ _Compare
+  AICUDA_HD _Compare
   key_comp() const
   {
     return _M_impl._M_key_compare;
   }
 
-  __device__ iterator
+  AICUDA_HD iterator
   begin()
   {
     return iterator(static_cast<_Link_type>(this->_M_impl._M_header._M_left));
   }
 
-  __device__ const_iterator
+  AICUDA_HD const_iterator
   begin() const
   {
     return const_iterator(static_cast<_Const_Link_type>(this->_M_impl._M_header._M_left));
   }
 
-  __device__ iterator
+  AICUDA_HD iterator
   end()
   {
     return iterator(static_cast<_Link_type>(&this->_M_impl._M_header));
   }
 
-  __device__ const_iterator
+  AICUDA_HD const_iterator
   end() const
   {
     return const_iterator(static_cast<_Const_Link_type>(&this->_M_impl._M_header));
   }
 
-  __device__ reverse_iterator
+  AICUDA_HD reverse_iterator
   rbegin()
   {
     return reverse_iterator(end());
   }
 
-  __device__ const_reverse_iterator
+  AICUDA_HD const_reverse_iterator
   rbegin() const
   {
     return const_reverse_iterator(end());
   }
 
-  __device__ reverse_iterator
+  AICUDA_HD reverse_iterator
   rend()
   {
     return reverse_iterator(begin());
   }
 
-  __device__ const_reverse_iterator
+  AICUDA_HD const_reverse_iterator
   rend() const
   {
     return const_reverse_iterator(begin());
   }
 
-  __device__ bool
+  AICUDA_HD bool
   empty() const
   {
     return _M_impl._M_node_count == 0;
   }
 
-  __device__ size_type
+  AICUDA_HD size_type
   size() const
   {
     return _M_impl._M_node_count;
   }
 
-  __device__ void
+  AICUDA_HD void
   swap(_Rb_tree &__t);
 
-  __device__ pair<iterator, bool>
+  AICUDA_HD pair<iterator, bool>
   _M_insert_unique(const value_type &__x);
 
-  __device__ iterator
+  AICUDA_HD iterator
   _M_insert_equal(const value_type &__x);
 
-  __device__ iterator
+  AICUDA_HD iterator
   _M_insert_unique_(const_iterator __position, const value_type &__x);
 
-  __device__ iterator
+  AICUDA_HD iterator
   _M_insert_equal_(const_iterator __position, const value_type &__x);
 
   template <typename _InputIterator>
-  __device__ void
+  AICUDA_HD void
   _M_insert_unique(_InputIterator __first, _InputIterator __last);
 
   template <typename _InputIterator>
-  __device__ void
+  AICUDA_HD void
   _M_insert_equal(_InputIterator __first, _InputIterator __last);
 
-  __device__ void
+  AICUDA_HD void
   erase(iterator __position);
 
-  __device__ void
+  AICUDA_HD void
   erase(const_iterator __position);
 
-  __device__ size_type
+  AICUDA_HD size_type
   erase(const key_type &__x);
 
-  __device__ void
+  AICUDA_HD void
   erase(iterator __first, iterator __last);
 
-  __device__ void
+  AICUDA_HD void
   erase(const_iterator __first, const_iterator __last);
 
-  __device__ void
+  AICUDA_HD void
   erase(const key_type *__first, const key_type *__last);
 
-  __device__ void
+  AICUDA_HD void
   clear()
   {
     _M_erase(_M_begin());
@@ -1084,52 +1110,154 @@ public:
     _M_impl._M_node_count = 0;
   }
 
-  __device__ iterator
+  AICUDA_HD iterator
   find(const key_type &__k);
 
-  __device__ const_iterator
+  AICUDA_HD const_iterator
   find(const key_type &__k) const;
 
-  __device__ size_type
+  AICUDA_HD size_type
   count(const key_type &__k) const;
 
-  __device__ iterator
+  AICUDA_HD iterator
   lower_bound(const key_type &__k)
   {
     return _M_lower_bound(_M_begin(), _M_end(), __k);
   }
 
-  __device__ const_iterator
+  AICUDA_HD const_iterator
   lower_bound(const key_type &__k) const
   {
     return _M_lower_bound(_M_begin(), _M_end(), __k);
   }
 
-  __device__ iterator
+  AICUDA_HD iterator
   upper_bound(const key_type &__k)
   {
     return _M_upper_bound(_M_begin(), _M_end(), __k);
   }
 
-  __device__ const_iterator
+  AICUDA_HD const_iterator
   upper_bound(const key_type &__k) const
   {
     return _M_upper_bound(_M_begin(), _M_end(), __k);
   }
 
-  __device__ pair<iterator, iterator>
+  AICUDA_HD pair<iterator, iterator>
   equal_range(const key_type &__k);
 
-  __device__ pair<const_iterator, const_iterator>
+  AICUDA_HD pair<const_iterator, const_iterator>
   equal_range(const key_type &__k) const;
 
-  __device__ bool
+  // Heterogeneous lookup, used by the containers when _Compare is
+  // transparent.  __k is compared against keys in both argument orders.
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_lower_bound_tr(const _Kt &__k)
+  {
+    _Link_type __x = _M_begin();
+    _Link_type __y = _M_end();
+    while (__x != 0)
+      if (!_M_impl._M_key_compare(_S_key(__x), __k))
+        __y = __x, __x = _S_left(__x);
+      else
+        __x = _S_right(__x);
+    return iterator(__y);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD const_iterator
+  _M_lower_bound_tr(const _Kt &__k) const
+  {
+    _Const_Link_type __x = _M_begin();
+    _Const_Link_type __y = _M_end();
+    while (__x != 0)
+      if (!_M_impl._M_key_compare(_S_key(__x), __k))
+        __y = __x, __x = _S_left(__x);
+      else
+        __x = _S_right(__x);
+    return const_iterator(__y);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_upper_bound_tr(const _Kt &__k)
+  {
+    _Link_type __x = _M_begin();
+    _Link_type __y = _M_end();
+    while (__x != 0)
+      if (_M_impl._M_key_compare(__k, _S_key(__x)))
+        __y = __x, __x = _S_left(__x);
+      else
+        __x = _S_right(__x);
+    return iterator(__y);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD const_iterator
+  _M_upper_bound_tr(const _Kt &__k) const
+  {
+    _Const_Link_type __x = _M_begin();
+    _Const_Link_type __y = _M_end();
+    while (__x != 0)
+      if (_M_impl._M_key_compare(__k, _S_key(__x)))
+        __y = __x, __x = _S_left(__x);
+      else
+        __x = _S_right(__x);
+    return const_iterator(__y);
+  }
+
+  template <typename _Kt>
+  AICUDA_HD pair<iterator, iterator>
+  _M_equal_range_tr(const _Kt &__k)
+  {
+    return pair<iterator, iterator>(_M_lower_bound_tr(__k),
+                                    _M_upper_bound_tr(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD pair<const_iterator, const_iterator>
+  _M_equal_range_tr(const _Kt &__k) const
+  {
+    return pair<const_iterator, const_iterator>(_M_lower_bound_tr(__k),
+                                                _M_upper_bound_tr(__k));
+  }
+
+  template <typename _Kt>
+  AICUDA_HD iterator
+  _M_find_tr(const _Kt &__k)
+  {
+    iterator __j = _M_lower_bound_tr(__k);
+    return (__j == end() || _M_impl._M_key_compare(__k, _S_key(__j._M_node)))
+               ? end()
+               : __j;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD const_iterator
+  _M_find_tr(const _Kt &__k) const
+  {
+    const_iterator __j = _M_lower_bound_tr(__k);
+    return (__j == end() || _M_impl._M_key_compare(__k, _S_key(__j._M_node)))
+               ? end()
+               : __j;
+  }
+
+  template <typename _Kt>
+  AICUDA_HD size_type
+  _M_count_tr(const _Kt &__k) const
+  {
+    return aicuda::stl::distance(_M_lower_bound_tr(__k),
+                                 _M_upper_bound_tr(__k));
+  }
+
+  AICUDA_HD bool
   __rb_verify() const;
 };
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ inline void
+AICUDA_HD inline void
 swap(_Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &__x,
      _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &__y)
 {
@@ -1138,7 +1266,7 @@ swap(_Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &__x,
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &
+AICUDA_HD _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 operator=(const _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &__x)
 {
@@ -1160,7 +1288,7 @@ operator=(const _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &__x)
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_insert_(_Const_Base_ptr __x, _Const_Base_ptr __p, const _Val &__v)
 {
@@ -1177,7 +1305,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_insert_lower(_Base_ptr __x, _Base_ptr __p, const _Val &__v)
 {
@@ -1193,7 +1321,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_insert_equal_lower(const _Val &__v)
 {
@@ -1209,7 +1337,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KoV,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KoV, _Compare, _Alloc>::_Link_type
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KoV, _Compare, _Alloc>::_Link_type
 _Rb_tree<_Key, _Val, _KoV, _Compare, _Alloc>::
     _M_copy(_Const_Link_type __x, _Link_type __p)
 {
@@ -1238,7 +1366,7 @@ _Rb_tree<_Key, _Val, _KoV, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+AICUDA_HD void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_erase(_Link_type __x)
 {
 
@@ -1253,7 +1381,7 @@ __device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue,
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue,
                              _Compare, _Alloc>::iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_lower_bound(_Link_type __x, _Link_type __y,
@@ -1269,7 +1397,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue,
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue,
                              _Compare, _Alloc>::const_iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_lower_bound(_Const_Link_type __x, _Const_Link_type __y,
@@ -1285,7 +1413,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue,
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue,
                              _Compare, _Alloc>::iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_upper_bound(_Link_type __x, _Link_type __y,
@@ -1301,7 +1429,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue,
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue,
                              _Compare, _Alloc>::const_iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_upper_bound(_Const_Link_type __x, _Const_Link_type __y,
@@ -1317,7 +1445,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ aicuda::stl::pair<typename _Rb_tree<_Key, _Val, _KeyOfValue,
+AICUDA_HD aicuda::stl::pair<typename _Rb_tree<_Key, _Val, _KeyOfValue,
                                                _Compare, _Alloc>::iterator,
                              typename _Rb_tree<_Key, _Val, _KeyOfValue,
                                                _Compare, _Alloc>::iterator>
@@ -1348,7 +1476,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ aicuda::stl::pair<typename _Rb_tree<_Key, _Val, _KeyOfValue,
+AICUDA_HD aicuda::stl::pair<typename _Rb_tree<_Key, _Val, _KeyOfValue,
                                                _Compare, _Alloc>::const_iterator,
                              typename _Rb_tree<_Key, _Val, _KeyOfValue,
                                                _Compare, _Alloc>::const_iterator>
@@ -1379,7 +1507,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+AICUDA_HD void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     swap(_Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc> &__t)
 {
   if (_M_root() == 0)
@@ -1426,7 +1554,7 @@ __device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ aicuda::stl::pair<typename _Rb_tree<_Key, _Val, _KeyOfValue,
+AICUDA_HD aicuda::stl::pair<typename _Rb_tree<_Key, _Val, _KeyOfValue,
                                                _Compare, _Alloc>::iterator,
                              bool>
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
@@ -1456,7 +1584,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_insert_equal(const _Val &__v)
 {
@@ -1472,7 +1600,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_insert_unique_(const_iterator __position, const _Val &__v)
 {
@@ -1529,7 +1657,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     _M_insert_equal_(const_iterator __position, const _Val &__v)
 {
@@ -1583,9 +1711,11 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 template <typename _Key, typename _Val, typename _KoV,
           typename _Cmp, typename _Alloc>
 template <class _II>
-__device__ void _Rb_tree<_Key, _Val, _KoV, _Cmp, _Alloc>::
+AICUDA_HD void _Rb_tree<_Key, _Val, _KoV, _Cmp, _Alloc>::
     _M_insert_unique(_II __first, _II __last)
 {
+  if (_M_impl._M_node_count == 0)
+    __first = _M_build_sorted(__first, __last, true);
   for (; __first != __last; ++__first)
     _M_insert_unique_(end(), *__first);
 }
@@ -1593,16 +1723,103 @@ __device__ void _Rb_tree<_Key, _Val, _KoV, _Cmp, _Alloc>::
 template <typename _Key, typename _Val, typename _KoV,
           typename _Cmp, typename _Alloc>
 template <class _II>
-__device__ void _Rb_tree<_Key, _Val, _KoV, _Cmp, _Alloc>::
+AICUDA_HD void _Rb_tree<_Key, _Val, _KoV, _Cmp, _Alloc>::
     _M_insert_equal(_II __first, _II __last)
 {
+  if (_M_impl._M_node_count == 0)
+    __first = _M_build_sorted(__first, __last, false);
   for (; __first != __last; ++__first)
     _M_insert_equal_(end(), *__first);
 }
 
+// Bulk load of an empty tree.  The sorted prefix of [__first, __last) is
+// gathered into a chain of nodes linked through _M_right (duplicate keys
+// are dropped when __unique), and the chain is then linked into a
+// perfectly balanced tree in one pass without any rotation.  Returns the
+// first element that is out of order, which the caller inserts normally.
+template <typename _Key, typename _Val, typename _KoV,
+          typename _Cmp, typename _Alloc>
+template <class _II>
+AICUDA_HD _II _Rb_tree<_Key, _Val, _KoV, _Cmp, _Alloc>::
+    _M_build_sorted(_II __first, _II __last, bool __unique)
+{
+  _Link_type __head = 0;
+  _Link_type __tail = 0;
+  size_type __n = 0;
+
+  for (; __first != __last; ++__first)
+  {
+    const value_type &__v = *__first;
+    if (__tail != 0)
+    {
+      if (_M_impl._M_key_compare(_KoV()(__v), _S_key(__tail)))
+        break;
+      if (__unique && !_M_impl._M_key_compare(_S_key(__tail), _KoV()(__v)))
+        continue;
+    }
+    _Link_type __z = _M_create_node(__v);
+    __z->_M_left = 0;
+    __z->_M_right = 0;
+    if (__tail != 0)
+      __tail->_M_right = __z;
+    else
+      __head = __z;
+    __tail = __z;
+    ++__n;
+  }
+
+  if (__n == 0)
+    return __first;
+
+  // Every level above the deepest one is full, so colouring the nodes of
+  // that level red (unless it is the root) leaves all paths with the same
+  // number of black nodes.
+  int __height = 0;
+  while ((__n >> (__height + 1)) != 0)
+    ++__height;
+
+  _Link_type __list = __head;
+  _Link_type __root = _M_build_balanced(__list, __n, 0,
+                                        __height != 0 ? __height : -1);
+  __root->_M_parent = _M_end();
+  _M_root() = __root;
+  _M_leftmost() = __head;
+  _M_rightmost() = __tail;
+  _M_impl._M_node_count = __n;
+  return __first;
+}
+
+template <typename _Key, typename _Val, typename _KoV,
+          typename _Cmp, typename _Alloc>
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KoV, _Cmp, _Alloc>::_Link_type
+_Rb_tree<_Key, _Val, _KoV, _Cmp, _Alloc>::
+    _M_build_balanced(_Link_type &__list, size_type __n, int __depth,
+                      int __red_depth)
+{
+  if (__n == 0)
+    return 0;
+
+  const size_type __left_n = (__n - 1) / 2;
+  _Link_type __left = _M_build_balanced(__list, __left_n, __depth + 1,
+                                        __red_depth);
+  _Link_type __x = __list;
+  __list = static_cast<_Link_type>(__x->_M_right);
+
+  __x->_M_color = __depth == __red_depth ? _S_red : _S_black;
+  __x->_M_left = __left;
+  if (__left != 0)
+    __left->_M_parent = __x;
+  _Link_type __right = _M_build_balanced(__list, __n - 1 - __left_n,
+                                         __depth + 1, __red_depth);
+  __x->_M_right = __right;
+  if (__right != 0)
+    __right->_M_parent = __x;
+  return __x;
+}
+
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ inline void
+AICUDA_HD inline void
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     erase(iterator __position)
 {
@@ -1615,7 +1832,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ inline void
+AICUDA_HD inline void
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     erase(const_iterator __position)
 {
@@ -1628,7 +1845,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::size_type
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::size_type
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     erase(const _Key &__x)
 {
@@ -1640,7 +1857,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+AICUDA_HD void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     erase(iterator __first, iterator __last)
 {
   if (__first == begin() && __last == end())
@@ -1652,7 +1869,7 @@ __device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+AICUDA_HD void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     erase(const_iterator __first, const_iterator __last)
 {
   if (__first == begin() && __last == end())
@@ -1664,7 +1881,7 @@ __device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
+AICUDA_HD void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     erase(const _Key *__first, const _Key *__last)
 {
   while (__first != __last)
@@ -1673,7 +1890,7 @@ __device__ void _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue,
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue,
                              _Compare, _Alloc>::iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     find(const _Key &__k)
@@ -1687,7 +1904,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue,
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue,
                              _Compare, _Alloc>::const_iterator
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     find(const _Key &__k) const
@@ -1701,7 +1918,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::size_type
+AICUDA_HD typename _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::size_type
 _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
     count(const _Key &__k) const
 {
@@ -1712,7 +1929,7 @@ _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::
 
 template <typename _Key, typename _Val, typename _KeyOfValue,
           typename _Compare, typename _Alloc>
-__device__ bool _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::__rb_verify() const
+AICUDA_HD bool _Rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>::__rb_verify() const
 {
   if (_M_impl._M_node_count == 0 || begin() == end())
     return _M_impl._M_node_count == 0 && begin() == end() && this->_M_impl._M_header._M_left == _M_end() && this->_M_impl._M_header._M_right == _M_end();
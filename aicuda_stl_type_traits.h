@@ -25,6 +25,7 @@
 #ifndef _AICUDA_STL_TYPE_TRAITS_H_
 #define _AICUDA_STL_TYPE_TRAITS_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <assert.h>
 
 namespace aicuda
@@ -261,6 +262,25 @@ struct __is_integer<unsigned long long>
   typedef __true_type __type;
 };
 
+// Integer types without negative values (bool included).
+template <typename _Tp, bool = __is_integer<_Tp>::__value>
+struct __is_unsigned_integer
+{
+  enum
+  {
+    __value = 0
+  };
+};
+
+template <typename _Tp>
+struct __is_unsigned_integer<_Tp, true>
+{
+  enum
+  {
+    __value = _Tp(-1) > _Tp(0)
+  };
+};
+
 template <typename _Tp>
 struct __is_floating
 {
@@ -457,6 +477,16 @@ struct __is_byte<unsigned char>
   typedef __true_type __type;
 };
 
+// Elements that may be copied as raw bytes (memcpy/memset-able).
+template <typename _Tp>
+struct __is_trivially_copyable_type
+{
+  enum
+  {
+    __value = __is_trivially_copyable(_Tp)
+  };
+};
+
 template <typename _Tp>
 struct __is_move_iterator
 {
@@ -478,6 +508,12 @@ struct __enable_if<true, _Tp>
   typedef _Tp __type;
 };
 
+template <typename>
+struct __void_type
+{
+  typedef void __type;
+};
+
 template <bool _Cond, typename _Iftrue, typename _Iffalse>
 struct __conditional_type
 {
@@ -595,14 +631,14 @@ template <>
 struct __remove_unsigned<wchar_t>;
 
 template <typename _Type>
-__device__ inline bool
+AICUDA_HD inline bool
 __is_null_pointer(_Type *__ptr)
 {
   return __ptr == 0;
 }
 
 template <typename _Type>
-__device__ inline bool
+AICUDA_HD inline bool
     __is_null_pointer(_Type)
 {
   return false;
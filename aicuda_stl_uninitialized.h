@@ -25,15 +25,21 @@
 #ifndef _AICUDA_STL_UNINITIALIZED_H_
 #define _AICUDA_STL_UNINITIALIZED_H_ 1
 
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_allocator.h>
+#include <aicuda_stl_construct.h>
+#include <aicuda_stl_function.h>
+#include <aicuda_stl_iterator.h>
+
 namespace aicuda {
 namespace stl {
 
 template <bool>
 struct __uninitialized_copy {
   template <typename _InputIterator, typename _ForwardIterator>
-  __device__ static _ForwardIterator uninitialized_copy(
-      _InputIterator __first, _InputIterator __last,
-      _ForwardIterator __result) {
+  AICUDA_HD static _ForwardIterator uninitialized_copy(
+     _InputIterator __first, _InputIterator __last,
+     _ForwardIterator __result) {
     _ForwardIterator __cur = __result;
 
     for (; __first != __last; ++__first, ++__cur)
@@ -46,16 +52,16 @@ struct __uninitialized_copy {
 template <>
 struct __uninitialized_copy<true> {
   template <typename _InputIterator, typename _ForwardIterator>
-  __device__ static _ForwardIterator uninitialized_copy(
-      _InputIterator __first, _InputIterator __last,
-      _ForwardIterator __result) {
+  AICUDA_HD static _ForwardIterator uninitialized_copy(
+     _InputIterator __first, _InputIterator __last,
+     _ForwardIterator __result) {
     return aicuda::stl::copy(__first, __last, __result);
   }
 };
 
 template <typename _InputIterator, typename _ForwardIterator>
-__device__ inline _ForwardIterator uninitialized_copy(
-    _InputIterator __first, _InputIterator __last, _ForwardIterator __result) {
+AICUDA_HD inline _ForwardIterator uninitialized_copy(
+   _InputIterator __first, _InputIterator __last, _ForwardIterator __result) {
   typedef typename iterator_traits<_InputIterator>::value_type _ValueType1;
   typedef typename iterator_traits<_ForwardIterator>::value_type _ValueType2;
 
@@ -67,9 +73,9 @@ __device__ inline _ForwardIterator uninitialized_copy(
 template <bool>
 struct __uninitialized_fill {
   template <typename _ForwardIterator, typename _Tp>
-  __device__ static void uninitialized_fill(_ForwardIterator __first,
-                                            _ForwardIterator __last,
-                                            const _Tp &__x) {
+  AICUDA_HD static void uninitialized_fill(_ForwardIterator __first,
+                                           _ForwardIterator __last,
+                                           const _Tp &__x) {
     _ForwardIterator __cur = __first;
 
     for (; __cur != __last; ++__cur) aicuda::stl::_Construct(&*__cur, __x);
@@ -79,17 +85,17 @@ struct __uninitialized_fill {
 template <>
 struct __uninitialized_fill<true> {
   template <typename _ForwardIterator, typename _Tp>
-  __device__ static void uninitialized_fill(_ForwardIterator __first,
-                                            _ForwardIterator __last,
-                                            const _Tp &__x) {
+  AICUDA_HD static void uninitialized_fill(_ForwardIterator __first,
+                                           _ForwardIterator __last,
+                                           const _Tp &__x) {
     aicuda::stl::fill(__first, __last, __x);
   }
 };
 
 template <typename _ForwardIterator, typename _Tp>
-__device__ inline void uninitialized_fill(_ForwardIterator __first,
-                                          _ForwardIterator __last,
-                                          const _Tp &__x) {
+AICUDA_HD inline void uninitialized_fill(_ForwardIterator __first,
+                                         _ForwardIterator __last,
+                                         const _Tp &__x) {
   typedef typename iterator_traits<_ForwardIterator>::value_type _ValueType;
 
   aicuda::stl::__uninitialized_fill<__is_pod(_ValueType)>::uninitialized_fill(
@@ -99,8 +105,8 @@ __device__ inline void uninitialized_fill(_ForwardIterator __first,
 template <bool>
 struct __uninitialized_fill_n {
   template <typename _ForwardIterator, typename _Size, typename _Tp>
-  __device__ static void uninitialized_fill_n(_ForwardIterator __first,
-                                              _Size __n, const _Tp &__x) {
+  AICUDA_HD static void uninitialized_fill_n(_ForwardIterator __first,
+                                             _Size __n, const _Tp &__x) {
     _ForwardIterator __cur = __first;
 
     for (; __n > 0; --__n, ++__cur) aicuda::stl::_Construct(&*__cur, __x);
@@ -110,15 +116,15 @@ struct __uninitialized_fill_n {
 template <>
 struct __uninitialized_fill_n<true> {
   template <typename _ForwardIterator, typename _Size, typename _Tp>
-  __device__ static void uninitialized_fill_n(_ForwardIterator __first,
-                                              _Size __n, const _Tp &__x) {
+  AICUDA_HD static void uninitialized_fill_n(_ForwardIterator __first,
+                                             _Size __n, const _Tp &__x) {
     aicuda::stl::fill_n(__first, __n, __x);
   }
 };
 
 template <typename _ForwardIterator, typename _Size, typename _Tp>
-__device__ inline void uninitialized_fill_n(_ForwardIterator __first, _Size __n,
-                                            const _Tp &__x) {
+AICUDA_HD inline void uninitialized_fill_n(_ForwardIterator __first, _Size __n,
+                                           const _Tp &__x) {
   typedef typename iterator_traits<_ForwardIterator>::value_type _ValueType;
 
   aicuda::stl::__uninitialized_fill_n<__is_pod(
@@ -127,10 +133,10 @@ __device__ inline void uninitialized_fill_n(_ForwardIterator __first, _Size __n,
 
 template <typename _InputIterator, typename _ForwardIterator,
           typename _Allocator>
-__device__ _ForwardIterator __uninitialized_copy_a(_InputIterator __first,
-                                                   _InputIterator __last,
-                                                   _ForwardIterator __result,
-                                                   _Allocator &__alloc) {
+AICUDA_HD _ForwardIterator __uninitialized_copy_a(_InputIterator __first,
+                                                  _InputIterator __last,
+                                                  _ForwardIterator __result,
+                                                  _Allocator &__alloc) {
   _ForwardIterator __cur = __result;
 
   for (; __first != __last; ++__first, ++__cur)
@@ -139,42 +145,42 @@ __device__ _ForwardIterator __uninitialized_copy_a(_InputIterator __first,
 }
 
 template <typename _InputIterator, typename _ForwardIterator, typename _Tp>
-__device__ inline _ForwardIterator __uninitialized_copy_a(
-    _InputIterator __first, _InputIterator __last, _ForwardIterator __result,
-    allocator<_Tp> &) {
+AICUDA_HD inline _ForwardIterator __uninitialized_copy_a(
+   _InputIterator __first, _InputIterator __last, _ForwardIterator __result,
+   allocator<_Tp> &) {
   return aicuda::stl::uninitialized_copy(__first, __last, __result);
 }
 
 template <typename _InputIterator, typename _ForwardIterator,
           typename _Allocator>
-__device__ inline _ForwardIterator __uninitialized_move_a(
-    _InputIterator __first, _InputIterator __last, _ForwardIterator __result,
-    _Allocator &__alloc) {
+AICUDA_HD inline _ForwardIterator __uninitialized_move_a(
+   _InputIterator __first, _InputIterator __last, _ForwardIterator __result,
+   _Allocator &__alloc) {
   return aicuda::stl::__uninitialized_copy_a((__first), (__last), __result,
                                              __alloc);
 }
 
 template <typename _ForwardIterator, typename _Tp, typename _Allocator>
-__device__ void __uninitialized_fill_a(_ForwardIterator __first,
-                                       _ForwardIterator __last, const _Tp &__x,
-                                       _Allocator &__alloc) {
+AICUDA_HD void __uninitialized_fill_a(_ForwardIterator __first,
+                                      _ForwardIterator __last, const _Tp &__x,
+                                      _Allocator &__alloc) {
   _ForwardIterator __cur = __first;
 
   for (; __cur != __last; ++__cur) __alloc.construct(&*__cur, __x);
 }
 
 template <typename _ForwardIterator, typename _Tp, typename _Tp2>
-__device__ inline void __uninitialized_fill_a(_ForwardIterator __first,
-                                              _ForwardIterator __last,
-                                              const _Tp &__x,
-                                              allocator<_Tp2> &) {
+AICUDA_HD inline void __uninitialized_fill_a(_ForwardIterator __first,
+                                             _ForwardIterator __last,
+                                             const _Tp &__x,
+                                             allocator<_Tp2> &) {
   aicuda::stl::uninitialized_fill(__first, __last, __x);
 }
 
 template <typename _ForwardIterator, typename _Size, typename _Tp,
           typename _Allocator>
-__device__ void __uninitialized_fill_n_a(_ForwardIterator __first, _Size __n,
-                                         const _Tp &__x, _Allocator &__alloc) {
+AICUDA_HD void __uninitialized_fill_n_a(_ForwardIterator __first, _Size __n,
+                                        const _Tp &__x, _Allocator &__alloc) {
   _ForwardIterator __cur = __first;
 
   for (; __n > 0; --__n, ++__cur) __alloc.construct(&*__cur, __x);
@@ -182,17 +188,17 @@ __device__ void __uninitialized_fill_n_a(_ForwardIterator __first, _Size __n,
 
 template <typename _ForwardIterator, typename _Size, typename _Tp,
           typename _Tp2>
-__device__ inline void __uninitialized_fill_n_a(_ForwardIterator __first,
-                                                _Size __n, const _Tp &__x,
-                                                allocator<_Tp2> &) {
+AICUDA_HD inline void __uninitialized_fill_n_a(_ForwardIterator __first,
+                                               _Size __n, const _Tp &__x,
+                                               allocator<_Tp2> &) {
   aicuda::stl::uninitialized_fill_n(__first, __n, __x);
 }
 
 template <typename _InputIterator1, typename _InputIterator2,
           typename _ForwardIterator, typename _Allocator>
-__device__ inline _ForwardIterator __uninitialized_copy_move(
-    _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2,
-    _InputIterator2 __last2, _ForwardIterator __result, _Allocator &__alloc) {
+AICUDA_HD inline _ForwardIterator __uninitialized_copy_move(
+   _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2,
+   _InputIterator2 __last2, _ForwardIterator __result, _Allocator &__alloc) {
   _ForwardIterator __mid =
       aicuda::stl::__uninitialized_copy_a(__first1, __last1, __result, __alloc);
 
@@ -201,9 +207,9 @@ __device__ inline _ForwardIterator __uninitialized_copy_move(
 
 template <typename _InputIterator1, typename _InputIterator2,
           typename _ForwardIterator, typename _Allocator>
-__device__ inline _ForwardIterator __uninitialized_move_copy(
-    _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2,
-    _InputIterator2 __last2, _ForwardIterator __result, _Allocator &__alloc) {
+AICUDA_HD inline _ForwardIterator __uninitialized_move_copy(
+   _InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2,
+   _InputIterator2 __last2, _ForwardIterator __result, _Allocator &__alloc) {
   _ForwardIterator __mid =
       aicuda::stl::__uninitialized_move_a(__first1, __last1, __result, __alloc);
 
@@ -212,9 +218,9 @@ __device__ inline _ForwardIterator __uninitialized_move_copy(
 
 template <typename _ForwardIterator, typename _Tp, typename _InputIterator,
           typename _Allocator>
-__device__ inline _ForwardIterator __uninitialized_fill_move(
-    _ForwardIterator __result, _ForwardIterator __mid, const _Tp &__x,
-    _InputIterator __first, _InputIterator __last, _Allocator &__alloc) {
+AICUDA_HD inline _ForwardIterator __uninitialized_fill_move(
+   _ForwardIterator __result, _ForwardIterator __mid, const _Tp &__x,
+   _InputIterator __first, _InputIterator __last, _Allocator &__alloc) {
   aicuda::stl::__uninitialized_fill_a(__result, __mid, __x, __alloc);
 
   return aicuda::stl::__uninitialized_move_a(__first, __last, __mid, __alloc);
@@ -222,9 +228,9 @@ __device__ inline _ForwardIterator __uninitialized_fill_move(
 
 template <typename _InputIterator, typename _ForwardIterator, typename _Tp,
           typename _Allocator>
-__device__ inline void __uninitialized_move_fill(
-    _InputIterator __first1, _InputIterator __last1, _ForwardIterator __first2,
-    _ForwardIterator __last2, const _Tp &__x, _Allocator &__alloc) {
+AICUDA_HD inline void __uninitialized_move_fill(
+   _InputIterator __first1, _InputIterator __last1, _ForwardIterator __first2,
+   _ForwardIterator __last2, const _Tp &__x, _Allocator &__alloc) {
   _ForwardIterator __mid2 =
       aicuda::stl::__uninitialized_move_a(__first1, __last1, __first2, __alloc);
 
@@ -0,0 +1,241 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_UNORDERED_MAP_H_
+#define _AICUDA_STL_UNORDERED_MAP_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_hashtable.h>
+#include <assert.h>
+
+namespace aicuda {
+namespace stl {
+
+// map's interface over an open-addressing hash table: expected O(1)
+// lookups that probe a flat slot array instead of chasing tree nodes, in
+// no particular order.  Inserting may rehash, which moves every element
+// and invalidates all iterators and references; erasing invalidates only
+// the erased element's.
+template <typename _Key, typename _Tp,
+          typename _Hash = aicuda::stl::hash<_Key>,
+          typename _Pred = aicuda::stl::equal_to<_Key>,
+          typename _Alloc =
+              aicuda::stl::allocator<aicuda::stl::pair<const _Key, _Tp>>>
+class unordered_map {
+ public:
+  typedef _Key key_type;
+  typedef _Tp mapped_type;
+  typedef aicuda::stl::pair<const _Key, _Tp> value_type;
+  typedef _Hash hasher;
+  typedef _Pred key_equal;
+  typedef _Alloc allocator_type;
+
+ private:
+  typedef typename _Alloc::template rebind<value_type>::other _Pair_alloc_type;
+
+  typedef _Hashtable<key_type, value_type, _Select1st<value_type>, hasher,
+                     key_equal, _Pair_alloc_type>
+      _Rep_type;
+
+  _Rep_type _M_h;
+
+ public:
+  typedef typename _Pair_alloc_type::pointer pointer;
+  typedef typename _Pair_alloc_type::const_pointer const_pointer;
+  typedef typename _Pair_alloc_type::reference reference;
+  typedef typename _Pair_alloc_type::const_reference const_reference;
+  typedef typename _Rep_type::iterator iterator;
+  typedef typename _Rep_type::const_iterator const_iterator;
+  typedef typename _Rep_type::size_type size_type;
+  typedef typename _Rep_type::difference_type difference_type;
+
+  AICUDA_HD unordered_map() : _M_h() {}
+
+  AICUDA_HD explicit unordered_map(size_type __n,
+                                   const hasher &__hf = hasher(),
+                                   const key_equal &__eql = key_equal(),
+                                   const allocator_type &__a = allocator_type())
+      : _M_h(__n, __hf, __eql, __a) {}
+
+  AICUDA_HD unordered_map(const unordered_map &__x) : _M_h(__x._M_h) {}
+
+  template <typename _InputIterator>
+  AICUDA_HD unordered_map(_InputIterator __first, _InputIterator __last)
+      : _M_h() {
+    _M_h._M_insert_unique(__first, __last);
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD unordered_map(_InputIterator __first, _InputIterator __last,
+                          size_type __n, const hasher &__hf = hasher(),
+                          const key_equal &__eql = key_equal(),
+                          const allocator_type &__a = allocator_type())
+      : _M_h(__n, __hf, __eql, __a) {
+    _M_h._M_insert_unique(__first, __last);
+  }
+
+  AICUDA_HD unordered_map &operator=(const unordered_map &__x) {
+    _M_h = __x._M_h;
+    return *this;
+  }
+
+  AICUDA_HD allocator_type get_allocator() const {
+    return _M_h.get_allocator();
+  }
+
+  AICUDA_HD iterator begin() { return _M_h.begin(); }
+
+  AICUDA_HD const_iterator begin() const { return _M_h.begin(); }
+
+  AICUDA_HD iterator end() { return _M_h.end(); }
+
+  AICUDA_HD const_iterator end() const { return _M_h.end(); }
+
+  AICUDA_HD bool empty() const { return _M_h.empty(); }
+
+  AICUDA_HD size_type size() const { return _M_h.size(); }
+
+  AICUDA_HD size_type max_size() const { return _M_h.max_size(); }
+
+  AICUDA_HD mapped_type &operator[](const key_type &__k) {
+    // __k may be a key or value of this map, which a rehash would free.
+    if (!_M_h._M_disjunct(&__k)) {
+      const key_type __kc(__k);
+      return (*this)[__kc];
+    }
+    aicuda::stl::pair<iterator, bool> __r = _M_h._M_find_or_prepare(__k);
+    if (__r.second) _M_h._M_construct(__r.first, value_type(__k, mapped_type()));
+    return (*__r.first).second;
+  }
+
+  AICUDA_HD mapped_type &at(const key_type &__k) {
+    iterator __i = find(__k);
+    if (__i == end()) assert(1 < 0);
+    return (*__i).second;
+  }
+
+  AICUDA_HD const mapped_type &at(const key_type &__k) const {
+    const_iterator __i = find(__k);
+    if (__i == end()) assert(1 < 0);
+    return (*__i).second;
+  }
+
+  AICUDA_HD aicuda::stl::pair<iterator, bool> insert(const value_type &__x) {
+    return _M_h._M_insert_unique(__x);
+  }
+
+  // The hint is ignored: the hash alone decides where an element goes.
+  AICUDA_HD iterator insert(const_iterator, const value_type &__x) {
+    return _M_h._M_insert_unique(__x).first;
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD void insert(_InputIterator __first, _InputIterator __last) {
+    _M_h._M_insert_unique(__first, __last);
+  }
+
+  AICUDA_HD void erase(const_iterator __position) { _M_h.erase(__position); }
+
+  AICUDA_HD size_type erase(const key_type &__x) { return _M_h.erase(__x); }
+
+  AICUDA_HD void erase(const_iterator __first, const_iterator __last) {
+    _M_h.erase(__first, __last);
+  }
+
+  AICUDA_HD void swap(unordered_map &__x) { _M_h.swap(__x._M_h); }
+
+  AICUDA_HD void clear() { _M_h.clear(); }
+
+  AICUDA_HD hasher hash_function() const { return _M_h.hash_function(); }
+
+  AICUDA_HD key_equal key_eq() const { return _M_h.key_eq(); }
+
+  AICUDA_HD iterator find(const key_type &__x) { return _M_h.find(__x); }
+
+  AICUDA_HD const_iterator find(const key_type &__x) const {
+    return _M_h.find(__x);
+  }
+
+  AICUDA_HD size_type count(const key_type &__x) const {
+    return _M_h.find(__x) == _M_h.end() ? 0 : 1;
+  }
+
+  AICUDA_HD aicuda::stl::pair<iterator, iterator> equal_range(
+     const key_type &__x) {
+    iterator __i = find(__x);
+    iterator __j = __i;
+    if (__i != end()) ++__j;
+    return aicuda::stl::pair<iterator, iterator>(__i, __j);
+  }
+
+  AICUDA_HD aicuda::stl::pair<const_iterator, const_iterator> equal_range(
+     const key_type &__x) const {
+    const_iterator __i = find(__x);
+    const_iterator __j = __i;
+    if (__i != end()) ++__j;
+    return aicuda::stl::pair<const_iterator, const_iterator>(__i, __j);
+  }
+
+  // Lookup by any key type both the hasher and key_equal accept, e.g. a
+  // string_view into an unordered_map<string, _Tp> whose functors are
+  // transparent.  Only available when both declare is_transparent.
+  template <typename _Kt>
+  AICUDA_HD typename __if_hash_transparent<_Hash, _Pred, _Kt, iterator>::__type
+  find(const _Kt &__x) { return _M_h._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD
+      typename __if_hash_transparent<_Hash, _Pred, _Kt, const_iterator>::__type
+      find(const _Kt &__x) const { return _M_h._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_hash_transparent<_Hash, _Pred, _Kt, size_type>::__type
+  count(const _Kt &__x) const {
+    return _M_h._M_find_tr(__x) == _M_h.end() ? 0 : 1;
+  }
+
+  AICUDA_HD size_type bucket_count() const { return _M_h.bucket_count(); }
+
+  AICUDA_HD float load_factor() const { return _M_h.load_factor(); }
+
+  AICUDA_HD float max_load_factor() const { return _M_h.max_load_factor(); }
+
+  AICUDA_HD void max_load_factor(float __z) { _M_h.max_load_factor(__z); }
+
+  AICUDA_HD void rehash(size_type __n) { _M_h.rehash(__n); }
+
+  AICUDA_HD void reserve(size_type __n) { _M_h.reserve(__n); }
+};
+
+template <typename _Key, typename _Tp, typename _Hash, typename _Pred,
+          typename _Alloc>
+AICUDA_HD inline void swap(unordered_map<_Key, _Tp, _Hash, _Pred, _Alloc> &__x,
+                           unordered_map<_Key, _Tp, _Hash, _Pred, _Alloc> &__y) {
+  __x.swap(__y);
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_UNORDERED_MAP_H_ */
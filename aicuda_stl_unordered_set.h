@@ -0,0 +1,190 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_UNORDERED_SET_H_
+#define _AICUDA_STL_UNORDERED_SET_H_ 1
+
+#include <aicuda_stl_config.h>
+#include <aicuda_stl_hashtable.h>
+#include <assert.h>
+
+namespace aicuda {
+namespace stl {
+
+// set's interface over the open-addressing table of unordered_map; the
+// same iterator invalidation rules apply.
+template <typename _Value, typename _Hash = aicuda::stl::hash<_Value>,
+          typename _Pred = aicuda::stl::equal_to<_Value>,
+          typename _Alloc = aicuda::stl::allocator<_Value>>
+class unordered_set {
+ public:
+  typedef _Value key_type;
+  typedef _Value value_type;
+  typedef _Hash hasher;
+  typedef _Pred key_equal;
+  typedef _Alloc allocator_type;
+
+ private:
+  typedef typename _Alloc::template rebind<_Value>::other _Value_alloc_type;
+
+  typedef _Hashtable<key_type, value_type, _Identity<value_type>, hasher,
+                     key_equal, _Value_alloc_type>
+      _Rep_type;
+  _Rep_type _M_h;
+
+ public:
+  typedef typename _Value_alloc_type::pointer pointer;
+  typedef typename _Value_alloc_type::const_pointer const_pointer;
+  typedef typename _Value_alloc_type::reference reference;
+  typedef typename _Value_alloc_type::const_reference const_reference;
+  typedef typename _Rep_type::const_iterator iterator;
+  typedef typename _Rep_type::const_iterator const_iterator;
+  typedef typename _Rep_type::size_type size_type;
+  typedef typename _Rep_type::difference_type difference_type;
+
+  AICUDA_HD unordered_set() : _M_h() {}
+
+  AICUDA_HD explicit unordered_set(size_type __n,
+                                   const hasher &__hf = hasher(),
+                                   const key_equal &__eql = key_equal(),
+                                   const allocator_type &__a = allocator_type())
+      : _M_h(__n, __hf, __eql, __a) {}
+
+  template <typename _InputIterator>
+  AICUDA_HD unordered_set(_InputIterator __first, _InputIterator __last)
+      : _M_h() {
+    _M_h._M_insert_unique(__first, __last);
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD unordered_set(_InputIterator __first, _InputIterator __last,
+                          size_type __n, const hasher &__hf = hasher(),
+                          const key_equal &__eql = key_equal(),
+                          const allocator_type &__a = allocator_type())
+      : _M_h(__n, __hf, __eql, __a) {
+    _M_h._M_insert_unique(__first, __last);
+  }
+
+  AICUDA_HD unordered_set(const unordered_set &__x) : _M_h(__x._M_h) {}
+
+  AICUDA_HD unordered_set &operator=(const unordered_set &__x) {
+    _M_h = __x._M_h;
+    return *this;
+  }
+
+  AICUDA_HD hasher hash_function() const { return _M_h.hash_function(); }
+
+  AICUDA_HD key_equal key_eq() const { return _M_h.key_eq(); }
+
+  AICUDA_HD allocator_type get_allocator() const {
+    return _M_h.get_allocator();
+  }
+
+  AICUDA_HD iterator begin() const { return _M_h.begin(); }
+
+  AICUDA_HD iterator end() const { return _M_h.end(); }
+
+  AICUDA_HD bool empty() const { return _M_h.empty(); }
+
+  AICUDA_HD size_type size() const { return _M_h.size(); }
+
+  AICUDA_HD size_type max_size() const { return _M_h.max_size(); }
+
+  AICUDA_HD void swap(unordered_set &__x) { _M_h.swap(__x._M_h); }
+
+  AICUDA_HD aicuda::stl::pair<iterator, bool> insert(const value_type &__x) {
+    aicuda::stl::pair<typename _Rep_type::iterator, bool> __p =
+        _M_h._M_insert_unique(__x);
+    return aicuda::stl::pair<iterator, bool>(__p.first, __p.second);
+  }
+
+  // The hint is ignored: the hash alone decides where an element goes.
+  AICUDA_HD iterator insert(const_iterator, const value_type &__x) {
+    return _M_h._M_insert_unique(__x).first;
+  }
+
+  template <typename _InputIterator>
+  AICUDA_HD void insert(_InputIterator __first, _InputIterator __last) {
+    _M_h._M_insert_unique(__first, __last);
+  }
+
+  AICUDA_HD void erase(const_iterator __position) { _M_h.erase(__position); }
+
+  AICUDA_HD size_type erase(const key_type &__x) { return _M_h.erase(__x); }
+
+  AICUDA_HD void erase(const_iterator __first, const_iterator __last) {
+    _M_h.erase(__first, __last);
+  }
+
+  AICUDA_HD void clear() { _M_h.clear(); }
+
+  AICUDA_HD size_type count(const key_type &__x) const {
+    return _M_h.find(__x) == _M_h.end() ? 0 : 1;
+  }
+
+  AICUDA_HD iterator find(const key_type &__x) const { return _M_h.find(__x); }
+
+  AICUDA_HD aicuda::stl::pair<iterator, iterator> equal_range(
+     const key_type &__x) const {
+    iterator __i = find(__x);
+    iterator __j = __i;
+    if (__i != end()) ++__j;
+    return aicuda::stl::pair<iterator, iterator>(__i, __j);
+  }
+
+  // Lookup by any key type both the hasher and key_equal accept; only
+  // available when both declare is_transparent.
+  template <typename _Kt>
+  AICUDA_HD typename __if_hash_transparent<_Hash, _Pred, _Kt, iterator>::__type
+  find(const _Kt &__x) const { return _M_h._M_find_tr(__x); }
+
+  template <typename _Kt>
+  AICUDA_HD typename __if_hash_transparent<_Hash, _Pred, _Kt, size_type>::__type
+  count(const _Kt &__x) const {
+    return _M_h._M_find_tr(__x) == _M_h.end() ? 0 : 1;
+  }
+
+  AICUDA_HD size_type bucket_count() const { return _M_h.bucket_count(); }
+
+  AICUDA_HD float load_factor() const { return _M_h.load_factor(); }
+
+  AICUDA_HD float max_load_factor() const { return _M_h.max_load_factor(); }
+
+  AICUDA_HD void max_load_factor(float __z) { _M_h.max_load_factor(__z); }
+
+  AICUDA_HD void rehash(size_type __n) { _M_h.rehash(__n); }
+
+  AICUDA_HD void reserve(size_type __n) { _M_h.reserve(__n); }
+};
+
+template <typename _Value, typename _Hash, typename _Pred, typename _Alloc>
+AICUDA_HD inline void swap(unordered_set<_Value, _Hash, _Pred, _Alloc> &__x,
+                           unordered_set<_Value, _Hash, _Pred, _Alloc> &__y) {
+  __x.swap(__y);
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_UNORDERED_SET_H_ */
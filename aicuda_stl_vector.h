@@ -25,6 +25,7 @@
 #ifndef _AICUDA_STL_VECTOR_H_
 #define _AICUDA_STL_VECTOR_H_ 1
 
+#include <aicuda_stl_config.h>
 #include <aicuda_stl_allocator.h>
 #include <aicuda_stl_construct.h>
 #include <aicuda_stl_function.h>
@@ -44,10 +45,10 @@ struct _Vector_base {
     typename _Tp_alloc_type::pointer _M_finish;
     typename _Tp_alloc_type::pointer _M_end_of_storage;
 
-    __device__ _Vector_impl()
+    AICUDA_HD _Vector_impl()
         : _Tp_alloc_type(), _M_start(0), _M_finish(0), _M_end_of_storage(0) {}
 
-    __device__ _Vector_impl(_Tp_alloc_type const &__a)
+    AICUDA_HD _Vector_impl(_Tp_alloc_type const &__a)
         : _Tp_alloc_type(__a),
           _M_start(0),
           _M_finish(0),
@@ -57,30 +58,30 @@ struct _Vector_base {
  public:
   typedef _Alloc allocator_type;
 
-  __device__ _Tp_alloc_type &_M_get_Tp_allocator() {
+  AICUDA_HD _Tp_alloc_type &_M_get_Tp_allocator() {
     return *static_cast<_Tp_alloc_type *>(&this->_M_impl);
   }
 
-  __device__ const _Tp_alloc_type &_M_get_Tp_allocator() const {
+  AICUDA_HD const _Tp_alloc_type &_M_get_Tp_allocator() const {
     return *static_cast<const _Tp_alloc_type *>(&this->_M_impl);
   }
 
-  __device__ allocator_type get_allocator() const {
+  AICUDA_HD allocator_type get_allocator() const {
     return allocator_type(_M_get_Tp_allocator());
   }
 
-  __device__ _Vector_base() : _M_impl() {}
+  AICUDA_HD _Vector_base() : _M_impl() {}
 
-  __device__ _Vector_base(const allocator_type &__a) : _M_impl(__a) {}
+  AICUDA_HD _Vector_base(const allocator_type &__a) : _M_impl(__a) {}
 
-  __device__ _Vector_base(size_t __n, const allocator_type &__a)
+  AICUDA_HD _Vector_base(size_t __n, const allocator_type &__a)
       : _M_impl(__a) {
     this->_M_impl._M_start = this->_M_allocate(__n);
     this->_M_impl._M_finish = this->_M_impl._M_start;
     this->_M_impl._M_end_of_storage = this->_M_impl._M_start + __n;
   }
 
-  __device__ ~_Vector_base() {
+  AICUDA_HD ~_Vector_base() {
     _M_deallocate(this->_M_impl._M_start,
                   this->_M_impl._M_end_of_storage - this->_M_impl._M_start);
   }
@@ -88,12 +89,12 @@ struct _Vector_base {
  public:
   _Vector_impl _M_impl;
 
-  typename _Tp_alloc_type::pointer __device__ _M_allocate(size_t __n) {
+  typename _Tp_alloc_type::pointer AICUDA_HD _M_allocate(size_t __n) {
     return __n != 0 ? _M_impl.allocate(__n) : 0;
   }
 
-  __device__ void _M_deallocate(typename _Tp_alloc_type::pointer __p,
-                                size_t __n) {
+  AICUDA_HD void _M_deallocate(typename _Tp_alloc_type::pointer __p,
+                               size_t __n) {
     if (__p) _M_impl.deallocate(__p, __n);
   }
 };
@@ -126,45 +127,45 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
   using _Base::_M_impl;
 
  public:
-  __device__ vector() : _Base() {}
+  AICUDA_HD vector() : _Base() {}
 
-  __device__ explicit vector(const allocator_type &__a) : _Base(__a) {}
+  AICUDA_HD explicit vector(const allocator_type &__a) : _Base(__a) {}
 
-  __device__ explicit vector(size_type __n,
-                             const value_type &__value = value_type(),
-                             const allocator_type &__a = allocator_type())
+  AICUDA_HD explicit vector(size_type __n,
+                            const value_type &__value = value_type(),
+                            const allocator_type &__a = allocator_type())
       : _Base(__n, __a) {
     _M_fill_initialize(__n, __value);
   }
 
-  __device__ vector(const vector &__x)
+  AICUDA_HD vector(const vector &__x)
       : _Base(__x.size(), __x._M_get_Tp_allocator()) {
     this->_M_impl._M_finish = aicuda::stl::__uninitialized_copy_a(
         __x.begin(), __x.end(), this->_M_impl._M_start, _M_get_Tp_allocator());
   }
 
   template <typename _InputIterator>
-  __device__ vector(_InputIterator __first, _InputIterator __last,
-                    const allocator_type &__a = allocator_type())
+  AICUDA_HD vector(_InputIterator __first, _InputIterator __last,
+                   const allocator_type &__a = allocator_type())
       : _Base(__a) {
     typedef
         typename aicuda::stl::__is_integer<_InputIterator>::__type _Integral;
     _M_initialize_dispatch(__first, __last, _Integral());
   }
 
-  __device__ ~vector() {
+  AICUDA_HD ~vector() {
     aicuda::stl::_Destroy(this->_M_impl._M_start, this->_M_impl._M_finish,
                           _M_get_Tp_allocator());
   }
 
-  __device__ vector &operator=(const vector &__x);
+  AICUDA_HD vector &operator=(const vector &__x);
 
-  __device__ void assign(size_type __n, const value_type &__val) {
+  AICUDA_HD void assign(size_type __n, const value_type &__val) {
     _M_fill_assign(__n, __val);
   }
 
   template <typename _InputIterator>
-  __device__ void assign(_InputIterator __first, _InputIterator __last) {
+  AICUDA_HD void assign(_InputIterator __first, _InputIterator __last) {
     typedef
         typename aicuda::stl::__is_integer<_InputIterator>::__type _Integral;
     _M_assign_dispatch(__first, __last, _Integral());
@@ -172,63 +173,63 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
 
   using _Base::get_allocator;
 
-  __device__ iterator begin() { return iterator(this->_M_impl._M_start); }
+  AICUDA_HD iterator begin() { return iterator(this->_M_impl._M_start); }
 
-  __device__ const_iterator begin() const {
+  AICUDA_HD const_iterator begin() const {
     return const_iterator(this->_M_impl._M_start);
   }
 
-  __device__ iterator end() { return iterator(this->_M_impl._M_finish); }
+  AICUDA_HD iterator end() { return iterator(this->_M_impl._M_finish); }
 
-  __device__ const_iterator end() const {
+  AICUDA_HD const_iterator end() const {
     return const_iterator(this->_M_impl._M_finish);
   }
 
-  __device__ reverse_iterator rbegin() { return reverse_iterator(end()); }
+  AICUDA_HD reverse_iterator rbegin() { return reverse_iterator(end()); }
 
-  __device__ const_reverse_iterator rbegin() const {
+  AICUDA_HD const_reverse_iterator rbegin() const {
     return const_reverse_iterator(end());
   }
 
-  __device__ reverse_iterator rend() { return reverse_iterator(begin()); }
+  AICUDA_HD reverse_iterator rend() { return reverse_iterator(begin()); }
 
-  __device__ const_reverse_iterator rend() const {
+  AICUDA_HD const_reverse_iterator rend() const {
     return const_reverse_iterator(begin());
   }
 
-  __device__ size_type size() const {
+  AICUDA_HD size_type size() const {
     return size_type(this->_M_impl._M_finish - this->_M_impl._M_start);
   }
 
-  __device__ size_type max_size() const {
+  AICUDA_HD size_type max_size() const {
     return _M_get_Tp_allocator().max_size();
   }
 
-  __device__ void resize(size_type __new_size, value_type __x = value_type()) {
+  AICUDA_HD void resize(size_type __new_size, value_type __x = value_type()) {
     if (__new_size < size())
       _M_erase_at_end(this->_M_impl._M_start + __new_size);
     else
       insert(end(), __new_size - size(), __x);
   }
 
-  __device__ size_type capacity() const {
+  AICUDA_HD size_type capacity() const {
     return size_type(this->_M_impl._M_end_of_storage - this->_M_impl._M_start);
   }
 
-  __device__ bool empty() const { return begin() == end(); }
+  AICUDA_HD bool empty() const { return begin() == end(); }
 
-  __device__ void reserve(size_type __n);
+  AICUDA_HD void reserve(size_type __n);
 
-  __device__ reference operator[](size_type __n) {
+  AICUDA_HD reference operator[](size_type __n) {
     return *(this->_M_impl._M_start + __n);
   }
 
-  __device__ const_reference operator[](size_type __n) const {
+  AICUDA_HD const_reference operator[](size_type __n) const {
     return *(this->_M_impl._M_start + __n);
   }
 
  protected:
-  __device__ void _M_range_check(size_type __n) const {
+  AICUDA_HD void _M_range_check(size_type __n) const {
     if (__n >= this->size()) {
       printf("vector::_M_range_check\n");
       assert(1 < 0);
@@ -236,31 +237,31 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
   }
 
  public:
-  __device__ reference at(size_type __n) {
+  AICUDA_HD reference at(size_type __n) {
     _M_range_check(__n);
     return (*this)[__n];
   }
 
-  __device__ const_reference at(size_type __n) const {
+  AICUDA_HD const_reference at(size_type __n) const {
     _M_range_check(__n);
     return (*this)[__n];
   }
 
-  __device__ reference front() { return *begin(); }
+  AICUDA_HD reference front() { return *begin(); }
 
-  __device__ const_reference front() const { return *begin(); }
+  AICUDA_HD const_reference front() const { return *begin(); }
 
-  __device__ reference back() { return *(end() - 1); }
+  AICUDA_HD reference back() { return *(end() - 1); }
 
-  __device__ const_reference back() const { return *(end() - 1); }
+  AICUDA_HD const_reference back() const { return *(end() - 1); }
 
-  __device__ pointer data() { return pointer(this->_M_impl._M_start); }
+  AICUDA_HD pointer data() { return pointer(this->_M_impl._M_start); }
 
-  __device__ const_pointer data() const {
+  AICUDA_HD const_pointer data() const {
     return const_pointer(this->_M_impl._M_start);
   }
 
-  __device__ void push_back(const value_type &__x) {
+  AICUDA_HD void push_back(const value_type &__x) {
     if (this->_M_impl._M_finish != this->_M_impl._M_end_of_storage) {
       this->_M_impl.construct(this->_M_impl._M_finish, __x);
       ++this->_M_impl._M_finish;
@@ -268,31 +269,31 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
       _M_insert_aux(end(), __x);
   }
 
-  __device__ void pop_back() {
+  AICUDA_HD void pop_back() {
     --this->_M_impl._M_finish;
     this->_M_impl.destroy(this->_M_impl._M_finish);
   }
 
-  __device__ iterator insert(iterator __position, const value_type &__x);
+  AICUDA_HD iterator insert(iterator __position, const value_type &__x);
 
-  __device__ void insert(iterator __position, size_type __n,
-                         const value_type &__x) {
+  AICUDA_HD void insert(iterator __position, size_type __n,
+                        const value_type &__x) {
     _M_fill_insert(__position, __n, __x);
   }
 
   template <typename _InputIterator>
-  __device__ void insert(iterator __position, _InputIterator __first,
-                         _InputIterator __last) {
+  AICUDA_HD void insert(iterator __position, _InputIterator __first,
+                        _InputIterator __last) {
     typedef
         typename aicuda::stl::__is_integer<_InputIterator>::__type _Integral;
     _M_insert_dispatch(__position, __first, __last, _Integral());
   }
 
-  __device__ iterator erase(iterator __position);
+  AICUDA_HD iterator erase(iterator __position);
 
-  __device__ iterator erase(iterator __first, iterator __last);
+  AICUDA_HD iterator erase(iterator __first, iterator __last);
 
-  __device__ void swap(vector &__x) {
+  AICUDA_HD void swap(vector &__x) {
     aicuda::stl::swap(this->_M_impl._M_start, __x._M_impl._M_start);
     aicuda::stl::swap(this->_M_impl._M_finish, __x._M_impl._M_finish);
     aicuda::stl::swap(this->_M_impl._M_end_of_storage,
@@ -302,13 +303,13 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
         _M_get_Tp_allocator(), __x._M_get_Tp_allocator());
   }
 
-  __device__ void clear() { _M_erase_at_end(this->_M_impl._M_start); }
+  AICUDA_HD void clear() { _M_erase_at_end(this->_M_impl._M_start); }
 
  protected:
   template <typename _ForwardIterator>
-  __device__ pointer _M_allocate_and_copy(size_type __n,
-                                          _ForwardIterator __first,
-                                          _ForwardIterator __last) {
+  AICUDA_HD pointer _M_allocate_and_copy(size_type __n,
+                                         _ForwardIterator __first,
+                                         _ForwardIterator __last) {
     pointer __result = this->_M_allocate(__n);
 
     aicuda::stl::__uninitialized_copy_a(__first, __last, __result,
@@ -317,8 +318,8 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
   }
 
   template <typename _Integer>
-  __device__ void _M_initialize_dispatch(_Integer __n, _Integer __value,
-                                         __true_type) {
+  AICUDA_HD void _M_initialize_dispatch(_Integer __n, _Integer __value,
+                                        __true_type) {
     this->_M_impl._M_start = _M_allocate(static_cast<size_type>(__n));
     this->_M_impl._M_end_of_storage =
         this->_M_impl._M_start + static_cast<size_type>(__n);
@@ -326,8 +327,8 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
   }
 
   template <typename _InputIterator>
-  __device__ void _M_initialize_dispatch(_InputIterator __first,
-                                         _InputIterator __last, __false_type) {
+  AICUDA_HD void _M_initialize_dispatch(_InputIterator __first,
+                                        _InputIterator __last, __false_type) {
     typedef
         typename aicuda::stl::iterator_traits<_InputIterator>::iterator_category
             _IterCategory;
@@ -335,16 +336,16 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
   }
 
   template <typename _InputIterator>
-  __device__ void _M_range_initialize(_InputIterator __first,
-                                      _InputIterator __last,
-                                      aicuda::stl::input_iterator_tag) {
+  AICUDA_HD void _M_range_initialize(_InputIterator __first,
+                                     _InputIterator __last,
+                                     aicuda::stl::input_iterator_tag) {
     for (; __first != __last; ++__first) push_back(*__first);
   }
 
   template <typename _ForwardIterator>
-  __device__ void _M_range_initialize(_ForwardIterator __first,
-                                      _ForwardIterator __last,
-                                      aicuda::stl::forward_iterator_tag) {
+  AICUDA_HD void _M_range_initialize(_ForwardIterator __first,
+                                     _ForwardIterator __last,
+                                     aicuda::stl::forward_iterator_tag) {
     const size_type __n = aicuda::stl::distance(__first, __last);
     this->_M_impl._M_start = this->_M_allocate(__n);
     this->_M_impl._M_end_of_storage = this->_M_impl._M_start + __n;
@@ -352,21 +353,21 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
         __first, __last, this->_M_impl._M_start, _M_get_Tp_allocator());
   }
 
-  __device__ void _M_fill_initialize(size_type __n, const value_type &__value) {
+  AICUDA_HD void _M_fill_initialize(size_type __n, const value_type &__value) {
     aicuda::stl::__uninitialized_fill_n_a(this->_M_impl._M_start, __n, __value,
                                           _M_get_Tp_allocator());
     this->_M_impl._M_finish = this->_M_impl._M_end_of_storage;
   }
 
   template <typename _Integer>
-  __device__ void _M_assign_dispatch(_Integer __n, _Integer __val,
-                                     __true_type) {
+  AICUDA_HD void _M_assign_dispatch(_Integer __n, _Integer __val,
+                                    __true_type) {
     _M_fill_assign(__n, __val);
   }
 
   template <typename _InputIterator>
-  __device__ void _M_assign_dispatch(_InputIterator __first,
-                                     _InputIterator __last, __false_type) {
+  AICUDA_HD void _M_assign_dispatch(_InputIterator __first,
+                                    _InputIterator __last, __false_type) {
     typedef
         typename aicuda::stl::iterator_traits<_InputIterator>::iterator_category
             _IterCategory;
@@ -374,25 +375,25 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
   }
 
   template <typename _InputIterator>
-  __device__ void _M_assign_aux(_InputIterator __first, _InputIterator __last,
-                                aicuda::stl::input_iterator_tag);
+  AICUDA_HD void _M_assign_aux(_InputIterator __first, _InputIterator __last,
+                               aicuda::stl::input_iterator_tag);
 
   template <typename _ForwardIterator>
-  __device__ void _M_assign_aux(_ForwardIterator __first,
-                                _ForwardIterator __last,
-                                aicuda::stl::forward_iterator_tag);
+  AICUDA_HD void _M_assign_aux(_ForwardIterator __first,
+                               _ForwardIterator __last,
+                               aicuda::stl::forward_iterator_tag);
 
-  __device__ void _M_fill_assign(size_type __n, const value_type &__val);
+  AICUDA_HD void _M_fill_assign(size_type __n, const value_type &__val);
 
   template <typename _Integer>
-  __device__ void _M_insert_dispatch(iterator __pos, _Integer __n,
-                                     _Integer __val, __true_type) {
+  AICUDA_HD void _M_insert_dispatch(iterator __pos, _Integer __n,
+                                    _Integer __val, __true_type) {
     _M_fill_insert(__pos, __n, __val);
   }
 
   template <typename _InputIterator>
-  __device__ void _M_insert_dispatch(iterator __pos, _InputIterator __first,
-                                     _InputIterator __last, __false_type) {
+  AICUDA_HD void _M_insert_dispatch(iterator __pos, _InputIterator __first,
+                                    _InputIterator __last, __false_type) {
     typedef
         typename aicuda::stl::iterator_traits<_InputIterator>::iterator_category
             _IterCategory;
@@ -400,21 +401,21 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
   }
 
   template <typename _InputIterator>
-  __device__ void _M_range_insert(iterator __pos, _InputIterator __first,
-                                  _InputIterator __last,
-                                  aicuda::stl::input_iterator_tag);
+  AICUDA_HD void _M_range_insert(iterator __pos, _InputIterator __first,
+                                 _InputIterator __last,
+                                 aicuda::stl::input_iterator_tag);
 
   template <typename _ForwardIterator>
-  __device__ void _M_range_insert(iterator __pos, _ForwardIterator __first,
-                                  _ForwardIterator __last,
-                                  aicuda::stl::forward_iterator_tag);
+  AICUDA_HD void _M_range_insert(iterator __pos, _ForwardIterator __first,
+                                 _ForwardIterator __last,
+                                 aicuda::stl::forward_iterator_tag);
 
-  __device__ void _M_fill_insert(iterator __pos, size_type __n,
-                                 const value_type &__x);
+  AICUDA_HD void _M_fill_insert(iterator __pos, size_type __n,
+                                const value_type &__x);
 
-  __device__ void _M_insert_aux(iterator __position, const value_type &__x);
+  AICUDA_HD void _M_insert_aux(iterator __position, const value_type &__x);
 
-  __device__ size_type _M_check_len(size_type __n, const char *__s) const {
+  AICUDA_HD size_type _M_check_len(size_type __n, const char *__s) const {
     if (max_size() - size() < __n) {
       printf("check len failed : %s \n", __s);
       assert(1 < 0);
@@ -424,7 +425,7 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
     return (__len < size() || __len > max_size()) ? max_size() : __len;
   }
 
-  __device__ void _M_erase_at_end(pointer __pos) {
+  AICUDA_HD void _M_erase_at_end(pointer __pos) {
     aicuda::stl::_Destroy(__pos, this->_M_impl._M_finish,
                           _M_get_Tp_allocator());
     this->_M_impl._M_finish = __pos;
@@ -432,13 +433,13 @@ class vector : protected _Vector_base<_Tp, _Alloc> {
 };
 
 template <typename _Tp, typename _Alloc>
-__device__ inline void swap(vector<_Tp, _Alloc> &__x,
-                            vector<_Tp, _Alloc> &__y) {
+AICUDA_HD inline void swap(vector<_Tp, _Alloc> &__x,
+                           vector<_Tp, _Alloc> &__y) {
   __x.swap(__y);
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void vector<_Tp, _Alloc>::reserve(size_type __n) {
+AICUDA_HD void vector<_Tp, _Alloc>::reserve(size_type __n) {
   if (__n > this->max_size()) {
     printf("vector::reserve \n");
     assert(1 < 0);
@@ -459,8 +460,8 @@ __device__ void vector<_Tp, _Alloc>::reserve(size_type __n) {
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ typename vector<_Tp, _Alloc>::iterator vector<_Tp, _Alloc>::insert(
-    iterator __position, const value_type &__x) {
+AICUDA_HD typename vector<_Tp, _Alloc>::iterator vector<_Tp, _Alloc>::insert(
+   iterator __position, const value_type &__x) {
   const size_type __n = __position - begin();
   if (this->_M_impl._M_finish != this->_M_impl._M_end_of_storage &&
       __position == end()) {
@@ -473,8 +474,8 @@ __device__ typename vector<_Tp, _Alloc>::iterator vector<_Tp, _Alloc>::insert(
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ typename vector<_Tp, _Alloc>::iterator vector<_Tp, _Alloc>::erase(
-    iterator __position) {
+AICUDA_HD typename vector<_Tp, _Alloc>::iterator vector<_Tp, _Alloc>::erase(
+   iterator __position) {
   if (__position + 1 != end())
     aicuda::stl::copy(__position + 1, end(), __position);
   --this->_M_impl._M_finish;
@@ -483,16 +484,16 @@ __device__ typename vector<_Tp, _Alloc>::iterator vector<_Tp, _Alloc>::erase(
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ typename vector<_Tp, _Alloc>::iterator vector<_Tp, _Alloc>::erase(
-    iterator __first, iterator __last) {
+AICUDA_HD typename vector<_Tp, _Alloc>::iterator vector<_Tp, _Alloc>::erase(
+   iterator __first, iterator __last) {
   if (__last != end()) aicuda::stl::copy(__last, end(), __first);
   _M_erase_at_end(__first.base() + (end() - __last));
   return __first;
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ vector<_Tp, _Alloc> &vector<_Tp, _Alloc>::operator=(
-    const vector<_Tp, _Alloc> &__x) {
+AICUDA_HD vector<_Tp, _Alloc> &vector<_Tp, _Alloc>::operator=(
+   const vector<_Tp, _Alloc> &__x) {
   if (&__x != this) {
     const size_type __xlen = __x.size();
     if (__xlen > capacity()) {
@@ -519,8 +520,8 @@ __device__ vector<_Tp, _Alloc> &vector<_Tp, _Alloc>::operator=(
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void vector<_Tp, _Alloc>::_M_fill_assign(size_t __n,
-                                                    const value_type &__val) {
+AICUDA_HD void vector<_Tp, _Alloc>::_M_fill_assign(size_t __n,
+                                                   const value_type &__val) {
   if (__n > capacity()) {
     vector __tmp(__n, __val, _M_get_Tp_allocator());
     __tmp.swap(*this);
@@ -535,9 +536,9 @@ __device__ void vector<_Tp, _Alloc>::_M_fill_assign(size_t __n,
 
 template <typename _Tp, typename _Alloc>
 template <typename _InputIterator>
-__device__ void vector<_Tp, _Alloc>::_M_assign_aux(
-    _InputIterator __first, _InputIterator __last,
-    aicuda::stl::input_iterator_tag) {
+AICUDA_HD void vector<_Tp, _Alloc>::_M_assign_aux(
+   _InputIterator __first, _InputIterator __last,
+   aicuda::stl::input_iterator_tag) {
   pointer __cur(this->_M_impl._M_start);
   for (; __first != __last && __cur != this->_M_impl._M_finish;
        ++__cur, ++__first)
@@ -550,9 +551,9 @@ __device__ void vector<_Tp, _Alloc>::_M_assign_aux(
 
 template <typename _Tp, typename _Alloc>
 template <typename _ForwardIterator>
-__device__ void vector<_Tp, _Alloc>::_M_assign_aux(
-    _ForwardIterator __first, _ForwardIterator __last,
-    aicuda::stl::forward_iterator_tag) {
+AICUDA_HD void vector<_Tp, _Alloc>::_M_assign_aux(
+   _ForwardIterator __first, _ForwardIterator __last,
+   aicuda::stl::forward_iterator_tag) {
   const size_type __len = aicuda::stl::distance(__first, __last);
 
   if (__len > capacity()) {
@@ -576,8 +577,8 @@ __device__ void vector<_Tp, _Alloc>::_M_assign_aux(
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void vector<_Tp, _Alloc>::_M_insert_aux(iterator __position,
-                                                   const _Tp &__x)
+AICUDA_HD void vector<_Tp, _Alloc>::_M_insert_aux(iterator __position,
+                                                  const _Tp &__x)
 
 {
   if (this->_M_impl._M_finish != this->_M_impl._M_end_of_storage) {
@@ -623,9 +624,9 @@ __device__ void vector<_Tp, _Alloc>::_M_insert_aux(iterator __position,
 }
 
 template <typename _Tp, typename _Alloc>
-__device__ void vector<_Tp, _Alloc>::_M_fill_insert(iterator __position,
-                                                    size_type __n,
-                                                    const value_type &__x) {
+AICUDA_HD void vector<_Tp, _Alloc>::_M_fill_insert(iterator __position,
+                                                   size_type __n,
+                                                   const value_type &__x) {
   if (__n != 0) {
     if (size_type(this->_M_impl._M_end_of_storage - this->_M_impl._M_finish) >=
         __n) {
@@ -683,9 +684,9 @@ __device__ void vector<_Tp, _Alloc>::_M_fill_insert(iterator __position,
 
 template <typename _Tp, typename _Alloc>
 template <typename _InputIterator>
-__device__ void vector<_Tp, _Alloc>::_M_range_insert(
-    iterator __pos, _InputIterator __first, _InputIterator __last,
-    aicuda::stl::input_iterator_tag) {
+AICUDA_HD void vector<_Tp, _Alloc>::_M_range_insert(
+   iterator __pos, _InputIterator __first, _InputIterator __last,
+   aicuda::stl::input_iterator_tag) {
   for (; __first != __last; ++__first) {
     __pos = insert(__pos, *__first);
     ++__pos;
@@ -694,9 +695,9 @@ __device__ void vector<_Tp, _Alloc>::_M_range_insert(
 
 template <typename _Tp, typename _Alloc>
 template <typename _ForwardIterator>
-__device__ void vector<_Tp, _Alloc>::_M_range_insert(
-    iterator __position, _ForwardIterator __first, _ForwardIterator __last,
-    aicuda::stl::forward_iterator_tag) {
+AICUDA_HD void vector<_Tp, _Alloc>::_M_range_insert(
+   iterator __position, _ForwardIterator __first, _ForwardIterator __last,
+   aicuda::stl::forward_iterator_tag) {
   if (__first != __last) {
     const size_type __n = aicuda::stl::distance(__first, __last);
     if (size_type(this->_M_impl._M_end_of_storage - this->_M_impl._M_finish) >=
@@ -0,0 +1,164 @@
+// Components for manipulating sequences of characters -*- C++ -*-
+
+// Copyright (C) 1997-2015 Free Software Foundation, Inc.
+//
+// This file is part of the GNU ISO C++ Library.  This library is free
+// software; you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 3, or (at your option)
+// any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.  If not, see
+// <http://www.gnu.org/licenses/>.
+
+#ifndef _AICUDA_STL_WARP_ALLOCATOR_H_
+#define _AICUDA_STL_WARP_ALLOCATOR_H_ 1
+
+#include <aicuda_stl_atomic.h>
+#include <aicuda_stl_config.h>
+#include <stddef.h>
+
+namespace aicuda {
+namespace stl {
+
+// Warp-aggregated allocation.  On the device, the lanes of a warp that
+// allocate together sum their requests, one lane takes a single block from
+// the device heap and every lane gets its slice of it, so a warp costs one
+// heap call instead of up to 32 serialized ones.  The block carries a
+// reference count and is returned to the heap when its last slice is freed.
+// Host code runs the same bookkeeping with a warp of one lane.
+//
+// warp_allocator<T> selects this per container; defining
+// AICUDA_STL_WARP_AGGREGATED_ALLOC makes aicuda::stl::allocator use it too.
+
+enum { _S_warp_slice_align = 16 };
+
+struct __warp_block {
+  int _M_refs;
+};
+
+AICUDA_HD inline void *__warp_aggregated_allocate(size_t __bytes) {
+  const size_t __slice =
+      _S_warp_slice_align +
+      ((__bytes + _S_warp_slice_align - 1) & ~size_t(_S_warp_slice_align - 1));
+#if AICUDA_DEVICE_CODE
+  const unsigned __mask = __activemask();
+  unsigned __lane;
+  asm volatile("mov.u32 %0, %%laneid;" : "=r"(__lane));
+  const int __leader = __ffs(__mask) - 1;
+
+  unsigned long long __offset = 0;
+  unsigned long long __total = 0;
+  for (unsigned __m = __mask; __m; __m &= __m - 1) {
+    const int __src = __ffs(__m) - 1;
+    const unsigned long long __b =
+        __shfl_sync(__mask, (unsigned long long)__slice, __src);
+    if (__src < int(__lane)) __offset += __b;
+    __total += __b;
+  }
+
+  unsigned long long __base = 0;
+  if (int(__lane) == __leader) {
+    void *__blk = ::operator new(_S_warp_slice_align + __total);
+    if (__blk) static_cast<__warp_block *>(__blk)->_M_refs = __popc(__mask);
+    __base = reinterpret_cast<unsigned long long>(__blk);
+  }
+  __base = __shfl_sync(__mask, __base, __leader);
+  char *__block = reinterpret_cast<char *>(__base);
+#else
+  const size_t __offset = 0;
+  char *__block =
+      static_cast<char *>(::operator new(_S_warp_slice_align + __slice));
+  if (__block) reinterpret_cast<__warp_block *>(__block)->_M_refs = 1;
+#endif
+  if (!__block) return 0;
+
+  char *__p = __block + _S_warp_slice_align + __offset;
+  *reinterpret_cast<char **>(__p) = __block;
+  return __p + _S_warp_slice_align;
+}
+
+AICUDA_HD inline void __warp_aggregated_deallocate(void *__p) {
+  if (!__p) return;
+  char *__block =
+      *reinterpret_cast<char **>(static_cast<char *>(__p) - _S_warp_slice_align);
+  if (__exchange_and_add(&reinterpret_cast<__warp_block *>(__block)->_M_refs,
+                         -1) == 1)
+    ::operator delete(__block);
+}
+
+template <typename _Tp>
+class warp_allocator {
+ public:
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  typedef _Tp *pointer;
+  typedef const _Tp *const_pointer;
+  typedef _Tp &reference;
+  typedef const _Tp &const_reference;
+  typedef _Tp value_type;
+
+  template <typename _Tp1>
+  struct rebind {
+    typedef warp_allocator<_Tp1> other;
+  };
+
+  AICUDA_HD warp_allocator() {}
+
+  AICUDA_HD warp_allocator(const warp_allocator &) {}
+
+  template <typename _Tp1>
+  AICUDA_HD warp_allocator(const warp_allocator<_Tp1> &) {}
+
+  AICUDA_HD ~warp_allocator() {}
+
+  AICUDA_HD pointer address(reference __x) const { return &__x; }
+
+  AICUDA_HD const_pointer address(const_reference __x) const { return &__x; }
+
+  AICUDA_HD pointer allocate(size_type __n, const void * = 0) {
+    return static_cast<_Tp *>(__warp_aggregated_allocate(__n * sizeof(_Tp)));
+  }
+
+  AICUDA_HD void deallocate(pointer __p, size_type) {
+    __warp_aggregated_deallocate(__p);
+  }
+
+  AICUDA_HD void construct(pointer __p, const _Tp &__val) {
+    ::new ((void *)__p) _Tp(__val);
+  }
+
+  AICUDA_HD constexpr size_type max_size() const {
+    return size_t(-1) / sizeof(_Tp);
+  }
+
+  AICUDA_HD void destroy(pointer __p) { __p->~_Tp(); }
+};
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator==(const warp_allocator<_T1> &,
+                                 const warp_allocator<_T2> &) {
+  return true;
+}
+
+template <typename _T1, typename _T2>
+AICUDA_HD inline bool operator!=(const warp_allocator<_T1> &,
+                                 const warp_allocator<_T2> &) {
+  return false;
+}
+
+}  // namespace stl
+}  // namespace aicuda
+
+#endif /* _AICUDA_STL_WARP_ALLOCATOR_H_ */
@@ -0,0 +1,1276 @@
+// Host benchmark for aicuda::stl against libstdc++.
+//
+// Build (no GPU required):
+//   g++ -O2 -std=c++11 -pthread -I. bench.cpp -o bench
+// Adding -DAICUDA_STL_WARP_AGGREGATED_ALLOC routes every aicuda::stl::allocator
+// row through the warp-aggregated allocator's host path.
+// Run:
+//   ./bench [--json] [--max N] [--filter SUBSTR]
+//
+// Every benchmark is run for sizes 10, 100, ... up to --max (default 10^6)
+// and emits one record per (benchmark, impl, size) with the time per
+// operation, the heap traffic of one run and its peak memory footprint, as
+// CSV (default) or JSON lines.
+
+#include <aicuda_stl_arena_allocator.h>
+#include <aicuda_stl_btree_map.h>
+#include <aicuda_stl_btree_set.h>
+#include <aicuda_stl_charconv.h>
+#include <aicuda_stl_concurrent_hash_map.h>
+#include <aicuda_stl_flat_map.h>
+#include <aicuda_stl_hash.h>
+#include <aicuda_stl_list.h>
+#include <aicuda_stl_map.h>
+#include <aicuda_stl_pool_allocator.h>
+#include <aicuda_stl_region_allocator.h>
+#include <aicuda_stl_set.h>
+#include <aicuda_stl_shared_allocator.h>
+#include <aicuda_stl_split.h>
+#include <aicuda_stl_string.h>
+#include <aicuda_stl_string_view.h>
+#include <aicuda_stl_unordered_map.h>
+#include <aicuda_stl_vector.h>
+
+#include <chrono>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <malloc.h>
+#include <math.h>
+#include <string.h>
+
+// Heap counters are updated atomically so the multi-threaded cases can share
+// them; the peak is tracked loosely (a racing update may be lost).
+static size_t g_alloc_bytes = 0;
+static size_t g_alloc_count = 0;
+static size_t g_live_bytes = 0;
+static size_t g_peak_bytes = 0;
+
+void *operator new(size_t __n) {
+  void *__p = malloc(__n ? __n : 1);
+  if (!__p) abort();
+  __atomic_fetch_add(&g_alloc_bytes, __n, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&g_alloc_count, 1, __ATOMIC_RELAXED);
+  const size_t __live =
+      __atomic_add_fetch(&g_live_bytes, malloc_usable_size(__p), __ATOMIC_RELAXED);
+  if (__live > __atomic_load_n(&g_peak_bytes, __ATOMIC_RELAXED))
+    __atomic_store_n(&g_peak_bytes, __live, __ATOMIC_RELAXED);
+  return __p;
+}
+
+// Kept out of line: once inlined, GCC flags the free() of memory that came
+// from operator new.
+__attribute__((noinline)) void operator delete(void *__p) noexcept {
+  if (__p)
+    __atomic_fetch_sub(&g_live_bytes, malloc_usable_size(__p), __ATOMIC_RELAXED);
+  free(__p);
+}
+
+void operator delete(void *__p, size_t) noexcept { operator delete(__p); }
+
+static volatile size_t g_sink;
+
+class meter {
+ public:
+  meter() : _M_ns(0), _M_bytes(0), _M_allocs(0), _M_ops(0), _M_peak(0) {}
+
+  void start() {
+    _M_bytes0 = g_alloc_bytes;
+    _M_allocs0 = g_alloc_count;
+    _M_live0 = g_live_bytes;
+    g_peak_bytes = g_live_bytes;
+    _M_t0 = std::chrono::steady_clock::now();
+  }
+
+  void stop(size_t __ops) {
+    std::chrono::steady_clock::time_point __t1 =
+        std::chrono::steady_clock::now();
+    _M_ns += std::chrono::duration<double, std::nano>(__t1 - _M_t0).count();
+    _M_bytes += g_alloc_bytes - _M_bytes0;
+    _M_allocs += g_alloc_count - _M_allocs0;
+    _M_ops += __ops;
+    footprint(g_peak_bytes - _M_live0);
+  }
+
+  // Memory that backs a run outside the global heap (e.g. a region's carved
+  // high-water mark) is reported here.
+  void footprint(size_t __bytes) {
+    if (__bytes > _M_peak) _M_peak = __bytes;
+  }
+
+  double _M_ns;
+  size_t _M_bytes;
+  size_t _M_allocs;
+  size_t _M_ops;
+  size_t _M_peak;
+
+ private:
+  std::chrono::steady_clock::time_point _M_t0;
+  size_t _M_bytes0;
+  size_t _M_allocs0;
+  size_t _M_live0;
+};
+
+// Keys are a fixed pseudo-random permutation so every implementation sees
+// the same insertion order.
+static std::vector<int> make_keys(size_t __n) {
+  std::vector<int> __keys(__n);
+  for (size_t __i = 0; __i < __n; ++__i) __keys[__i] = int(__i);
+  unsigned long long __s = 88172645463325252ULL;
+  for (size_t __i = __n; __i > 1; --__i) {
+    __s ^= __s << 13;
+    __s ^= __s >> 7;
+    __s ^= __s << 17;
+    size_t __j = size_t(__s % __i);
+    int __t = __keys[__i - 1];
+    __keys[__i - 1] = __keys[__j];
+    __keys[__j] = __t;
+  }
+  return __keys;
+}
+
+template <typename _Vector>
+static void bench_vector_push_back(const int *__keys, size_t __n, meter &__m) {
+  __m.start();
+  {
+    _Vector __v;
+    for (size_t __i = 0; __i < __n; ++__i) __v.push_back(__keys[__i]);
+    g_sink = __v.size();
+  }
+  __m.stop(__n);
+}
+
+template <typename _Vector>
+static void bench_vector_copy(const int *__keys, size_t __n, meter &__m) {
+  _Vector __src;
+  for (size_t __i = 0; __i < __n; ++__i) __src.push_back(__keys[__i]);
+  __m.start();
+  {
+    _Vector __v(__src);
+    g_sink = __v.size();
+  }
+  __m.stop(__n);
+}
+
+template <typename _Vector, int _Value>
+static void bench_vector_fill(const int *, size_t __n, meter &__m) {
+  __m.start();
+  {
+    _Vector __v(__n, _Value);
+    __v.resize(2 * __n, _Value);
+    g_sink = __v.size();
+  }
+  __m.stop(2 * __n);
+}
+
+template <typename _Map>
+static void bench_map_subscript(const int *__keys, size_t __n, meter &__m) {
+  __m.start();
+  {
+    _Map __mp;
+    for (size_t __i = 0; __i < __n; ++__i) __mp[__keys[__i]] = int(__i);
+    g_sink = __mp.size();
+  }
+  __m.stop(__n);
+}
+
+// Nodes go to a 16 KiB shared_arena, a host stand-in for a block's
+// __shared__ buffer, and spill to the heap once it is full.  The arena must
+// stay within its capacity, count what spilled, and hand every spilled node
+// back to the heap rather than to itself.
+template <typename _Map>
+static void bench_map_subscript_shared(const int *__keys, size_t __n,
+                                       meter &__m) {
+  typedef typename _Map::allocator_type _Alloc;
+  static unsigned long long __buf[2048];
+  aicuda::stl::shared_arena __sa(__buf, sizeof(__buf));
+  const size_t __live0 = g_live_bytes;
+  bool __ok = true;
+  __m.start();
+  {
+    _Map __mp((typename _Map::key_compare()), _Alloc(__sa));
+    for (size_t __i = 0; __i < __n; ++__i) __mp[__keys[__i]] = int(__i);
+    g_sink = __mp.size();
+    __ok = __sa.used() <= __sa.capacity() &&
+           (__n * sizeof(typename _Map::value_type) <= __sa.capacity() ||
+            __sa.spilled() != 0);
+  }
+  __m.stop(__n);
+  if (!__ok || __sa.spilled() != 0 || g_live_bytes != __live0) {
+    fprintf(stderr,
+            "map_subscript_shared: used %zu of %zu, %zu bytes left spilled, "
+            "%zu not returned to the heap\n",
+            __sa.used(), __sa.capacity(), __sa.spilled(),
+            g_live_bytes - __live0);
+    abort();
+  }
+}
+
+template <typename _Map>
+static void bench_map_subscript_arena(const int *__keys, size_t __n,
+                                      meter &__m) {
+  typedef typename _Map::allocator_type _Alloc;
+  static char *__buf = 0;
+  static size_t __buf_size = 0;
+  if (__buf_size < __n * 64) {
+    free(__buf);
+    __buf_size = __n * 64;
+    __buf = static_cast<char *>(malloc(__buf_size));
+  }
+  aicuda::stl::arena __ar(__buf, __buf_size);
+  __m.start();
+  {
+    _Map __mp((typename _Map::key_compare()), _Alloc(__ar));
+    for (size_t __i = 0; __i < __n; ++__i) __mp[__keys[__i]] = int(__i);
+    g_sink = __mp.size();
+  }
+  __m.stop(__n);
+}
+
+template <typename _Map>
+static void bench_map_find(const int *__keys, size_t __n, meter &__m) {
+  _Map __mp;
+  for (size_t __i = 0; __i < __n; ++__i) __mp[__keys[__i]] = int(__i);
+  size_t __hits = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i)
+    __hits += __mp.find(int(__i)) != __mp.end();
+  __m.stop(__n);
+  g_sink = __hits;
+}
+
+// Subscript whose key argument is a value stored in the same map: every
+// entry maps to the next key, which is looked up and inserted in place, so
+// an insert that grows the table still has to read the old key.
+template <typename _Map>
+static void bench_map_subscript_chain(const int *__keys, size_t __n,
+                                      meter &__m) {
+  _Map __mp;
+  __mp[-1] = __keys[0];
+  int __prev = -1;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i) {
+    const int &__k = __mp.find(__prev)->second;
+    __prev = __k;
+    __mp[__k] = __i + 1 < __n ? __keys[__i + 1] : -1;
+  }
+  __m.stop(__n);
+  __prev = -1;
+  for (size_t __i = 0; __i < __n; ++__i) {
+    __prev = __mp.find(__prev)->second;
+    if (__prev != __keys[__i] || __mp.size() != __n + 1) {
+      fprintf(stderr, "map_subscript_chain: chain broken at %zu\n", __i);
+      abort();
+    }
+  }
+  g_sink = __mp.size();
+}
+
+// Input iterator over (keys[i], i) pairs, so every map type can be bulk
+// built from the same input without an intermediate copy.
+template <typename _Value>
+struct pair_source {
+  typedef std::input_iterator_tag iterator_category;
+  typedef _Value value_type;
+  typedef ptrdiff_t difference_type;
+  typedef const _Value *pointer;
+  typedef _Value reference;
+
+  const int *_M_keys;
+  size_t _M_i;
+
+  _Value operator*() const { return _Value(_M_keys[_M_i], int(_M_i)); }
+  pair_source &operator++() {
+    ++_M_i;
+    return *this;
+  }
+  bool operator==(const pair_source &__x) const { return _M_i == __x._M_i; }
+  bool operator!=(const pair_source &__x) const { return _M_i != __x._M_i; }
+};
+
+// Bulk construction from unsorted input; the peak column shows the memory
+// per entry.
+template <typename _Map>
+static void bench_map_bulk_build(const int *__keys, size_t __n, meter &__m) {
+  typedef pair_source<typename _Map::value_type> _Source;
+  const _Source __first = {__keys, 0}, __last = {__keys, __n};
+  __m.start();
+  {
+    _Map __mp(__first, __last);
+    g_sink = __mp.size();
+  }
+  __m.stop(__n);
+}
+
+// Bulk construction from input that is already in key order.
+template <typename _Map>
+static void bench_map_sorted_build(const int *, size_t __n, meter &__m) {
+  typedef pair_source<typename _Map::value_type> _Source;
+  std::vector<int> __sorted(__n);
+  for (size_t __i = 0; __i < __n; ++__i) __sorted[__i] = int(__i);
+  const _Source __first = {__sorted.data(), 0}, __last = {__sorted.data(), __n};
+  __m.start();
+  {
+    _Map __mp(__first, __last);
+    g_sink = __mp.size();
+  }
+  __m.stop(__n);
+}
+
+template <typename _Map>
+static void bench_map_find_bulk(const int *__keys, size_t __n, meter &__m) {
+  typedef pair_source<typename _Map::value_type> _Source;
+  const _Source __first = {__keys, 0}, __last = {__keys, __n};
+  const _Map __mp(__first, __last);
+  size_t __hits = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i)
+    __hits += __mp.find(int(__i)) != __mp.end();
+  __m.stop(__n);
+  g_sink = __hits;
+}
+
+// Range insert of the map's own elements, whole and then its upper half: a
+// no-op that must not read the input after the container has moved its
+// storage.
+template <typename _Map>
+static void bench_map_self_insert(const int *__keys, size_t __n, meter &__m) {
+  _Map __mp;
+  for (size_t __i = 0; __i < __n; ++__i) __mp[__keys[__i]] = int(__i);
+  __m.start();
+  __mp.insert(__mp.begin(), __mp.end());
+  typename _Map::iterator __mid = __mp.begin();
+  for (size_t __i = 0; __i < __n / 2; ++__i) ++__mid;
+  __mp.insert(__mid, __mp.end());
+  __m.stop(__n);
+  if (__mp.size() != __n) {
+    fprintf(stderr, "map_self_insert: %zu entries, expected %zu\n",
+            __mp.size(), __n);
+    abort();
+  }
+  g_sink = __mp.size();
+}
+
+// Steady-state insert/erase churn: every op erases one key and inserts a
+// fresh one into a map that holds n entries.
+template <typename _Map>
+static void _M_churn(_Map &__mp, const int *__keys, size_t __n, meter &__m) {
+  for (size_t __i = 0; __i < __n; ++__i) __mp[__keys[__i]] = int(__i);
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i) {
+    __mp.erase(__keys[__i]);
+    __mp[__keys[__i] + int(__n)] = int(__i);
+  }
+  __m.stop(__n);
+  g_sink = __mp.size();
+}
+
+template <typename _Map>
+static void bench_map_churn(const int *__keys, size_t __n, meter &__m) {
+  const size_t __live0 = g_live_bytes;
+  {
+    _Map __mp;
+    _M_churn(__mp, __keys, __n, __m);
+  }
+  if (g_live_bytes != __live0) {
+    fprintf(stderr, "map_churn: %zu bytes not returned to the heap\n",
+            g_live_bytes - __live0);
+    abort();
+  }
+}
+
+template <typename _Map>
+static void bench_map_churn_pool(const int *__keys, size_t __n, meter &__m) {
+  typedef typename _Map::allocator_type _Alloc;
+  aicuda::stl::node_pool __pool;
+  _Map __mp((typename _Map::key_compare()), _Alloc(__pool));
+  _M_churn(__mp, __keys, __n, __m);
+}
+
+template <typename _Map>
+static void bench_map_churn_region(const int *__keys, size_t __n, meter &__m) {
+  typedef typename _Map::allocator_type _Alloc;
+  static char *__buf = 0;
+  static size_t __buf_size = 0;
+  if (__buf_size < __n * 128) {
+    free(__buf);
+    __buf_size = __n * 128;
+    __buf = static_cast<char *>(malloc(__buf_size));
+  }
+  aicuda::stl::region __rg(__buf, __buf_size);
+  {
+    _Map __mp((typename _Map::key_compare()), _Alloc(__rg));
+    _M_churn(__mp, __keys, __n, __m);
+  }
+  __m.footprint(__rg.reserved());
+}
+
+// Shared histogram: _Threads threads count the keys of their slice of the
+// input (every key twice, as key / 2) into one table.  "concurrent" is the
+// lock-free concurrent_hash_map, "std_mutex" a std::unordered_map behind a
+// mutex, and "aicuda_private_merge" gives every thread its own map and
+// merges them afterwards.  All three must agree on the result.
+struct concurrent_counter {
+  aicuda::stl::concurrent_hash_map<int, int> _M_map;
+  explicit concurrent_counter(size_t __n) : _M_map(__n) {}
+  void add(int __k) { _M_map.insert_or_update(__k, 1, aicuda::stl::plus<int>()); }
+  size_t merge() { return _M_map.size(); }
+};
+
+struct mutex_counter {
+  std::unordered_map<int, int> _M_map;
+  std::mutex _M_lock;
+  explicit mutex_counter(size_t __n) { _M_map.reserve(__n); }
+  void add(int __k) {
+    std::lock_guard<std::mutex> __guard(_M_lock);
+    ++_M_map[__k];
+  }
+  size_t merge() { return _M_map.size(); }
+};
+
+struct private_merge_counter {
+  aicuda::stl::map<int, int> _M_local[64];
+  explicit private_merge_counter(size_t) {}
+  size_t merge() {
+    for (unsigned __t = 1; __t < 64; ++__t) {
+      for (aicuda::stl::map<int, int>::iterator __it = _M_local[__t].begin();
+           __it != _M_local[__t].end(); ++__it)
+        _M_local[0][__it->first] += __it->second;
+      _M_local[__t].clear();
+    }
+    return _M_local[0].size();
+  }
+};
+
+template <typename _Counter>
+static void _M_count_slice(_Counter *__c, const int *__keys, size_t __n,
+                           unsigned) {
+  for (size_t __i = 0; __i < __n; ++__i) __c->add(__keys[__i] >> 1);
+}
+
+static void _M_count_slice(private_merge_counter *__c, const int *__keys,
+                           size_t __n, unsigned __t) {
+  aicuda::stl::map<int, int> &__local = __c->_M_local[__t];
+  for (size_t __i = 0; __i < __n; ++__i) ++__local[__keys[__i] >> 1];
+}
+
+template <typename _Counter, unsigned _Threads>
+static void bench_concurrent_count(const int *__keys, size_t __n, meter &__m) {
+  _Counter __c(__n / 2 + 1);
+  std::vector<std::thread> __pool;
+  __pool.reserve(_Threads);
+  const size_t __slice = (__n + _Threads - 1) / _Threads;
+  __m.start();
+  for (unsigned __t = 0; __t < _Threads; ++__t) {
+    const size_t __lo = __t * __slice < __n ? __t * __slice : __n;
+    const size_t __hi = __lo + __slice < __n ? __lo + __slice : __n;
+    __pool.push_back(std::thread(
+        static_cast<void (*)(_Counter *, const int *, size_t, unsigned)>(
+            _M_count_slice),
+        &__c, __keys + __lo, __hi - __lo, __t));
+  }
+  for (unsigned __t = 0; __t < _Threads; ++__t) __pool[__t].join();
+  const size_t __distinct = __c.merge();
+  __m.stop(__n);
+  if (__distinct != (__n + 1) / 2) {
+    fprintf(stderr, "concurrent_count: %zu distinct keys, expected %zu\n",
+            __distinct, (__n + 1) / 2);
+    abort();
+  }
+  g_sink = __distinct;
+}
+
+// Allocator stress: each thread keeps a fixed set of live blocks of random
+// size (16 bytes to 2 KiB) and every op frees one of them and allocates a
+// replacement of a different size.  Throughput is per op over all threads;
+// the footprint column shows how much memory the mix ends up needing.
+struct heap_source {
+  void *allocate(size_t __n) { return ::operator new(__n); }
+  void deallocate(void *__p) { ::operator delete(__p); }
+};
+
+struct region_source {
+  aicuda::stl::region *_M_region;
+  void *allocate(size_t __n) { return _M_region->allocate(__n); }
+  void deallocate(void *__p) { _M_region->deallocate(__p); }
+};
+
+static const size_t _S_stress_slots = 4096;
+
+static size_t _M_stress_size(unsigned __k) {
+  return 16 + (__k * 2654435761u >> 8) % 2033;
+}
+
+template <typename _Source>
+static void _M_stress_thread(_Source __src, const int *__keys, size_t __n,
+                             unsigned __salt) {
+  void *__slots[_S_stress_slots];
+  const size_t __live = __n < _S_stress_slots ? __n : _S_stress_slots;
+  for (size_t __i = 0; __i < __live; ++__i)
+    __slots[__i] = __src.allocate(_M_stress_size(unsigned(__i) + __salt));
+  for (size_t __i = 0; __i < __n; ++__i) {
+    const size_t __j = size_t(__keys[__i]) % __live;
+    __src.deallocate(__slots[__j]);
+    __slots[__j] = __src.allocate(_M_stress_size(unsigned(__keys[__i]) ^ __salt));
+    static_cast<char *>(__slots[__j])[0] = char(__i);
+  }
+  for (size_t __i = 0; __i < __live; ++__i) __src.deallocate(__slots[__i]);
+}
+
+template <typename _Source>
+static void _M_stress(_Source __src, const int *__keys, size_t __n,
+                      unsigned __threads, meter &__m) {
+  __m.start();
+  if (__threads == 1)
+    _M_stress_thread(__src, __keys, __n, 0);
+  else {
+    std::vector<std::thread> __pool;
+    for (unsigned __t = 0; __t < __threads; ++__t)
+      __pool.push_back(std::thread(_M_stress_thread<_Source>, __src, __keys,
+                                   __n / __threads, __t * 0x9e3779b9u));
+    for (unsigned __t = 0; __t < __threads; ++__t) __pool[__t].join();
+  }
+  __m.stop(__n);
+}
+
+template <unsigned _Threads>
+static void bench_alloc_stress_heap(const int *__keys, size_t __n, meter &__m) {
+  _M_stress(heap_source(), __keys, __n, _Threads, __m);
+}
+
+template <unsigned _Threads>
+static void bench_alloc_stress_region(const int *__keys, size_t __n,
+                                      meter &__m) {
+  static const size_t __buf_size = size_t(256) << 20;
+  static char *__buf = static_cast<char *>(malloc(__buf_size));
+  aicuda::stl::region __rg(__buf, __buf_size);
+  region_source __src = {&__rg};
+  _M_stress(__src, __keys, __n, _Threads, __m);
+  __m.footprint(__rg.reserved());
+}
+
+template <typename _Set>
+static void bench_set_insert(const int *__keys, size_t __n, meter &__m) {
+  __m.start();
+  {
+    _Set __st;
+    for (size_t __i = 0; __i < __n; ++__i) __st.insert(__keys[__i]);
+    g_sink = __st.size();
+  }
+  __m.stop(__n);
+}
+
+template <typename _List>
+static void bench_list_push_back(const int *__keys, size_t __n, meter &__m) {
+  __m.start();
+  {
+    _List __lt;
+    for (size_t __i = 0; __i < __n; ++__i) __lt.push_back(__keys[__i]);
+    g_sink = size_t(__lt.back());
+  }
+  __m.stop(__n);
+}
+
+template <typename _List>
+static void bench_list_remove(const int *__keys, size_t __n, meter &__m) {
+  _List __lt;
+  for (size_t __i = 0; __i < __n; ++__i) __lt.push_back(__keys[__i] & 7);
+  __m.start();
+  __lt.remove(3);
+  __m.stop(__n);
+  g_sink = size_t(__lt.front());
+}
+
+template <typename _String>
+static void bench_string_append(const int *, size_t __n, meter &__m) {
+  __m.start();
+  {
+    _String __s;
+    for (size_t __i = 0; __i < __n; ++__i) __s.append("abcdefgh", 1 + (__i & 7));
+    g_sink = __s.size();
+  }
+  __m.stop(__n);
+}
+
+// Construct a string from a C string, copy it, assign to it and destroy
+// both: the life cycle of a map key or label.
+template <typename _String, size_t _Len>
+static void bench_string_lifecycle(const int *__keys, size_t __n, meter &__m) {
+  char __src[_Len + 1];
+  for (size_t __i = 0; __i < _Len; ++__i) __src[__i] = char('a' + __i % 26);
+  __src[_Len] = '\0';
+  size_t __sum = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i) {
+    __src[0] = char('a' + (__keys[__i] & 15));
+    _String __s(__src);
+    _String __t(__s);
+    __t = __s.c_str() + 1;
+    __sum += __s.size() + __t.size();
+  }
+  __m.stop(__n);
+  g_sink = __sum;
+}
+
+// Copy-on-write stress: every thread repeatedly copies one shared long
+// string, copies the copy and destroys both, so all threads hammer the same
+// reference count.  At the end the shared rep must be unshared again (the
+// first write does not clone) and the heap must be back where it started.
+template <typename _String, unsigned _Threads>
+static void bench_string_share(const int *, size_t __n, meter &__m) {
+  const _String __shared("a string long enough to live in a shared heap rep");
+  std::vector<std::thread> __pool;
+  __pool.reserve(_Threads);
+  const size_t __live0 = g_live_bytes;
+  __m.start();
+  for (unsigned __t = 0; __t < _Threads; ++__t)
+    __pool.push_back(std::thread([&__shared, __n]() {
+      size_t __sum = 0;
+      for (size_t __i = 0; __i < __n / _Threads; ++__i) {
+        _String __a(__shared);
+        _String __b(__a);
+        __sum += __b.size();
+      }
+      g_sink = __sum;
+    }));
+  for (unsigned __t = 0; __t < _Threads; ++__t) __pool[__t].join();
+  __m.stop(__n);
+  const size_t __allocs = g_alloc_count;
+  _String &__s = const_cast<_String &>(__shared);
+  __s[0] = 'A';
+  if (g_alloc_count != __allocs || g_live_bytes != __live0) {
+    fprintf(stderr, "string_share: reference count corrupted\n");
+    abort();
+  }
+}
+
+template <typename _String>
+static void bench_string_find(const int *__keys, size_t __n, meter &__m) {
+  _String __s;
+  for (size_t __i = 0; __i < __n; ++__i) __s += char('a' + (__keys[__i] % 4));
+  __m.start();
+  g_sink = __s.find("abcdabcz") + __s.find('z');
+  __m.stop(__n);
+}
+
+// A needle that almost matches everywhere: a naive scan compares most of
+// it at every position.
+template <typename _String>
+static void bench_string_find_periodic(const int *, size_t __n, meter &__m) {
+  const _String __s(__n, 'a');
+  __m.start();
+  g_sink = __s.find("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab") + __s.rfind("baaaaaaaaaaaaaaa");
+  __m.stop(__n);
+}
+
+static const char *aicuda_strstr(const char *__h, const char *__n) {
+  return aicuda::stl::string_op::strstr(__h, __n);
+}
+
+static const char *libc_strstr(const char *__h, const char *__n) {
+  return strstr(__h, __n);
+}
+
+template <const char *(*_Fn)(const char *, const char *)>
+static void bench_strstr(const int *__keys, size_t __n, meter &__m) {
+  std::string __s;
+  for (size_t __i = 0; __i < __n; ++__i) __s += char('a' + (__keys[__i] % 4));
+  __m.start();
+  g_sink = size_t(_Fn(__s.c_str(), "abcdabcz") != 0) + size_t(_Fn(__s.c_str(), "aaaaaaaaaaaaaaaaaaaaaaaz") != 0);
+  __m.stop(__n);
+}
+
+static char *aicuda_strtok_r(char *__s, const char *__d, char **__save) {
+  return aicuda::stl::string_op::strtok_r(__s, __d, __save);
+}
+
+static char *libc_strtok_r(char *__s, const char *__d, char **__save) {
+  return strtok_r(__s, __d, __save);
+}
+
+// Tokenize n short fields separated by runs drawn from a five-byte
+// delimiter set; n counts fields.
+template <char *(*_Fn)(char *, const char *, char **)>
+static void bench_strtok(const int *__keys, size_t __n, meter &__m) {
+  static const char __delims[] = " ,;\t\n";
+  std::string __s;
+  for (size_t __i = 0; __i < __n; ++__i) {
+    __s.append(size_t(1 + __keys[__i] % 7), char('a' + __keys[__i] % 26));
+    __s += __delims[__keys[__i] % 5];
+    if (__keys[__i] % 3 == 0) __s += __delims[(__keys[__i] >> 3) % 5];
+  }
+  size_t __tokens = 0;
+  char *__save = NULL;
+  __m.start();
+  for (char *__t = _Fn(&__s[0], __delims, &__save); __t;
+       __t = _Fn(NULL, __delims, &__save))
+    ++__tokens;
+  __m.stop(__n);
+  g_sink = __tokens;
+}
+
+// find_first_of / find_first_not_of walking a string of n bytes with a
+// twelve-character set.
+template <typename _String>
+static void bench_string_find_first_of(const int *__keys, size_t __n,
+                                       meter &__m) {
+  _String __s;
+  for (size_t __i = 0; __i < __n; ++__i)
+    __s += char(__keys[__i] % 8 ? 'a' + __keys[__i] % 26 : '0' + __keys[__i] % 10);
+  size_t __hits = 0;
+  __m.start();
+  for (size_t __p = 0; (__p = __s.find_first_of("0123456789+-", __p)) != _String::npos;) {
+    ++__hits;
+    __p = __s.find_first_not_of("0123456789+-", __p);
+    if (__p == _String::npos) break;
+  }
+  __m.stop(__n);
+  g_sink = __hits;
+}
+
+// Split one long log line of n "request_id=NNNNNNNN" fields on spaces and
+// match every token: _Text::substr hands out an owning string per token,
+// a string_view only moves a window over the line.
+template <typename _Line, typename _Text>
+static void bench_tokenize(const int *__keys, size_t __n, meter &__m) {
+  _Line __line;
+  for (size_t __i = 0; __i < __n; ++__i) {
+    char __field[32];
+    snprintf(__field, sizeof(__field), "request_id=%08d ", __keys[__i]);
+    __line += __field;
+  }
+  const _Text __text(__line);
+  size_t __hits = 0;
+  __m.start();
+  for (size_t __b = 0, __e; (__e = __text.find(' ', __b)) != _Text::npos;
+       __b = __e + 1)
+    if (__text.substr(__b, __e - __b) == "request_id=00000042") ++__hits;
+  __m.stop(__n);
+  g_sink = __hits;
+}
+
+// The same line walked with split(), which yields the fields as views.
+static void bench_split(const int *__keys, size_t __n, meter &__m) {
+  aicuda::stl::string __line;
+  for (size_t __i = 0; __i < __n; ++__i) {
+    char __field[32];
+    snprintf(__field, sizeof(__field), "request_id=%08d ", __keys[__i]);
+    __line += __field;
+  }
+  size_t __hits = 0;
+  __m.start();
+  for (aicuda::stl::string_view __f : aicuda::stl::split(__line, ' ', true))
+    if (__f == "request_id=00000042") ++__hits;
+  __m.stop(__n);
+  g_sink = __hits;
+}
+
+// string_op scans against the plain byte loops they replaced, on strings of
+// 12 bytes, 200 bytes and 4 KiB.  Every call starts at a different offset
+// (0..7) so aligned and unaligned starts are both covered; n is the number
+// of calls, capped at _S_scan_calls.  The reference loops read through
+// volatile so the compiler cannot turn them back into libc calls.
+enum { _S_scan_calls = 100000 };
+
+struct byte_ops {
+  static size_t strlen(const char *__s) {
+    size_t __n = 0;
+    while (*(volatile const char *)__s++ != '\0') ++__n;
+    return __n;
+  }
+
+  static const void *memchr(const void *__s, int __c, size_t __n) {
+    const volatile unsigned char *__p = (const unsigned char *)__s;
+    for (size_t __i = 0; __i < __n; ++__i)
+      if (__p[__i] == (unsigned char)__c) return (const void *)(__p + __i);
+    return 0;
+  }
+
+  static int memcmp(const void *__s1, const void *__s2, size_t __n) {
+    const volatile unsigned char *__p1 = (const unsigned char *)__s1;
+    const volatile unsigned char *__p2 = (const unsigned char *)__s2;
+    for (size_t __i = 0; __i < __n; ++__i)
+      if (__p1[__i] != __p2[__i]) return __p1[__i] - __p2[__i];
+    return 0;
+  }
+};
+
+static char g_scan_a[4096 + 16];
+static char g_scan_b[4096 + 16];
+
+static void _M_scan_setup(size_t __len) {
+  memset(g_scan_a, 'a', sizeof(g_scan_a));
+  memset(g_scan_b, 'a', sizeof(g_scan_b));
+  g_scan_a[__len + 8] = 'z';
+  g_scan_a[__len + 9] = '\0';
+  g_scan_b[__len + 9] = '\0';
+}
+
+template <typename _Ops, size_t _Len>
+static void bench_strlen(const int *, size_t __n, meter &__m) {
+  if (__n > _S_scan_calls) __n = _S_scan_calls;
+  _M_scan_setup(_Len);
+  size_t __sum = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i) __sum += _Ops::strlen(g_scan_a + (__i & 7));
+  __m.stop(__n);
+  g_sink = __sum;
+}
+
+template <typename _Ops, size_t _Len>
+static void bench_memchr(const int *, size_t __n, meter &__m) {
+  if (__n > _S_scan_calls) __n = _S_scan_calls;
+  _M_scan_setup(_Len);
+  size_t __sum = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i)
+    __sum += (const char *)_Ops::memchr(g_scan_a + (__i & 7), 'z', _Len + 8) -
+             g_scan_a;
+  __m.stop(__n);
+  g_sink = __sum;
+}
+
+template <typename _Ops, size_t _Len>
+static void bench_memcmp(const int *, size_t __n, meter &__m) {
+  if (__n > _S_scan_calls) __n = _S_scan_calls;
+  _M_scan_setup(_Len);
+  size_t __sum = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i)
+    __sum += _Ops::memcmp(g_scan_a + (__i & 7), g_scan_b + (__i & 7), _Len + 4);
+  __m.stop(__n);
+  g_sink = __sum;
+}
+
+static size_t aicuda_hash_bytes(const void *__p, size_t __n) {
+  return aicuda::stl::__hash_bytes(__p, __n);
+}
+
+// libstdc++'s kernel behind std::hash<std::string>.
+static size_t std_hash_bytes(const void *__p, size_t __n) {
+  return std::_Hash_bytes(__p, __n, 0xc70f6907UL);
+}
+
+// Hashes of _Len-byte keys at offsets 0..7; n is the number of keys,
+// capped at _S_scan_calls.
+template <size_t (*_Fn)(const void *, size_t), size_t _Len>
+static void bench_hash_bytes(const int *, size_t __n, meter &__m) {
+  if (__n > _S_scan_calls) __n = _S_scan_calls;
+  _M_scan_setup(_Len);
+  size_t __sum = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i) {
+    g_scan_a[__i & 7] = char(__i);
+    __sum += _Fn(g_scan_a + (__i & 7), _Len);
+  }
+  __m.stop(__n);
+  g_sink = __sum;
+}
+
+static std::string std_to_string(int __v) { return std::to_string(__v); }
+
+static aicuda::stl::string aicuda_to_string(int __v) {
+  return aicuda::stl::string::to_string(__v);
+}
+
+template <typename _String, _String (*_Fn)(int)>
+static void bench_to_string(const int *__keys, size_t __n, meter &__m) {
+  size_t __len = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i) __len += _Fn(__keys[__i] * 7919).size();
+  __m.stop(__n);
+  g_sink = __len;
+}
+
+// Format 64-bit IDs into a caller buffer: to_chars against snprintf.
+static size_t aicuda_format_id(char *__buf, long long __v) {
+  return aicuda::stl::to_chars(__buf, __buf + 24, __v).ptr - __buf;
+}
+
+static size_t snprintf_format_id(char *__buf, long long __v) {
+  return size_t(snprintf(__buf, 24, "%lld", __v));
+}
+
+template <size_t (*_Fn)(char *, long long)>
+static void bench_format_id(const int *__keys, size_t __n, meter &__m) {
+  char __buf[24];
+  size_t __len = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i)
+    __len += _Fn(__buf, (long long)__keys[__i] * 2654435761LL - 40000000000LL);
+  __m.stop(__n);
+  g_sink = __len;
+}
+
+// Doubles spread over many magnitudes, for the shortest formatters.
+static double make_double(int __k) {
+  return ldexp(double(__k) * 1.0000001 + 0.3, (__k % 97) - 48);
+}
+
+static size_t aicuda_dtoa(char *__buf, double __v) {
+  return aicuda::stl::to_chars(__buf, __buf + 32, __v).ptr - __buf;
+}
+
+static size_t snprintf_dtoa(char *__buf, double __v) {
+  return size_t(snprintf(__buf, 32, "%.17g", __v));
+}
+
+template <size_t (*_Fn)(char *, double)>
+static void bench_dtoa(const int *__keys, size_t __n, meter &__m) {
+  char __buf[32];
+  size_t __len = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i)
+    __len += _Fn(__buf, make_double(__keys[__i]));
+  __m.stop(__n);
+  g_sink = __len;
+}
+
+// The integer-part-plus-scaled-fraction routine to_string(double) used
+// before it went through to_chars, kept as the baseline.
+static aicuda::stl::string legacy_double_to_string(double __v) {
+  long long __integer = (long long)__v;
+  aicuda::stl::string __ret = aicuda::stl::string::to_string(__integer);
+  __ret.append(1, '.');
+  __v -= __integer;
+  for (int __i = 0; __i < 6; ++__i) __v *= 10;
+  aicuda::stl::string __postfix =
+      aicuda::stl::string::to_string((long long)__v);
+  int __c = 6 - int(__postfix.size());
+  if (__c > 0) __ret.append(__c, '0');
+  return __ret + __postfix;
+}
+
+static aicuda::stl::string aicuda_double_to_string(double __v) {
+  return aicuda::stl::string::to_string(__v, 6);
+}
+
+static std::string std_double_to_string(double __v) {
+  return std::to_string(__v);
+}
+
+template <typename _String, _String (*_Fn)(double)>
+static void bench_double_to_string(const int *__keys, size_t __n, meter &__m) {
+  size_t __len = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i)
+    __len += _Fn((__keys[__i] - 500000) * 0.0137).size();
+  __m.stop(__n);
+  g_sink = __len;
+}
+
+// Hexadecimal to_string(double), checked by reading every result back with
+// strtod and against a few fixed cases: a sign, shortest-mode precision and
+// a clamped magnitude.
+static aicuda::stl::string aicuda_double_to_hex(double __v) {
+  return aicuda::stl::string::to_string(__v, 6, 16);
+}
+
+static void bench_double_to_hex(const int *__keys, size_t __n, meter &__m) {
+  bench_double_to_string<aicuda::stl::string, aicuda_double_to_hex>(__keys, __n,
+                                                                    __m);
+  for (size_t __i = 0; __i < __n; ++__i) {
+    const double __v = (__keys[__i] - 500000) * 0.0137;
+    const aicuda::stl::string __s = aicuda_double_to_hex(__v);
+    std::string __hex(__s.c_str());
+    __hex.insert(__hex[0] == '-' ? 1 : 0, "0x");
+    if (fabs(strtod(__hex.c_str(), 0) - __v) >= 1.0 / (1 << 24)) {
+      fprintf(stderr, "to_string_double: %g in base 16 gave %s\n", __v,
+              __s.c_str());
+      abort();
+    }
+  }
+  static const struct {
+    double _M_v;
+    int _M_prec;
+    const char *_M_want;
+  } __cases[] = {{2.5, -1, "2"},
+                 {-0.5, 3, "-0.800"},
+                 {-1.0, 0, "-1"},
+                 {1e300, 0, "fffffffffffff800"}};
+  for (size_t __i = 0; __i < sizeof(__cases) / sizeof(__cases[0]); ++__i) {
+    const aicuda::stl::string __s = aicuda::stl::string::to_string(
+        __cases[__i]._M_v, __cases[__i]._M_prec, 16);
+    if (strcmp(__s.c_str(), __cases[__i]._M_want) != 0) {
+      fprintf(stderr, "to_string_double: %g in base 16 gave %s, not %s\n",
+              __cases[__i]._M_v, __s.c_str(), __cases[__i]._M_want);
+      abort();
+    }
+  }
+}
+
+// Parse a column of numbers (formatted before timing): from_chars against
+// strtoll and strtod.
+static size_t aicuda_parse_int(const char *__p, const char *__end, double &__sum) {
+  long long __v = 0;
+  const char *__q = aicuda::stl::from_chars(__p, __end, __v).ptr;
+  __sum += double(__v);
+  return __q - __p;
+}
+
+static size_t strtoll_parse_int(const char *__p, const char *, double &__sum) {
+  char *__q;
+  __sum += double(strtoll(__p, &__q, 10));
+  return __q - __p;
+}
+
+static size_t aicuda_parse_double(const char *__p, const char *__end, double &__sum) {
+  double __v = 0;
+  const char *__q = aicuda::stl::from_chars(__p, __end, __v).ptr;
+  __sum += __v;
+  return __q - __p;
+}
+
+static size_t strtod_parse_double(const char *__p, const char *, double &__sum) {
+  char *__q;
+  __sum += strtod(__p, &__q);
+  return __q - __p;
+}
+
+template <bool _Double, size_t (*_Fn)(const char *, const char *, double &)>
+static void bench_parse(const int *__keys, size_t __n, meter &__m) {
+  std::string __text;
+  char __buf[32];
+  for (size_t __i = 0; __i < __n; ++__i) {
+    if (_Double)
+      snprintf(__buf, sizeof(__buf), "%.17g", make_double(__keys[__i]));
+    else
+      snprintf(__buf, sizeof(__buf), "%lld",
+               (long long)__keys[__i] * 2654435761LL - 40000000000LL);
+    __text += __buf;
+    __text += '\n';
+  }
+  const char *__p = __text.c_str();
+  const char *__end = __p + __text.size();
+  double __sum = 0;
+  __m.start();
+  for (size_t __i = 0; __i < __n; ++__i) __p += _Fn(__p, __end, __sum) + 1;
+  __m.stop(__n);
+  g_sink = size_t(__sum);
+}
+
+struct bench_case {
+  const char *name;
+  const char *impl;
+  void (*fn)(const int *, size_t, meter &);
+};
+
+static const bench_case g_cases[] = {
+    {"vector_push_back", "aicuda", bench_vector_push_back<aicuda::stl::vector<int> >},
+    {"vector_push_back", "std", bench_vector_push_back<std::vector<int> >},
+    {"vector_copy", "aicuda", bench_vector_copy<aicuda::stl::vector<int> >},
+    {"vector_copy", "std", bench_vector_copy<std::vector<int> >},
+    {"vector_fill_zero", "aicuda", bench_vector_fill<aicuda::stl::vector<int>, 0>},
+    {"vector_fill_zero", "std", bench_vector_fill<std::vector<int>, 0>},
+    {"vector_fill_value", "aicuda", bench_vector_fill<aicuda::stl::vector<int>, 7>},
+    {"vector_fill_value", "std", bench_vector_fill<std::vector<int>, 7>},
+    {"map_subscript", "aicuda", bench_map_subscript<aicuda::stl::map<int, int> >},
+    {"map_subscript", "std", bench_map_subscript<std::map<int, int> >},
+    {"map_subscript", "aicuda_btree",
+     bench_map_subscript<aicuda::stl::btree_map<int, int> >},
+    {"map_subscript", "aicuda_arena",
+     bench_map_subscript_arena<aicuda::stl::map<
+         int, int, aicuda::stl::less<int>,
+         aicuda::stl::arena_allocator<aicuda::stl::pair<const int, int> > > >},
+    {"map_subscript", "aicuda_shared",
+     bench_map_subscript_shared<aicuda::stl::map<
+         int, int, aicuda::stl::less<int>,
+         aicuda::stl::shared_allocator<aicuda::stl::pair<const int, int> > > >},
+    {"map_subscript", "aicuda_unordered",
+     bench_map_subscript<aicuda::stl::unordered_map<int, int> >},
+    {"map_subscript", "std_unordered",
+     bench_map_subscript<std::unordered_map<int, int> >},
+    {"map_subscript_chain", "aicuda_unordered",
+     bench_map_subscript_chain<aicuda::stl::unordered_map<int, int> >},
+    {"map_subscript_chain", "std_unordered",
+     bench_map_subscript_chain<std::unordered_map<int, int> >},
+    {"map_find", "aicuda", bench_map_find<aicuda::stl::map<int, int> >},
+    {"map_find", "std", bench_map_find<std::map<int, int> >},
+    {"map_find", "aicuda_btree",
+     bench_map_find<aicuda::stl::btree_map<int, int> >},
+    {"map_find", "aicuda_flat",
+     bench_map_find_bulk<aicuda::stl::flat_map<int, int> >},
+    {"map_find", "aicuda_unordered",
+     bench_map_find<aicuda::stl::unordered_map<int, int> >},
+    {"map_find", "std_unordered", bench_map_find<std::unordered_map<int, int> >},
+    {"map_bulk_build", "aicuda",
+     bench_map_bulk_build<aicuda::stl::map<int, int> >},
+    {"map_bulk_build", "aicuda_btree",
+     bench_map_bulk_build<aicuda::stl::btree_map<int, int> >},
+    {"map_bulk_build", "aicuda_flat",
+     bench_map_bulk_build<aicuda::stl::flat_map<int, int> >},
+    {"map_bulk_build", "std", bench_map_bulk_build<std::map<int, int> >},
+    {"map_self_insert", "aicuda",
+     bench_map_self_insert<aicuda::stl::map<int, int> >},
+    {"map_self_insert", "aicuda_flat",
+     bench_map_self_insert<aicuda::stl::flat_map<int, int> >},
+    {"map_self_insert", "std", bench_map_self_insert<std::map<int, int> >},
+    {"map_sorted_build", "aicuda",
+     bench_map_sorted_build<aicuda::stl::map<int, int> >},
+    {"map_sorted_build", "aicuda_btree",
+     bench_map_sorted_build<aicuda::stl::btree_map<int, int> >},
+    {"map_sorted_build", "aicuda_flat",
+     bench_map_sorted_build<aicuda::stl::flat_map<int, int> >},
+    {"map_sorted_build", "std",
+     bench_map_sorted_build<std::map<int, int> >},
+    {"map_churn", "aicuda", bench_map_churn<aicuda::stl::map<int, int> >},
+    {"map_churn", "std", bench_map_churn<std::map<int, int> >},
+    {"map_churn", "aicuda_btree",
+     bench_map_churn<aicuda::stl::btree_map<int, int> >},
+    {"map_churn", "aicuda_pool",
+     bench_map_churn_pool<aicuda::stl::map<
+         int, int, aicuda::stl::less<int>,
+         aicuda::stl::pool_allocator<aicuda::stl::pair<const int, int> > > >},
+    {"map_churn", "aicuda_warp",
+     bench_map_churn<aicuda::stl::map<
+         int, int, aicuda::stl::less<int>,
+         aicuda::stl::warp_allocator<aicuda::stl::pair<const int, int> > > >},
+    {"map_churn", "aicuda_region",
+     bench_map_churn_region<aicuda::stl::map<
+         int, int, aicuda::stl::less<int>,
+         aicuda::stl::region_allocator<aicuda::stl::pair<const int, int> > > >},
+    {"map_churn", "aicuda_unordered",
+     bench_map_churn<aicuda::stl::unordered_map<int, int> >},
+    {"map_churn", "std_unordered", bench_map_churn<std::unordered_map<int, int> >},
+    {"concurrent_count_4t", "aicuda_concurrent",
+     bench_concurrent_count<concurrent_counter, 4>},
+    {"concurrent_count_4t", "aicuda_private_merge",
+     bench_concurrent_count<private_merge_counter, 4>},
+    {"concurrent_count_4t", "std_mutex",
+     bench_concurrent_count<mutex_counter, 4>},
+    {"alloc_stress", "heap", bench_alloc_stress_heap<1>},
+    {"alloc_stress", "region", bench_alloc_stress_region<1>},
+    {"alloc_stress_4t", "heap", bench_alloc_stress_heap<4>},
+    {"alloc_stress_4t", "region", bench_alloc_stress_region<4>},
+    {"set_insert", "aicuda", bench_set_insert<aicuda::stl::set<int> >},
+    {"set_insert", "std", bench_set_insert<std::set<int> >},
+    {"set_insert", "aicuda_btree",
+     bench_set_insert<aicuda::stl::btree_set<int> >},
+    {"list_push_back", "aicuda", bench_list_push_back<aicuda::stl::list<int> >},
+    {"list_push_back", "std", bench_list_push_back<std::list<int> >},
+    {"list_remove", "aicuda", bench_list_remove<aicuda::stl::list<int> >},
+    {"list_remove", "std", bench_list_remove<std::list<int> >},
+    {"string_append", "aicuda", bench_string_append<aicuda::stl::string>},
+    {"string_append", "std", bench_string_append<std::string>},
+    {"string_short", "aicuda", bench_string_lifecycle<aicuda::stl::string, 11>},
+    {"string_short", "std", bench_string_lifecycle<std::string, 11>},
+    {"string_long", "aicuda", bench_string_lifecycle<aicuda::stl::string, 40>},
+    {"string_long", "std", bench_string_lifecycle<std::string, 40>},
+    {"string_share_4t", "aicuda", bench_string_share<aicuda::stl::string, 4>},
+    {"string_share_4t", "std", bench_string_share<std::string, 4>},
+    {"string_find", "aicuda", bench_string_find<aicuda::stl::string>},
+    {"string_find", "std", bench_string_find<std::string>},
+    {"string_find_periodic", "aicuda",
+     bench_string_find_periodic<aicuda::stl::string>},
+    {"string_find_periodic", "std", bench_string_find_periodic<std::string>},
+    {"strstr", "aicuda", bench_strstr<aicuda_strstr>},
+    {"strstr", "libc", bench_strstr<libc_strstr>},
+    {"strtok", "aicuda", bench_strtok<aicuda_strtok_r>},
+    {"strtok", "libc", bench_strtok<libc_strtok_r>},
+    {"string_find_first_of", "aicuda",
+     bench_string_find_first_of<aicuda::stl::string>},
+    {"string_find_first_of", "std", bench_string_find_first_of<std::string>},
+    {"string_tokenize", "aicuda",
+     bench_tokenize<aicuda::stl::string, aicuda::stl::string>},
+    {"string_tokenize", "aicuda_view",
+     bench_tokenize<aicuda::stl::string, aicuda::stl::string_view>},
+    {"string_tokenize", "std", bench_tokenize<std::string, std::string>},
+    {"string_tokenize", "aicuda_split", bench_split},
+    {"strlen_short", "aicuda", bench_strlen<aicuda::stl::string_op, 12>},
+    {"strlen_short", "bytewise", bench_strlen<byte_ops, 12>},
+    {"strlen_medium", "aicuda", bench_strlen<aicuda::stl::string_op, 200>},
+    {"strlen_medium", "bytewise", bench_strlen<byte_ops, 200>},
+    {"strlen_4k", "aicuda", bench_strlen<aicuda::stl::string_op, 4096>},
+    {"strlen_4k", "bytewise", bench_strlen<byte_ops, 4096>},
+    {"memchr_short", "aicuda", bench_memchr<aicuda::stl::string_op, 12>},
+    {"memchr_short", "bytewise", bench_memchr<byte_ops, 12>},
+    {"memchr_medium", "aicuda", bench_memchr<aicuda::stl::string_op, 200>},
+    {"memchr_medium", "bytewise", bench_memchr<byte_ops, 200>},
+    {"memchr_4k", "aicuda", bench_memchr<aicuda::stl::string_op, 4096>},
+    {"memchr_4k", "bytewise", bench_memchr<byte_ops, 4096>},
+    {"memcmp_short", "aicuda", bench_memcmp<aicuda::stl::string_op, 12>},
+    {"memcmp_short", "bytewise", bench_memcmp<byte_ops, 12>},
+    {"memcmp_medium", "aicuda", bench_memcmp<aicuda::stl::string_op, 200>},
+    {"memcmp_medium", "bytewise", bench_memcmp<byte_ops, 200>},
+    {"memcmp_4k", "aicuda", bench_memcmp<aicuda::stl::string_op, 4096>},
+    {"memcmp_4k", "bytewise", bench_memcmp<byte_ops, 4096>},
+    {"to_string", "aicuda", bench_to_string<aicuda::stl::string, aicuda_to_string>},
+    {"to_string", "std", bench_to_string<std::string, std_to_string>},
+    {"to_chars", "aicuda", bench_format_id<aicuda_format_id>},
+    {"to_chars", "snprintf", bench_format_id<snprintf_format_id>},
+    {"dtoa_shortest", "aicuda", bench_dtoa<aicuda_dtoa>},
+    {"dtoa_shortest", "snprintf", bench_dtoa<snprintf_dtoa>},
+    {"to_string_double", "aicuda",
+     bench_double_to_string<aicuda::stl::string, aicuda_double_to_string>},
+    {"to_string_double", "legacy",
+     bench_double_to_string<aicuda::stl::string, legacy_double_to_string>},
+    {"to_string_double", "std",
+     bench_double_to_string<std::string, std_double_to_string>},
+    {"to_string_double", "aicuda_hex", bench_double_to_hex},
+    {"from_chars_int", "aicuda", bench_parse<false, aicuda_parse_int>},
+    {"from_chars_int", "strtoll", bench_parse<false, strtoll_parse_int>},
+    {"from_chars_double", "aicuda", bench_parse<true, aicuda_parse_double>},
+    {"from_chars_double", "strtod", bench_parse<true, strtod_parse_double>},
+    {"hash_short", "aicuda", bench_hash_bytes<aicuda_hash_bytes, 12>},
+    {"hash_short", "std", bench_hash_bytes<std_hash_bytes, 12>},
+    {"hash_medium", "aicuda", bench_hash_bytes<aicuda_hash_bytes, 200>},
+    {"hash_medium", "std", bench_hash_bytes<std_hash_bytes, 200>},
+    {"hash_4k", "aicuda", bench_hash_bytes<aicuda_hash_bytes, 4096>},
+    {"hash_4k", "std", bench_hash_bytes<std_hash_bytes, 4096>},
+};
+
+int main(int argc, char **argv) {
+  bool __json = false;
+  size_t __max = 1000000;
+  const char *__filter = 0;
+  for (int __i = 1; __i < argc; ++__i) {
+    if (!strcmp(argv[__i], "--json"))
+      __json = true;
+    else if (!strcmp(argv[__i], "--max") && __i + 1 < argc)
+      __max = strtoul(argv[++__i], 0, 10);
+    else if (!strcmp(argv[__i], "--filter") && __i + 1 < argc)
+      __filter = argv[++__i];
+    else {
+      fprintf(stderr, "usage: %s [--json] [--max N] [--filter SUBSTR]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+
+  if (!__json)
+    printf("benchmark,impl,n,ns_per_op,bytes_per_run,allocs_per_run,"
+           "peak_bytes\n");
+
+  for (size_t __n = 10; __n <= __max; __n *= 10) {
+    const std::vector<int> __keys = make_keys(__n);
+    const size_t __reps = __n >= 100000 ? 3 : 1000000 / __n;
+    for (size_t __c = 0; __c < sizeof(g_cases) / sizeof(g_cases[0]); ++__c) {
+      const bench_case &__bc = g_cases[__c];
+      if (__filter && !strstr(__bc.name, __filter)) continue;
+      meter __m;
+      for (size_t __r = 0; __r < __reps; ++__r) __bc.fn(&__keys[0], __n, __m);
+      const double __ns = __m._M_ns / double(__m._M_ops);
+      const double __bytes = double(__m._M_bytes) / double(__reps);
+      const double __allocs = double(__m._M_allocs) / double(__reps);
+      if (__json)
+        printf("{\"benchmark\":\"%s\",\"impl\":\"%s\",\"n\":%zu,"
+               "\"ns_per_op\":%.3f,\"bytes_per_run\":%.0f,"
+               "\"allocs_per_run\":%.0f,\"peak_bytes\":%zu}\n",
+               __bc.name, __bc.impl, __n, __ns, __bytes, __allocs, __m._M_peak);
+      else
+        printf("%s,%s,%zu,%.3f,%.0f,%.0f,%zu\n", __bc.name, __bc.impl, __n,
+               __ns, __bytes, __allocs, __m._M_peak);
+      fflush(stdout);
+    }
+  }
+  return 0;
+}